@@ -2,60 +2,172 @@
 
 #include "RemoteControlMaskingFactories.h"
 
-/**
- * FVectorMaskingFactory
- */
-TSharedRef<IRemoteControlMaskingFactory> FVectorMaskingFactory::MakeInstance()
-{
-	return MakeShared<FVectorMaskingFactory>();
-}
+#include "Math/VectorRegister.h"
 
-void FVectorMaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
+namespace UE::RemoteControlMasking::Private
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
+	/** Converts a masked struct from and to the four lanes of the pre masking cache, lanes without a component are left untouched. */
+	template<typename StructType>
+	struct TMaskedStructLanes;
+
+	template<>
+	struct TMaskedStructLanes<FVector>
 	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
+		static void ToLanes(const FVector& InValue, FVector4& OutLanes) { OutLanes.X = InValue.X; OutLanes.Y = InValue.Y; OutLanes.Z = InValue.Z; }
+		static void FromLanes(const FVector4& InLanes, FVector& OutValue) { OutValue.X = InLanes.X; OutValue.Y = InLanes.Y; OutValue.Z = InLanes.Z; }
+	};
+
+	template<>
+	struct TMaskedStructLanes<FVector4>
+	{
+		static void ToLanes(const FVector4& InValue, FVector4& OutLanes) { OutLanes = InValue; }
+		static void FromLanes(const FVector4& InLanes, FVector4& OutValue) { OutValue = InLanes; }
+	};
+
+	template<>
+	struct TMaskedStructLanes<FIntVector>
+	{
+		static void ToLanes(const FIntVector& InValue, FVector4& OutLanes) { OutLanes.X = InValue.X; OutLanes.Y = InValue.Y; OutLanes.Z = InValue.Z; }
+		static void FromLanes(const FVector4& InLanes, FIntVector& OutValue) { OutValue.X = (int32)InLanes.X; OutValue.Y = (int32)InLanes.Y; OutValue.Z = (int32)InLanes.Z; }
+	};
+
+	template<>
+	struct TMaskedStructLanes<FIntVector4>
+	{
+		static void ToLanes(const FIntVector4& InValue, FVector4& OutLanes) { OutLanes.X = InValue.X; OutLanes.Y = InValue.Y; OutLanes.Z = InValue.Z; OutLanes.W = InValue.W; }
+		static void FromLanes(const FVector4& InLanes, FIntVector4& OutValue) { OutValue.X = (int32)InLanes.X; OutValue.Y = (int32)InLanes.Y; OutValue.Z = (int32)InLanes.Z; OutValue.W = (int32)InLanes.W; }
+	};
+
+	template<>
+	struct TMaskedStructLanes<FRotator>
+	{
+		static void ToLanes(const FRotator& InValue, FVector4& OutLanes) { OutLanes.X = InValue.Roll; OutLanes.Y = InValue.Pitch; OutLanes.Z = InValue.Yaw; }
+		static void FromLanes(const FVector4& InLanes, FRotator& OutValue) { OutValue.Roll = InLanes.X; OutValue.Pitch = InLanes.Y; OutValue.Yaw = InLanes.Z; }
+	};
+
+	template<>
+	struct TMaskedStructLanes<FColor>
+	{
+		static void ToLanes(const FColor& InValue, FVector4& OutLanes) { OutLanes.X = InValue.R; OutLanes.Y = InValue.G; OutLanes.Z = InValue.B; }
+		static void FromLanes(const FVector4& InLanes, FColor& OutValue) { OutValue.R = (uint8)InLanes.X; OutValue.G = (uint8)InLanes.Y; OutValue.B = (uint8)InLanes.Z; }
+	};
+
+	template<>
+	struct TMaskedStructLanes<FLinearColor>
+	{
+		static void ToLanes(const FLinearColor& InValue, FVector4& OutLanes) { OutLanes.X = InValue.R; OutLanes.Y = InValue.G; OutLanes.Z = InValue.B; OutLanes.W = InValue.A; }
+		static void FromLanes(const FVector4& InLanes, FLinearColor& OutValue) { OutValue.R = (float)InLanes.X; OutValue.G = (float)InLanes.Y; OutValue.B = (float)InLanes.Z; OutValue.A = (float)InLanes.W; }
+	};
 
-			if (const FVector* VectorProp = ToStructProp->ContainerPtrToValuePtr<FVector>(OwningObject))
+	/** Returns the lane select mask of a combination of masks, lanes of masked components are all ones. */
+	const VectorRegister4Double& GetLaneSelectMask(ERCMask InMasks)
+	{
+		static const TStaticArray<VectorRegister4Double, 16> LaneSelectMasks = []()
+		{
+			TStaticArray<VectorRegister4Double, 16> Masks;
+			for (uint8 Index = 0; Index < 16; ++Index)
 			{
-				FVector MaskedVector;
+				const VectorRegister4Double Lanes = MakeVectorRegisterDouble(
+					(Index & (uint8)ERCMask::MaskA) ? 1.0 : 0.0,
+					(Index & (uint8)ERCMask::MaskB) ? 1.0 : 0.0,
+					(Index & (uint8)ERCMask::MaskC) ? 1.0 : 0.0,
+					(Index & (uint8)ERCMask::MaskD) ? 1.0 : 0.0);
+
+				Masks[Index] = VectorCompareGT(Lanes, VectorZeroDouble());
+			}
+			return Masks;
+		}();
+
+		return LaneSelectMasks[(uint8)InMasks & 0x0F];
+	}
 
-				MaskedVector.X = InMaskingOperation->HasMask(ERCMask::MaskA) ? VectorProp->X : InMaskingOperation->PreMaskingCache.X;
-				MaskedVector.Y = InMaskingOperation->HasMask(ERCMask::MaskB) ? VectorProp->Y : InMaskingOperation->PreMaskingCache.Y;
-				MaskedVector.Z = InMaskingOperation->HasMask(ERCMask::MaskC) ? VectorProp->Z : InMaskingOperation->PreMaskingCache.Z;
+	/** Takes the masked components from the new value and the others from the pre masking cache. */
+	template<typename StructType>
+	void SelectMaskedLanes(const FRCMaskingOperation& InMaskingOperation, StructType& InOutValue)
+	{
+		FVector4 NewLanes = InMaskingOperation.PreMaskingCache;
+		TMaskedStructLanes<StructType>::ToLanes(InOutValue, NewLanes);
+
+		const VectorRegister4Double MaskedLanes = VectorSelect(GetLaneSelectMask(InMaskingOperation.Masks), VectorLoad(&NewLanes.X), VectorLoad(&InMaskingOperation.PreMaskingCache.X));
+
+		FVector4 Lanes;
+		VectorStore(MaskedLanes, &Lanes.X);
+		TMaskedStructLanes<StructType>::FromLanes(Lanes, InOutValue);
+	}
 
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedVector);
+	/** Applies the masked values of a batch of operations, each operation writes and notifies its own property. */
+	template<typename StructType>
+	void ApplyMaskedStructValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+	{
+		for (const TSharedRef<FRCMaskingOperation>& MaskingOperation : InMaskingOperations)
+		{
+			FStructProperty* ToStructProp = CastField<FStructProperty>(MaskingOperation->ObjectRef.Property.Get());
+			UObject* OwningObject = MaskingOperation->ObjectRef.Object.Get();
+			if (!ToStructProp || !OwningObject)
+			{
+				continue;
 			}
 
+			if (const StructType* StructProp = ToStructProp->ContainerPtrToValuePtr<StructType>(OwningObject))
+			{
+				StructType MaskedValue = *StructProp;
+				SelectMaskedLanes(*MaskingOperation, MaskedValue);
+
+#if WITH_EDITOR
+				OwningObject->PreEditChange(ToStructProp);
+				OwningObject->Modify();
+#endif // WITH_EDITOR
+
+				ToStructProp->SetValue_InContainer(OwningObject, &MaskedValue);
+
 #if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
+				FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
+				OwningObject->PostEditChangeProperty(ChangeEvent);
 #endif // WITH_EDITOR
+			}
 		}
 	}
-}
 
-void FVectorMaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
-{
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
+	/** Caches the values of a struct property before it gets masked. */
+	template<typename StructType>
+	void CacheRawStructValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
+		if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
 		{
-			if (const FVector* VectorProp = FromStructProp->ContainerPtrToValuePtr<FVector>(OwningObject))
+			if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
 			{
-				InMaskingOperation->PreMaskingCache.X = VectorProp->X;
-				InMaskingOperation->PreMaskingCache.Y = VectorProp->Y;
-				InMaskingOperation->PreMaskingCache.Z = VectorProp->Z;
+				if (const StructType* StructProp = FromStructProp->ContainerPtrToValuePtr<StructType>(OwningObject))
+				{
+					TMaskedStructLanes<StructType>::ToLanes(*StructProp, InMaskingOperation->PreMaskingCache);
+				}
 			}
 		}
 	}
 }
 
+/**
+ * FVectorMaskingFactory
+ */
+TSharedRef<IRemoteControlMaskingFactory> FVectorMaskingFactory::MakeInstance()
+{
+	return MakeShared<FVectorMaskingFactory>();
+}
+
+void FVectorMaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FVector>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
+
+void FVectorMaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FVector>(InMaskingOperations, bIsInteractive);
+}
+
+void FVectorMaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
+{
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FVector>(InMaskingOperation);
+}
+
 bool FVectorMaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
 {
 	return ScriptStruct == TBaseStructure<FVector>::Get();
@@ -71,50 +183,17 @@ TSharedRef<IRemoteControlMaskingFactory> FVector4MaskingFactory::MakeInstance()
 
 void FVector4MaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
-
-			if (const FVector4* Vector4Prop = ToStructProp->ContainerPtrToValuePtr<FVector4>(OwningObject))
-			{
-				FVector4 MaskedVector4;
-
-				MaskedVector4.X = InMaskingOperation->HasMask(ERCMask::MaskA) ? Vector4Prop->X : InMaskingOperation->PreMaskingCache.X;
-				MaskedVector4.Y = InMaskingOperation->HasMask(ERCMask::MaskB) ? Vector4Prop->Y : InMaskingOperation->PreMaskingCache.Y;
-				MaskedVector4.Z = InMaskingOperation->HasMask(ERCMask::MaskC) ? Vector4Prop->Z : InMaskingOperation->PreMaskingCache.Z;
-				MaskedVector4.W = InMaskingOperation->HasMask(ERCMask::MaskD) ? Vector4Prop->W : InMaskingOperation->PreMaskingCache.W;
-
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedVector4);
-			}
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FVector4>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
 
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
-#endif // WITH_EDITOR
-		}
-	}
+void FVector4MaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FVector4>(InMaskingOperations, bIsInteractive);
 }
 
 void FVector4MaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-			if (const FVector4* Vector4Prop = FromStructProp->ContainerPtrToValuePtr<FVector4>(OwningObject))
-			{
-				InMaskingOperation->PreMaskingCache.X = Vector4Prop->X;
-				InMaskingOperation->PreMaskingCache.Y = Vector4Prop->Y;
-				InMaskingOperation->PreMaskingCache.Z = Vector4Prop->Z;
-				InMaskingOperation->PreMaskingCache.W = Vector4Prop->W;
-			}
-		}
-	}
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FVector4>(InMaskingOperation);
 }
 
 bool FVector4MaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
@@ -132,48 +211,17 @@ TSharedRef<IRemoteControlMaskingFactory> FIntVectorMaskingFactory::MakeInstance(
 
 void FIntVectorMaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
-
-			if (const FIntVector* IntVectorProp = ToStructProp->ContainerPtrToValuePtr<FIntVector>(OwningObject))
-			{
-				FIntVector MaskedIntVector;
-
-				MaskedIntVector.X = InMaskingOperation->HasMask(ERCMask::MaskA) ? IntVectorProp->X : InMaskingOperation->PreMaskingCache.X;
-				MaskedIntVector.Y = InMaskingOperation->HasMask(ERCMask::MaskB) ? IntVectorProp->Y : InMaskingOperation->PreMaskingCache.Y;
-				MaskedIntVector.Z = InMaskingOperation->HasMask(ERCMask::MaskC) ? IntVectorProp->Z : InMaskingOperation->PreMaskingCache.Z;
-
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedIntVector);
-			}
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FIntVector>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
 
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
-#endif // WITH_EDITOR
-		}
-	}
+void FIntVectorMaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FIntVector>(InMaskingOperations, bIsInteractive);
 }
 
 void FIntVectorMaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-			if (const FIntVector* IntVectorProp = FromStructProp->ContainerPtrToValuePtr<FIntVector>(OwningObject))
-			{
-				InMaskingOperation->PreMaskingCache.X = IntVectorProp->X;
-				InMaskingOperation->PreMaskingCache.Y = IntVectorProp->Y;
-				InMaskingOperation->PreMaskingCache.Z = IntVectorProp->Z;
-			}
-		}
-	}
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FIntVector>(InMaskingOperation);
 }
 
 bool FIntVectorMaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
@@ -191,50 +239,17 @@ TSharedRef<IRemoteControlMaskingFactory> FIntVector4MaskingFactory::MakeInstance
 
 void FIntVector4MaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
-
-			if (const FIntVector4* IntVector4Prop = ToStructProp->ContainerPtrToValuePtr<FIntVector4>(OwningObject))
-			{
-				FIntVector4 MaskedIntVector4;
-
-				MaskedIntVector4.X = InMaskingOperation->HasMask(ERCMask::MaskA) ? IntVector4Prop->X : InMaskingOperation->PreMaskingCache.X;
-				MaskedIntVector4.Y = InMaskingOperation->HasMask(ERCMask::MaskB) ? IntVector4Prop->Y : InMaskingOperation->PreMaskingCache.Y;
-				MaskedIntVector4.Z = InMaskingOperation->HasMask(ERCMask::MaskC) ? IntVector4Prop->Z : InMaskingOperation->PreMaskingCache.Z;
-				MaskedIntVector4.W = InMaskingOperation->HasMask(ERCMask::MaskD) ? IntVector4Prop->W : InMaskingOperation->PreMaskingCache.W;
-
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedIntVector4);
-			}
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FIntVector4>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
 
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
-#endif // WITH_EDITOR
-		}
-	}
+void FIntVector4MaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FIntVector4>(InMaskingOperations, bIsInteractive);
 }
 
 void FIntVector4MaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-			if (const FIntVector4* IntVector4Prop = FromStructProp->ContainerPtrToValuePtr<FIntVector4>(OwningObject))
-			{
-				InMaskingOperation->PreMaskingCache.X = IntVector4Prop->X;
-				InMaskingOperation->PreMaskingCache.Y = IntVector4Prop->Y;
-				InMaskingOperation->PreMaskingCache.Z = IntVector4Prop->Z;
-				InMaskingOperation->PreMaskingCache.W = IntVector4Prop->W;
-			}
-		}
-	}
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FIntVector4>(InMaskingOperation);
 }
 
 bool FIntVector4MaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
@@ -252,48 +267,17 @@ TSharedRef<IRemoteControlMaskingFactory> FRotatorMaskingFactory::MakeInstance()
 
 void FRotatorMaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
-
-			if (const FRotator* RotatorProp = ToStructProp->ContainerPtrToValuePtr<FRotator>(OwningObject))
-			{
-				FRotator MaskedRotator;
-
-				MaskedRotator.Roll = InMaskingOperation->HasMask(ERCMask::MaskA) ? RotatorProp->Roll : InMaskingOperation->PreMaskingCache.X;
-				MaskedRotator.Pitch = InMaskingOperation->HasMask(ERCMask::MaskB) ? RotatorProp->Pitch : InMaskingOperation->PreMaskingCache.Y;
-				MaskedRotator.Yaw = InMaskingOperation->HasMask(ERCMask::MaskC) ? RotatorProp->Yaw : InMaskingOperation->PreMaskingCache.Z;
-
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedRotator);
-			}
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FRotator>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
 
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
-#endif // WITH_EDITOR
-		}
-	}
+void FRotatorMaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FRotator>(InMaskingOperations, bIsInteractive);
 }
 
 void FRotatorMaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-			if (const FRotator* RotatorProp = FromStructProp->ContainerPtrToValuePtr<FRotator>(OwningObject))
-			{
-				InMaskingOperation->PreMaskingCache.X = RotatorProp->Roll;
-				InMaskingOperation->PreMaskingCache.Y = RotatorProp->Pitch;
-				InMaskingOperation->PreMaskingCache.Z = RotatorProp->Yaw;
-			}
-		}
-	}
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FRotator>(InMaskingOperation);
 }
 
 bool FRotatorMaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
@@ -311,48 +295,17 @@ TSharedRef<IRemoteControlMaskingFactory> FColorMaskingFactory::MakeInstance()
 
 void FColorMaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
-
-			if (const FColor* ColorProp = ToStructProp->ContainerPtrToValuePtr<FColor>(OwningObject))
-			{
-				FColor MaskedColor;
-
-				MaskedColor.R = InMaskingOperation->HasMask(ERCMask::MaskA) ? ColorProp->R : InMaskingOperation->PreMaskingCache.X;
-				MaskedColor.G = InMaskingOperation->HasMask(ERCMask::MaskB) ? ColorProp->G : InMaskingOperation->PreMaskingCache.Y;
-				MaskedColor.B = InMaskingOperation->HasMask(ERCMask::MaskC) ? ColorProp->B : InMaskingOperation->PreMaskingCache.Z;
-
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedColor);
-			}
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FColor>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
 
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
-#endif // WITH_EDITOR
-		}
-	}
+void FColorMaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FColor>(InMaskingOperations, bIsInteractive);
 }
 
 void FColorMaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-			if (const FColor* ColorProp = FromStructProp->ContainerPtrToValuePtr<FColor>(OwningObject))
-			{
-				InMaskingOperation->PreMaskingCache.X = ColorProp->R;
-				InMaskingOperation->PreMaskingCache.Y = ColorProp->G;
-				InMaskingOperation->PreMaskingCache.Z = ColorProp->B;
-			}
-		}
-	}
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FColor>(InMaskingOperation);
 }
 
 bool FColorMaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
@@ -370,50 +323,17 @@ TSharedRef<IRemoteControlMaskingFactory> FLinearColorMaskingFactory::MakeInstanc
 
 void FLinearColorMaskingFactory::ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive)
 {
-	if (FStructProperty* ToStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-#if WITH_EDITOR
-			OwningObject->PreEditChange(ToStructProp);
-			OwningObject->Modify();
-#endif // WITH_EDITOR
-
-			if (const FLinearColor* LinearColorProp = ToStructProp->ContainerPtrToValuePtr<FLinearColor>(OwningObject))
-			{
-				FLinearColor MaskedLinearColor;
-
-				MaskedLinearColor.R = InMaskingOperation->HasMask(ERCMask::MaskA) ? LinearColorProp->R : InMaskingOperation->PreMaskingCache.X;
-				MaskedLinearColor.G = InMaskingOperation->HasMask(ERCMask::MaskB) ? LinearColorProp->G : InMaskingOperation->PreMaskingCache.Y;
-				MaskedLinearColor.B = InMaskingOperation->HasMask(ERCMask::MaskC) ? LinearColorProp->B : InMaskingOperation->PreMaskingCache.Z;
-				MaskedLinearColor.A = InMaskingOperation->HasMask(ERCMask::MaskD) ? LinearColorProp->A : InMaskingOperation->PreMaskingCache.W;
-
-				ToStructProp->SetValue_InContainer(OwningObject, &MaskedLinearColor);
-			}
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FLinearColor>(MakeArrayView(&InMaskingOperation, 1), bIsInteractive);
+}
 
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangeEvent(ToStructProp, bIsInteractive ? EPropertyChangeType::Interactive : EPropertyChangeType::ValueSet);
-			OwningObject->PostEditChangeProperty(ChangeEvent);
-#endif // WITH_EDITOR
-		}
-	}
+void FLinearColorMaskingFactory::ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+{
+	UE::RemoteControlMasking::Private::ApplyMaskedStructValues<FLinearColor>(InMaskingOperations, bIsInteractive);
 }
 
 void FLinearColorMaskingFactory::CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	if (const FStructProperty* FromStructProp = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		if (const UObject* OwningObject = InMaskingOperation->ObjectRef.Object.Get())
-		{
-			if (const FLinearColor* LinearColorProp = FromStructProp->ContainerPtrToValuePtr<FLinearColor>(OwningObject))
-			{
-				InMaskingOperation->PreMaskingCache.X = LinearColorProp->R;
-				InMaskingOperation->PreMaskingCache.Y = LinearColorProp->G;
-				InMaskingOperation->PreMaskingCache.Z = LinearColorProp->B;
-				InMaskingOperation->PreMaskingCache.W = LinearColorProp->A;
-			}
-		}
-	}
+	UE::RemoteControlMasking::Private::CacheRawStructValues<FLinearColor>(InMaskingOperation);
 }
 
 bool FLinearColorMaskingFactory::SupportsExposedEntity(UScriptStruct* ScriptStruct) const
@@ -12,6 +12,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -24,6 +25,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -36,6 +38,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -48,6 +51,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -60,6 +64,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -72,6 +77,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -84,6 +90,7 @@ public:
 
 	//~ Begin IRemoteControlMaskingFactory interface
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) override;
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive) override;
 	virtual void CacheRawValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
 	virtual bool SupportsExposedEntity(UScriptStruct* ScriptStruct) const override;
 	//~ End IRemoteControlMaskingFactory interface
@@ -164,6 +164,7 @@ bool URCVirtualPropertyBase::DeserializeFromBackend(IStructDeserializerBackend&
 
 	if (bSuccess)
 	{
+		NotifyValueChanged();
 		OnModifyPropertyValue();
 	}
 
@@ -369,6 +370,7 @@ struct FRCVirtualPropertyCastHelpers
 		if (const TPropertyType* CastProperty = CastField<TPropertyType>(Property))
 		{
 			CastProperty->SetPropertyValue(ValuePtr, InValue);
+			InVirtualProperty->NotifyValueChanged();
 			return true;
 		}
 
@@ -412,6 +414,7 @@ struct FRCVirtualPropertyCastHelpers
 			if (InScriptStruct == StructProperty->Struct)
 			{
 				StructProperty->Struct->CopyScriptStruct(ValuePtr, &InValue);
+				InVirtualProperty->NotifyValueChanged();
 				return true;
 			}
 		}
@@ -440,6 +443,7 @@ struct FRCVirtualPropertyCastHelpers
 		if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
 		{			
 			ObjectProperty->SetObjectPropertyValue(InVirtualProperty->GetContainerPtr(), InValue);
+			InVirtualProperty->NotifyValueChanged();
 			return true;
 		}
 
@@ -757,6 +761,7 @@ bool URCVirtualPropertyBase::SetValueNumericInteger(const int64 InInt64Value)
 		if (NumericProperty->IsInteger())
 		{
 			NumericProperty->SetIntPropertyValue(ValuePtr, InInt64Value);
+			NotifyValueChanged();
 		}
 	}
 
@@ -833,6 +838,11 @@ void URCVirtualPropertyBase::SetDisplayIndex(const int32 InDisplayIndex)
 	DisplayIndex = InDisplayIndex;
 }
 
+void URCVirtualPropertyBase::NotifyValueChanged()
+{
+	ValueChangedDelegate.Broadcast();
+}
+
 const FInstancedPropertyBag* URCVirtualPropertyInContainer::GetPropertyBagInstance() const
 {
 	if (ContainerWeakPtr.Get())
@@ -880,9 +890,10 @@ bool URCVirtualPropertySelfContainer::DuplicatePropertyWithCopy(const FName& InP
 		return false;
 	}
 	
-	if (InSourceContainerPtr)
+	if (InSourceContainerPtr && Bag.SetValue(PropertyName, InSourceProperty, InSourceContainerPtr) == EPropertyBagResult::Success)
 	{
-		return Bag.SetValue(PropertyName, InSourceProperty, InSourceContainerPtr) == EPropertyBagResult::Success;	
+		NotifyValueChanged();
+		return true;
 	}
 	return false;
 }
@@ -894,9 +905,10 @@ bool URCVirtualPropertySelfContainer::DuplicatePropertyWithCopy(URCVirtualProper
 		return false;
 	}
 	
-	if (InVirtualProperty->GetContainerPtr())
+	if (InVirtualProperty->GetContainerPtr() && Bag.SetValue(PropertyName, InVirtualProperty->GetProperty(), InVirtualProperty->GetContainerPtr()) == EPropertyBagResult::Success)
 	{
-		return Bag.SetValue(PropertyName, InVirtualProperty->GetProperty(), InVirtualProperty->GetContainerPtr()) == EPropertyBagResult::Success;	
+		NotifyValueChanged();
+		return true;
 	}
 
 	return false;
@@ -905,14 +917,21 @@ bool URCVirtualPropertySelfContainer::DuplicatePropertyWithCopy(URCVirtualProper
 bool URCVirtualPropertySelfContainer::UpdateValueWithProperty(const FProperty* InProperty, const void* InPropertyContainer)
 {
 	const EPropertyBagResult Result = Bag.SetValue(PropertyName, InProperty, InPropertyContainer);
-	return Result == EPropertyBagResult::Success;
+	if (Result != EPropertyBagResult::Success)
+	{
+		return false;
+	}
+
+	NotifyValueChanged();
+	return true;
 }
 
 bool URCVirtualPropertySelfContainer::UpdateValueWithProperty(const URCVirtualPropertyBase* InVirtualProperty)
 {
-	if (InVirtualProperty && InVirtualProperty->GetContainerPtr())
+	if (InVirtualProperty && InVirtualProperty->GetContainerPtr() && Bag.SetValue(PropertyName, InVirtualProperty->GetProperty(), InVirtualProperty->GetContainerPtr()) == EPropertyBagResult::Success)
 	{
-		return Bag.SetValue(PropertyName, InVirtualProperty->GetProperty(), InVirtualProperty->GetContainerPtr()) == EPropertyBagResult::Success;	
+		NotifyValueChanged();
+		return true;
 	}
 
 	return false;
@@ -924,6 +943,7 @@ void URCVirtualPropertySelfContainer::Reset()
 	FieldId = NAME_None;
 	Id = FGuid();
 	Bag.Reset();
+	NotifyValueChanged();
 }
 
 const FInstancedPropertyBag* URCVirtualPropertySelfContainer::GetPropertyBagInstance() const
@@ -931,6 +951,15 @@ const FInstancedPropertyBag* URCVirtualPropertySelfContainer::GetPropertyBagInst
 	return &Bag;
 }
 
+#if WITH_EDITOR
+void URCVirtualPropertySelfContainer::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	NotifyValueChanged();
+}
+#endif
+
 TSharedPtr<FStructOnScope> URCVirtualPropertySelfContainer::CreateStructOnScope()
 {
 	TSharedRef<FStructOnScope> StructOnScope = MakeShared<FStructOnScope>(Bag.GetPropertyBagStruct(), Bag.GetMutableValue().GetMemory());
@@ -4,6 +4,7 @@
 
 #include "Algo/Transform.h"
 #include "RemoteControlBinding.h"
+#include "RemoteControlExposeRegistry.h"
 #include "RemoteControlPreset.h"
 
 TArray<UObject*> FRemoteControlEntity::GetBoundObjects() const
@@ -81,6 +82,11 @@ void FRemoteControlEntity::BindObject(UObject* InObjectToBind)
 
 	}
 
+	if (Owner->Registry)
+	{
+		Owner->Registry->UpdateEntityBindings(Id);
+	}
+
 	// The order of this delegate needs to be this way
 	// The first will update the Entity widget with the new data
 	// The second one will refresh the List
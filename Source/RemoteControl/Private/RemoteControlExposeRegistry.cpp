@@ -2,10 +2,67 @@
 
 #include "RemoteControlExposeRegistry.h"
 #include "Misc/Guid.h"
+#include "RemoteControlBinding.h"
 #include "Serialization/Archive.h"
 #include "UObject/Class.h"
 #include "UObject/SoftObjectPath.h"
 #include "HAL/UnrealMemory.h"
+#include "Misc/StringBuilder.h"
+
+namespace RemoteControlExposeRegistry
+{
+	/** Format a label generated from a base label, ie. "Label (2)". */
+	FName MakeLabel(FName BaseLabel, int32 Suffix)
+	{
+		TStringBuilder<128> Builder;
+		Builder << BaseLabel << TEXT(" (") << Suffix << TEXT(')');
+		return FName(Builder.ToView());
+	}
+
+	/**
+	 * Split a label in the form generated by MakeLabel into its base label and suffix.
+	 * @return false if the label doesn't have a suffix.
+	 */
+	bool SplitLabel(FName Label, FName& OutBaseLabel, int32& OutSuffix)
+	{
+		TStringBuilder<128> Builder;
+		Builder << Label;
+		const FStringView LabelView = Builder.ToView();
+
+		if (!LabelView.EndsWith(TEXT(')')))
+		{
+			return false;
+		}
+
+		int32 OpeningIndex = INDEX_NONE;
+		if (!LabelView.FindLastChar(TEXT('('), OpeningIndex) || OpeningIndex < 2 || LabelView[OpeningIndex - 1] != TEXT(' '))
+		{
+			return false;
+		}
+
+		// Only accept the digits MakeLabel would have generated, so the split label can be formatted back to the same label.
+		const FStringView Digits = LabelView.Mid(OpeningIndex + 1, LabelView.Len() - OpeningIndex - 2);
+		if (Digits.IsEmpty() || Digits.Len() > 9 || Digits[0] == TEXT('0'))
+		{
+			return false;
+		}
+
+		int32 Suffix = 0;
+		for (const TCHAR Digit : Digits)
+		{
+			if (!FChar::IsDigit(Digit))
+			{
+				return false;
+			}
+
+			Suffix = Suffix * 10 + (Digit - TEXT('0'));
+		}
+
+		OutBaseLabel = FName(LabelView.Left(OpeningIndex - 1));
+		OutSuffix = Suffix;
+		return true;
+	}
+}
 
 TArray<TSharedPtr<const FRemoteControlEntity>> URemoteControlExposeRegistry::GetExposedEntities() const
 {
@@ -28,14 +85,13 @@ TArray<TSharedPtr<const FRemoteControlEntity>> URemoteControlExposeRegistry::Get
 {
 	check(EntityType->IsChildOf(FRemoteControlEntity::StaticStruct()));
 	TArray<TSharedPtr<const FRemoteControlEntity>> Entities;
+	Entities.Reserve(GetNumExposedEntities(EntityType));
 
-	for (const FRCEntityWrapper& Wrapper : ExposedEntities)
+	ForEachExposedEntity(EntityType, [&Entities](const TSharedPtr<FRemoteControlEntity>& Entity)
 	{
-		if (Wrapper.IsValid() && Wrapper.GetType()->IsChildOf(EntityType))
-		{
-			Entities.Add(Wrapper.Get());
-		}
-	}
+		Entities.Add(Entity);
+		return true;
+	});
 
 	return Entities;
 }
@@ -44,16 +100,66 @@ TArray<TSharedPtr<FRemoteControlEntity>> URemoteControlExposeRegistry::GetExpose
 {
 	check(EntityType->IsChildOf(FRemoteControlEntity::StaticStruct()));
 	TArray<TSharedPtr<FRemoteControlEntity>> Entities;
+	Entities.Reserve(GetNumExposedEntities(EntityType));
 
-	for (FRCEntityWrapper& Wrapper : ExposedEntities)
+	ForEachExposedEntity(EntityType, [&Entities](const TSharedPtr<FRemoteControlEntity>& Entity)
 	{
-		if (Wrapper.IsValid() && Wrapper.GetType()->IsChildOf(EntityType))
+		Entities.Add(Entity);
+		return true;
+	});
+
+	return Entities;
+}
+
+void URemoteControlExposeRegistry::ForEachExposedEntity(const UScriptStruct* EntityType, TFunctionRef<bool(const TSharedPtr<FRemoteControlEntity>&)> Callback) const
+{
+	// Only a handful of entity types exist, so matching the buckets is cheap compared to checking every entity.
+	for (const TPair<const UScriptStruct*, TArray<TSharedPtr<FRemoteControlEntity>>>& Bucket : EntitiesByType)
+	{
+		if (Bucket.Key->IsChildOf(EntityType))
 		{
-			Entities.Add(Wrapper.Get());
+			for (const TSharedPtr<FRemoteControlEntity>& Entity : Bucket.Value)
+			{
+				if (!Callback(Entity))
+				{
+					return;
+				}
+			}
 		}
 	}
+}
 
-	return Entities;
+int32 URemoteControlExposeRegistry::GetNumExposedEntities(const UScriptStruct* EntityType) const
+{
+	int32 NumEntities = 0;
+	for (const TPair<const UScriptStruct*, TArray<TSharedPtr<FRemoteControlEntity>>>& Bucket : EntitiesByType)
+	{
+		if (Bucket.Key->IsChildOf(EntityType))
+		{
+			NumEntities += Bucket.Value.Num();
+		}
+	}
+
+	return NumEntities;
+}
+
+TConstArrayView<FGuid> URemoteControlExposeRegistry::GetEntitiesUsingBinding(const URemoteControlBinding* Binding) const
+{
+	if (const TArray<FGuid>* EntityIds = BindingToEntityIds.Find(FObjectKey(Binding)))
+	{
+		return *EntityIds;
+	}
+
+	return {};
+}
+
+void URemoteControlExposeRegistry::UpdateEntityBindings(const FGuid& Id)
+{
+	if (TSharedPtr<const FRemoteControlEntity> Entity = GetEntity(Id))
+	{
+		UnindexBindings(Id);
+		IndexBindings(*Entity);
+	}
 }
 
 TSharedPtr<const FRemoteControlEntity> URemoteControlExposeRegistry::GetExposedEntity(const FGuid& ExposedEntityId, const UScriptStruct* EntityType) const
@@ -91,11 +197,12 @@ const bool URemoteControlExposeRegistry::IsEmpty() const
 
 TSharedPtr<FRemoteControlEntity> URemoteControlExposeRegistry::AddExposedEntity(FRemoteControlEntity&& EntityToExpose, UScriptStruct* EntityType)
 {
-	LabelToIdCache.Add(EntityToExpose.GetLabel(), EntityToExpose.GetId());
+	AddLabel(EntityToExpose.GetLabel(), EntityToExpose.GetId());
 	FRCEntityWrapper Wrapper{ MoveTemp(EntityToExpose), EntityType};
 	TSharedPtr<FRemoteControlEntity> Entity = Wrapper.Get();
 	ExposedEntities.Add(MoveTemp(Wrapper));
 	ExposedTypes.Add(EntityType);
+	AddToIndices(Entity, EntityType);
 	return Entity;
 }
 
@@ -104,9 +211,10 @@ void URemoteControlExposeRegistry::RemoveExposedEntity(const FGuid& Id)
 	uint32 Hash = GetTypeHash(Id);
 	if (const FRCEntityWrapper* Wrapper = ExposedEntities.FindByHash(Hash, Id))
 	{
-		if (TSharedPtr<const FRemoteControlEntity> Entity = Wrapper->Get())
+		if (TSharedPtr<FRemoteControlEntity> Entity = ConstCastSharedPtr<FRemoteControlEntity>(Wrapper->Get()))
 		{
-			LabelToIdCache.Remove(Entity->GetLabel());
+			RemoveLabel(Entity->GetLabel());
+			RemoveFromIndices(Entity, Wrapper->GetType());
 		}
 		ExposedEntities.RemoveByHash(Hash, Id);
 	}
@@ -116,9 +224,9 @@ FName URemoteControlExposeRegistry::RenameExposedEntity(const FGuid& Id, FName N
 {
 	if (TSharedPtr<FRemoteControlEntity> Entity = GetEntity(Id))
 	{
-		LabelToIdCache.Remove(Entity->GetLabel());
+		RemoveLabel(Entity->GetLabel());
 		Entity->Label = GenerateUniqueLabel(NewLabel);
-		LabelToIdCache.Add(Entity->GetLabel(), Id);
+		AddLabel(Entity->GetLabel(), Id);
 		return Entity->GetLabel();
 	}
 	return NAME_None;
@@ -141,33 +249,38 @@ FName URemoteControlExposeRegistry::GenerateUniqueLabel(FName BaseName) const
 		return BaseName;
 	}
 
-	// Then try the field name with a suffix
-	for (uint32 Index = 1; Index < 1000; ++Index)
+	// Then reuse the smallest freed suffix, or the next one
+	int32 Suffix = 1;
+	if (const FLabelSuffixes* Suffixes = LabelSuffixes.Find(BaseName))
 	{
-		const FName Candidate = FName(*FString::Printf(TEXT("%s (%d)"), *BaseName.ToString(), Index));
-		if (!LabelToIdCache.Contains(Candidate))
-		{
-			return Candidate;
-		}
+		Suffix = Suffixes->FreeSuffixes.Num() ? Suffixes->FreeSuffixes.HeapTop() : Suffixes->NextSuffix;
 	}
 
-	// Something went wrong if we end up here.
-	checkNoEntry();
-	return NAME_None;
+	const FName Candidate = RemoteControlExposeRegistry::MakeLabel(BaseName, Suffix);
+	checkSlow(!LabelToIdCache.Contains(Candidate));
+	return Candidate;
 }
 
 void URemoteControlExposeRegistry::PostLoad()
 {
 	Super::PostLoad();
-	CacheLabels();
+	CacheIndices();
 }
 
 void URemoteControlExposeRegistry::PostDuplicate(bool bDuplicateForPIE)
 {
 	UObject::PostDuplicate(bDuplicateForPIE);
-	CacheLabels();
+	CacheIndices();
 }
 
+#if WITH_EDITOR
+void URemoteControlExposeRegistry::PostEditUndo()
+{
+	Super::PostEditUndo();
+	CacheIndices();
+}
+#endif
+
 void URemoteControlExposeRegistry::Rehash()
 {
 	TSet<FRCEntityWrapper> RehashedEntities;
@@ -180,7 +293,7 @@ void URemoteControlExposeRegistry::Rehash()
 	
 	ExposedEntities = MoveTemp(RehashedEntities);
 
-	CacheLabels();
+	CacheIndices();
 }
 
 TSharedPtr<FRemoteControlEntity> URemoteControlExposeRegistry::GetEntity(const FGuid& EntityId)
@@ -199,14 +312,136 @@ TSharedPtr<const FRemoteControlEntity> URemoteControlExposeRegistry::GetEntity(c
 	return const_cast<URemoteControlExposeRegistry*>(this)->GetEntity(EntityId);
 }
 
-void URemoteControlExposeRegistry::CacheLabels()
+void URemoteControlExposeRegistry::CacheIndices()
 {
 	LabelToIdCache.Reset();
-	for (const FRCEntityWrapper& Wrapper : ExposedEntities)
+	LabelSuffixes.Reset();
+	EntitiesByType.Reset();
+	BindingToEntityIds.Reset();
+	EntityIdToBindings.Reset();
+
+	for (FRCEntityWrapper& Wrapper : ExposedEntities)
 	{
-		if (TSharedPtr<const FRemoteControlEntity> Entity = Wrapper.Get())
+		if (TSharedPtr<FRemoteControlEntity> Entity = Wrapper.Get())
 		{
-			LabelToIdCache.Add(Entity->GetLabel(), Entity->GetId());
+			AddLabel(Entity->GetLabel(), Entity->GetId());
+
+			if (Wrapper.IsValid())
+			{
+				AddToIndices(Entity, Wrapper.GetType());
+			}
+		}
+	}
+}
+
+void URemoteControlExposeRegistry::AddLabel(FName Label, const FGuid& Id)
+{
+	const bool bAlreadyCached = LabelToIdCache.Contains(Label);
+	LabelToIdCache.Add(Label, Id);
+
+	FName BaseLabel;
+	int32 Suffix = 0;
+	if (bAlreadyCached || !RemoteControlExposeRegistry::SplitLabel(Label, BaseLabel, Suffix))
+	{
+		return;
+	}
+
+	FLabelSuffixes& Suffixes = LabelSuffixes.FindOrAdd(BaseLabel);
+	if (Suffix == Suffixes.NextSuffix)
+	{
+		// Skip over the suffixes that were taken out of order, ie. by renaming an entity to "Label (3)".
+		do
+		{
+			++Suffixes.NextSuffix;
+		}
+		while (LabelToIdCache.Contains(RemoteControlExposeRegistry::MakeLabel(BaseLabel, Suffixes.NextSuffix)));
+	}
+	else if (Suffix < Suffixes.NextSuffix)
+	{
+		// Usually the suffix that was just generated, at the top of the heap.
+		if (Suffixes.FreeSuffixes.Num() && Suffixes.FreeSuffixes.HeapTop() == Suffix)
+		{
+			Suffixes.FreeSuffixes.HeapPopDiscard(EAllowShrinking::No);
+		}
+		else if (Suffixes.FreeSuffixes.RemoveSingle(Suffix))
+		{
+			Suffixes.FreeSuffixes.Heapify();
+		}
+	}
+}
+
+void URemoteControlExposeRegistry::RemoveLabel(FName Label)
+{
+	if (!LabelToIdCache.Remove(Label))
+	{
+		return;
+	}
+
+	FName BaseLabel;
+	int32 Suffix = 0;
+	if (RemoteControlExposeRegistry::SplitLabel(Label, BaseLabel, Suffix))
+	{
+		if (FLabelSuffixes* Suffixes = LabelSuffixes.Find(BaseLabel))
+		{
+			if (Suffix < Suffixes->NextSuffix)
+			{
+				Suffixes->FreeSuffixes.HeapPush(Suffix);
+			}
+		}
+	}
+}
+
+void URemoteControlExposeRegistry::AddToIndices(const TSharedPtr<FRemoteControlEntity>& Entity, const UScriptStruct* EntityType)
+{
+	EntitiesByType.FindOrAdd(EntityType).Add(Entity);
+	IndexBindings(*Entity);
+}
+
+void URemoteControlExposeRegistry::RemoveFromIndices(const TSharedPtr<FRemoteControlEntity>& Entity, const UScriptStruct* EntityType)
+{
+	if (TArray<TSharedPtr<FRemoteControlEntity>>* Bucket = EntitiesByType.Find(EntityType))
+	{
+		Bucket->RemoveSingle(Entity);
+		if (Bucket->IsEmpty())
+		{
+			EntitiesByType.Remove(EntityType);
+		}
+	}
+
+	UnindexBindings(Entity->GetId());
+}
+
+void URemoteControlExposeRegistry::IndexBindings(const FRemoteControlEntity& Entity)
+{
+	TArray<FObjectKey>& IndexedBindings = EntityIdToBindings.FindOrAdd(Entity.GetId());
+	for (const TWeakObjectPtr<URemoteControlBinding>& Binding : Entity.GetBindings())
+	{
+		if (const URemoteControlBinding* BindingObject = Binding.Get())
+		{
+			const FObjectKey BindingKey{ BindingObject };
+			BindingToEntityIds.FindOrAdd(BindingKey).AddUnique(Entity.GetId());
+			IndexedBindings.AddUnique(BindingKey);
+		}
+	}
+}
+
+void URemoteControlExposeRegistry::UnindexBindings(const FGuid& Id)
+{
+	TArray<FObjectKey> IndexedBindings;
+	if (!EntityIdToBindings.RemoveAndCopyValue(Id, IndexedBindings))
+	{
+		return;
+	}
+
+	for (const FObjectKey& BindingKey : IndexedBindings)
+	{
+		if (TArray<FGuid>* EntityIds = BindingToEntityIds.Find(BindingKey))
+		{
+			EntityIds->RemoveSingle(Id);
+			if (EntityIds->IsEmpty())
+			{
+				BindingToEntityIds.Remove(BindingKey);
+			}
 		}
 	}
 }
@@ -7,10 +7,12 @@
 #include "UObject/Class.h"
 #include "Templates/SharedPointer.h"
 #include "Templates/UnrealTypeTraits.h"
+#include "UObject/ObjectKey.h"
 
 #include "RemoteControlExposeRegistry.generated.h"
 
 class FArchive;
+class URemoteControlBinding;
 struct FGuid;
 
 /** Wrapper class used to serialize exposable entities in a generic way. */
@@ -102,6 +104,45 @@ public:
 		return const_cast<URemoteControlExposeRegistry*>(this)->GetExposedEntities<EntityType>();
 	}
 
+	/**
+	 * Call a function on each exposed entity of a certain type without copying them.
+	 * Entities must not be exposed or unexposed from the callback.
+	 * @param EntityType The type of the entities to iterate, entities of derived types are included.
+	 * @param Callback Called for each entity, return false to stop iterating.
+	 */
+	void ForEachExposedEntity(const UScriptStruct* EntityType, TFunctionRef<bool(const TSharedPtr<FRemoteControlEntity>&)> Callback) const;
+
+	/**
+	 * Call a function on each exposed entity of a certain type without copying them.
+	 * @param Callback Called for each entity, return false to stop iterating.
+	 */
+	template <typename EntityType>
+	void ForEachExposedEntity(TFunctionRef<bool(const TSharedPtr<EntityType>&)> Callback) const
+	{
+		static_assert(TIsDerivedFrom<EntityType, FRemoteControlEntity>::Value, "EntityType must derive from FRemoteControlEntity.");
+		ForEachExposedEntity(EntityType::StaticStruct(), [&Callback](const TSharedPtr<FRemoteControlEntity>& Entity)
+		{
+			return Callback(StaticCastSharedPtr<EntityType>(Entity));
+		});
+	}
+
+	/**
+	 * Get the number of exposed entities of a certain type.
+	 * @param EntityType The type of the entities to count, entities of derived types are included.
+	 */
+	int32 GetNumExposedEntities(const UScriptStruct* EntityType) const;
+
+	/**
+	 * Get the ids of the exposed entities using a binding.
+	 * The view is invalidated when an entity is exposed, unexposed or rebound.
+	 */
+	TConstArrayView<FGuid> GetEntitiesUsingBinding(const URemoteControlBinding* Binding) const;
+
+	/**
+	 * Update the binding index after the bindings of an exposed entity were modified.
+	 */
+	void UpdateEntityBindings(const FGuid& Id);
+
 	/**
 	 * Get an exposed entity from the registry.
 	 * @param ExposedEntityId the id of the entity to get.
@@ -199,6 +240,10 @@ public:
 
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 
+#if WITH_EDITOR
+	virtual void PostEditUndo() override;
+#endif
+
 	/**
 	 * @brief Rehash the entities after ids have been modified.
 	 */
@@ -211,8 +256,26 @@ private:
 	/** Get a raw pointer to an entity using its id. */
 	TSharedPtr<const FRemoteControlEntity> GetEntity(const FGuid& EntityId) const;
 
-	/** Cache labels for all expose sets. */
-	void CacheLabels();
+	/** Rebuild the label cache and the type and binding indices from the exposed entities. */
+	void CacheIndices();
+
+	/** Add an entity to the type and binding indices. */
+	void AddToIndices(const TSharedPtr<FRemoteControlEntity>& Entity, const UScriptStruct* EntityType);
+
+	/** Remove an entity from the type and binding indices. */
+	void RemoveFromIndices(const TSharedPtr<FRemoteControlEntity>& Entity, const UScriptStruct* EntityType);
+
+	/** Add a label to the label cache and the suffix index. */
+	void AddLabel(FName Label, const FGuid& Id);
+
+	/** Remove a label from the label cache and the suffix index. */
+	void RemoveLabel(FName Label);
+
+	/** Add an entity's bindings to the binding index. */
+	void IndexBindings(const FRemoteControlEntity& Entity);
+
+	/** Remove an entity's indexed bindings from the binding index. */
+	void UnindexBindings(const FGuid& Id);
 
 private:
 	/** Holds the exposed entities. */
@@ -223,7 +286,30 @@ private:
 	UPROPERTY(Transient)
 	TMap<FName, FGuid> LabelToIdCache;
 
+	/**
+	 * Suffixes available for the labels generated from a base label, ie. "Label (2)".
+	 * Every suffix below NextSuffix is either used or in FreeSuffixes, and the label using NextSuffix is never taken.
+	 */
+	struct FLabelSuffixes
+	{
+		int32 NextSuffix = 1;
+		/** Min-heap of the suffixes freed by unexposing or renaming entities. */
+		TArray<int32> FreeSuffixes;
+	};
+
+	/** Suffix index of the labels, by base label. */
+	TMap<FName, FLabelSuffixes> LabelSuffixes;
+
 	/** Holds the types of entities exposed in the registry. */
 	UPROPERTY()
 	TSet<TObjectPtr<UScriptStruct>> ExposedTypes;
+
+	/** Exposed entities grouped by their exact type, in the order they were exposed. */
+	TMap<const UScriptStruct*, TArray<TSharedPtr<FRemoteControlEntity>>> EntitiesByType;
+
+	/** Ids of the entities using each binding. */
+	TMap<FObjectKey, TArray<FGuid>> BindingToEntityIds;
+
+	/** Bindings each entity was indexed with, so they can be unindexed after the entity's bindings change. */
+	TMap<FGuid, TArray<FObjectKey>> EntityIdToBindings;
 };
@@ -5,7 +5,7 @@
 #include "IRemoteControlModule.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "RemoteControlPreset.h"
-#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
 
 #if WITH_EDITOR
 #include "MaterialEditor/DEditorFontParameterValue.h"
@@ -125,13 +125,19 @@ public:
 		return bReplaced;
 		}
 
+	/** Find a parameter value by name, checking the cached index first and updating it otherwise */
 	template<typename ParameterType>
-	static const ParameterType* FindParameterValue(const TArray<ParameterType>& Parameters, const FName& InName)
+	static const ParameterType* FindParameterValue(const TArray<ParameterType>& Parameters, const FName& InName, int32& InOutCachedIndex)
 	{
-		return Parameters.FindByPredicate([&InName](const ParameterType& InValue)
+		if (!Parameters.IsValidIndex(InOutCachedIndex) || Parameters[InOutCachedIndex].ParameterInfo.Name != InName)
 		{
-			return InValue.ParameterInfo.Name == InName;
-		});
+			InOutCachedIndex = Parameters.IndexOfByPredicate([&InName](const ParameterType& InValue)
+			{
+				return InValue.ParameterInfo.Name == InName;
+			});
+		}
+
+		return Parameters.IsValidIndex(InOutCachedIndex) ? &Parameters[InOutCachedIndex] : nullptr;
 	}
 };
 
@@ -163,34 +169,7 @@ void FRemoteControlInstanceMaterial::OnObjectPropertyChanged(UObject* InObject,
 		return;
 	}
 
-	UDEditorParameterValue* DEditorParameterValue = [InputMaterialInstance, this]()
-	{
-		UDEditorParameterValue* ReturnParameterValue = nullptr;
-		
-		for (TObjectIterator<UDEditorParameterValue> It; It; ++It)
-		{
-			UDEditorParameterValue* ParameterValue = *It;
-			if (!ParameterValue || !ParameterValue->IsValidLowLevelFast())
-			{
-				continue;
-			}
-
-			if (ParameterValue->ParameterInfo.Name != ParameterInfo.Name)
-			{
-				continue;
-			}
-
-			if(UMaterialEditorInstanceConstant* MaterialEditorInstanceConstant = Cast<UMaterialEditorInstanceConstant>(ParameterValue->GetOuter()))
-			{
-				if (MaterialEditorInstanceConstant->SourceInstance == InputMaterialInstance)
-				{
-					ReturnParameterValue = ParameterValue;
-				}
-			}
-		}
-
-		return ReturnParameterValue;
-	}();
+	UDEditorParameterValue* DEditorParameterValue = FindEditorParameterValue(InputMaterialInstance);
 
 	if (!DEditorParameterValue)
 	{
@@ -201,7 +180,7 @@ void FRemoteControlInstanceMaterial::OnObjectPropertyChanged(UObject* InObject,
 
 	if (UDEditorScalarParameterValue* ScalarParameterValue = Cast<UDEditorScalarParameterValue>(DEditorParameterValue))
 	{
-		const FScalarParameterValue* FoundScalarParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->ScalarParameterValues, EditorValueParameterName);
+		const FScalarParameterValue* FoundScalarParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->ScalarParameterValues, EditorValueParameterName, CachedParameterValueIndex);
 
 		if (FoundScalarParameterValue)
 		{
@@ -213,7 +192,7 @@ void FRemoteControlInstanceMaterial::OnObjectPropertyChanged(UObject* InObject,
 	}
 	else if (UDEditorVectorParameterValue* VectorParameterValue = Cast<UDEditorVectorParameterValue>(DEditorParameterValue))
 	{
-		const FVectorParameterValue* FoundVectorParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->VectorParameterValues, EditorValueParameterName);
+		const FVectorParameterValue* FoundVectorParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->VectorParameterValues, EditorValueParameterName, CachedParameterValueIndex);
 
 		if (FoundVectorParameterValue)
 		{
@@ -225,7 +204,7 @@ void FRemoteControlInstanceMaterial::OnObjectPropertyChanged(UObject* InObject,
 	}
 	else if (UDEditorTextureParameterValue* TextureParameterValue = Cast<UDEditorTextureParameterValue>(DEditorParameterValue))
 	{
-		const FTextureParameterValue* FoundTextureParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->TextureParameterValues, EditorValueParameterName);
+		const FTextureParameterValue* FoundTextureParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->TextureParameterValues, EditorValueParameterName, CachedParameterValueIndex);
 
 		if (FoundTextureParameterValue)
 		{
@@ -237,7 +216,7 @@ void FRemoteControlInstanceMaterial::OnObjectPropertyChanged(UObject* InObject,
 	}
 	else if (UDEditorFontParameterValue* FontParameterValue = Cast<UDEditorFontParameterValue>(DEditorParameterValue))
 	{
-		const FFontParameterValue* FoundFontParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->FontParameterValues, EditorValueParameterName);
+		const FFontParameterValue* FoundFontParameterValue = FMaterialHelper::FindParameterValue(MaterialInstance->FontParameterValues, EditorValueParameterName, CachedParameterValueIndex);
 
 		if (FoundFontParameterValue)
 		{
@@ -249,11 +228,70 @@ void FRemoteControlInstanceMaterial::OnObjectPropertyChanged(UObject* InObject,
 		}
 	}
 }
+
+UDEditorParameterValue* FRemoteControlInstanceMaterial::FindEditorParameterValue(UMaterialInstance* InMaterialInstance)
+{
+	// Check the slot the parameter was last found in, it only moves when the editor regenerates its parameters
+	if (const UMaterialEditorInstanceConstant* EditorInstance = CachedEditorInstance.Get())
+	{
+		if (EditorInstance->SourceInstance == InMaterialInstance
+			&& EditorInstance->ParameterGroups.IsValidIndex(CachedGroupIndex)
+			&& EditorInstance->ParameterGroups[CachedGroupIndex].Parameters.IsValidIndex(CachedEditorParameterIndex))
+		{
+			UDEditorParameterValue* ParameterValue = EditorInstance->ParameterGroups[CachedGroupIndex].Parameters[CachedEditorParameterIndex];
+			if (ParameterValue && ParameterValue->ParameterInfo.Name == ParameterInfo.Name)
+			{
+				return ParameterValue;
+			}
+		}
+	}
+
+	CachedEditorInstance.Reset();
+	CachedGroupIndex = INDEX_NONE;
+	CachedEditorParameterIndex = INDEX_NONE;
+
+	// Only look through the material instance editors rather than every editor parameter value in memory
+	UDEditorParameterValue* ReturnParameterValue = nullptr;
+
+	TArray<UObject*> EditorInstances;
+	GetObjectsOfClass(UMaterialEditorInstanceConstant::StaticClass(), EditorInstances);
+
+	for (UObject* Object : EditorInstances)
+	{
+		UMaterialEditorInstanceConstant* EditorInstance = CastChecked<UMaterialEditorInstanceConstant>(Object);
+		if (EditorInstance->SourceInstance != InMaterialInstance)
+		{
+			continue;
+		}
+
+		for (int32 GroupIndex = 0; GroupIndex < EditorInstance->ParameterGroups.Num(); ++GroupIndex)
+		{
+			const TArray<TObjectPtr<UDEditorParameterValue>>& Parameters = EditorInstance->ParameterGroups[GroupIndex].Parameters;
+			for (int32 ParameterIndex = 0; ParameterIndex < Parameters.Num(); ++ParameterIndex)
+			{
+				if (Parameters[ParameterIndex] && Parameters[ParameterIndex]->ParameterInfo.Name == ParameterInfo.Name)
+				{
+					ReturnParameterValue = Parameters[ParameterIndex];
+					CachedEditorInstance = EditorInstance;
+					CachedGroupIndex = GroupIndex;
+					CachedEditorParameterIndex = ParameterIndex;
+				}
+			}
+		}
+	}
+
+	return ReturnParameterValue;
+}
 #endif
 
 bool FRemoteControlInstanceMaterial::CheckIsBoundToPropertyPath(const FString& InPath) const
 {
-	return OriginalFieldPathInfo.ToString() == InPath;
+	if (CachedOriginalFieldPath.IsEmpty())
+	{
+		CachedOriginalFieldPath = OriginalFieldPathInfo.ToString();
+	}
+
+	return CachedOriginalFieldPath == InPath;
 }
 
 bool FRemoteControlInstanceMaterial::ContainsBoundObjects(TArray<UObject*> InObjects) const
@@ -8,6 +8,7 @@
 #include "Components/ActorComponent.h"
 #include "Components/LightComponent.h"
 #include "Components/MeshComponent.h"
+#include "Engine/Engine.h"
 #include "Factories/RCDefaultValueFactories.h"
 #include "Factories/RemoteControlMaskingFactories.h"
 #include "Features/IModularFeatures.h"
@@ -310,46 +311,64 @@ namespace RemoteControlUtil
 		AssetRegistry.GetAssets(GetBasePresetFilter(), OutAssets);
 	}
 
-	URemoteControlPreset* GetFirstPreset(const FARFilter& Filter)
+	bool FindFirstPresetAsset(const FARFilter& Filter, FAssetData& OutAsset)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FRemoteControlModule::GetFirstPreset);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRemoteControlModule::FindFirstPresetAsset);
 		IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
 
 		TArray<FAssetData> Assets;
 		AssetRegistry.GetAssets(Filter, Assets);
 
-		return Assets.Num() ? CastChecked<URemoteControlPreset>(Assets[0].GetAsset()) : nullptr;
+		if (Assets.Num())
+		{
+			OutAsset = MoveTemp(Assets[0]);
+			return true;
+		}
+
+		return false;
 	}
 
-	URemoteControlPreset* GetPresetById(const FGuid& Id)
+	bool FindPresetAssetById(const FGuid& Id, FAssetData& OutAsset)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FRemoteControlModule::GetPresetId);
 		FARFilter Filter = GetBasePresetFilter();
 		Filter.TagsAndValues.Add(FName("PresetId"), Id.ToString());
-		return GetFirstPreset(Filter);
+		return FindFirstPresetAsset(Filter, OutAsset);
 	}
 
-	URemoteControlPreset* FindPresetByName(FName PresetName)
+	bool FindPresetAssetByName(FName PresetName, FAssetData& OutAsset)
 	{
+		FARFilter Filter = GetBasePresetFilter();
+		Filter.PackageNames = {PresetName};
+		if (FindFirstPresetAsset(Filter, OutAsset))
+		{
+			return true;
+		}
+
 		IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
 
 		TArray<FAssetData> Assets;
 		AssetRegistry.GetAssetsByClass(URemoteControlPreset::StaticClass()->GetClassPathName(), Assets);
 
-		FAssetData* FoundAsset = Assets.FindByPredicate([&PresetName](const FAssetData& InAsset)
+		if (FAssetData* FoundAsset = Assets.FindByPredicate([&PresetName](const FAssetData& InAsset) { return InAsset.AssetName == PresetName; }))
 		{
-			return InAsset.AssetName == PresetName;
-		});
+			OutAsset = MoveTemp(*FoundAsset);
+			return true;
+		}
+
+		return false;
+	}
 
-		return FoundAsset ? Cast<URemoteControlPreset>(FoundAsset->GetAsset()) : nullptr;
+	URemoteControlPreset* GetPresetById(const FGuid& Id)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRemoteControlModule::GetPresetId);
+		FAssetData PresetAsset;
+		return FindPresetAssetById(Id, PresetAsset) ? CastChecked<URemoteControlPreset>(PresetAsset.GetAsset()) : nullptr;
 	}
 
 	URemoteControlPreset* GetPresetByName(FName PresetName)
 	{
-		FARFilter Filter = GetBasePresetFilter();
-		Filter.PackageNames = {PresetName};
-		URemoteControlPreset* FoundPreset = GetFirstPreset(Filter);
-		return FoundPreset ? FoundPreset : FindPresetByName(PresetName);
+		FAssetData PresetAsset;
+		return FindPresetAssetByName(PresetName, PresetAsset) ? Cast<URemoteControlPreset>(PresetAsset.GetAsset()) : nullptr;
 	}
 
 	FGuid GetPresetId(const FAssetData& PresetAsset)
@@ -783,6 +802,15 @@ void FRemoteControlModule::StartupModule()
 		AssetRegistry.OnFilesLoaded().AddRaw(this, &FRemoteControlModule::CachePresets);
 	}
 
+	if (GEngine)
+	{
+		PreloadPresets();
+	}
+	else
+	{
+		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FRemoteControlModule::PreloadPresets);
+	}
+
 #if WITH_EDITOR
 	FCoreDelegates::OnPostEngineInit.AddRaw(this, &FRemoteControlModule::HandleEnginePostInit);
 	FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FRemoteControlModule::HandleMapPreLoad);
@@ -808,8 +836,26 @@ void FRemoteControlModule::ShutdownModule()
 #if WITH_EDITOR
 	FCoreUObjectDelegates::PreLoadMap.RemoveAll(this);
 	UnregisterEditorDelegates();
-	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
 #endif
+	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+
+	// Drop in-flight preset loads, their callbacks may reference modules that are shutting down.
+	for (TPair<FSoftObjectPath, FPendingPresetLoad>& PendingLoad : PendingPresetLoads)
+	{
+		if (PendingLoad.Value.Handle.IsValid())
+		{
+			PendingLoad.Value.Handle->CancelHandle();
+		}
+	}
+	PendingPresetLoads.Empty();
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : PreloadedPresetHandles)
+	{
+		Handle->ReleaseHandle();
+	}
+	PreloadedPresetHandles.Empty();
+
+	// Also removes the PreloadPresets binding made while the asset registry was still loading.
 	if (FModuleManager::Get().IsModuleLoaded(AssetRegistryConstants::ModuleName))
 	{
 		IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
@@ -1029,39 +1075,48 @@ void FRemoteControlModule::ResetToDefaultValue(UObject* InObject, FRCResetToDefa
 
 void FRemoteControlModule::PerformMasking(const TSharedRef<FRCMaskingOperation>& InMaskingOperation)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FRemoteControlModule::PerformMasking);
+	PerformBatchedMasking(MakeArrayView(&InMaskingOperation, 1));
+}
 
-	if (!InMaskingOperation->IsValid())
-	{
-		return;
-	}
+void FRemoteControlModule::PerformBatchedMasking(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FRemoteControlModule::PerformBatchedMasking);
 
-	// Since we do not have any masks we do not need to process anything.
-	if (InMaskingOperation->Masks == ERCMask::NoMask || !SupportsMasking(InMaskingOperation->ObjectRef.Property.Get()))
-	{
-		return;
-	}
+	TMap<IRemoteControlMaskingFactory*, TArray<TSharedRef<FRCMaskingOperation>>> OperationsToApply;
 
-	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InMaskingOperation->ObjectRef.Property.Get()))
+	for (const TSharedRef<FRCMaskingOperation>& MaskingOperation : InMaskingOperations)
 	{
-		if (const TSharedPtr<IRemoteControlMaskingFactory>* MaskingFactory = MaskingFactories.Find(StructProperty->Struct))
+		// Since we do not have any masks we do not need to process anything.
+		if (!MaskingOperation->IsValid() || MaskingOperation->Masks == ERCMask::NoMask)
 		{
-			if (ActiveMaskingOperations.Contains(InMaskingOperation))
-			{
-				constexpr bool bIsInteractive = true;
+			continue;
+		}
 
-				(*MaskingFactory)->ApplyMaskedValues(InMaskingOperation, bIsInteractive);
+		const FStructProperty* StructProperty = CastField<FStructProperty>(MaskingOperation->ObjectRef.Property.Get());
+		const TSharedPtr<IRemoteControlMaskingFactory>* MaskingFactory = StructProperty ? MaskingFactories.Find(StructProperty->Struct) : nullptr;
+		if (!MaskingFactory)
+		{
+			continue;
+		}
 
-				ActiveMaskingOperations.Remove(InMaskingOperation);
-			}
-			else
-			{
-				ActiveMaskingOperations.Add(InMaskingOperation);
+		if (ActiveMaskingOperations.Remove(MaskingOperation) > 0)
+		{
+			OperationsToApply.FindOrAdd(MaskingFactory->Get()).Add(MaskingOperation);
+		}
+		else
+		{
+			ActiveMaskingOperations.Add(MaskingOperation);
 
-				(*MaskingFactory)->CacheRawValues(InMaskingOperation);
-			}
+			(*MaskingFactory)->CacheRawValues(MaskingOperation);
 		}
 	}
+
+	constexpr bool bIsInteractive = true;
+
+	for (const TPair<IRemoteControlMaskingFactory*, TArray<TSharedRef<FRCMaskingOperation>>>& FactoryOperations : OperationsToApply)
+	{
+		FactoryOperations.Key->ApplyBatchedMaskedValues(FactoryOperations.Value, bIsInteractive);
+	}
 }
 
 void FRemoteControlModule::RegisterMaskingFactoryForType(UScriptStruct* RemoteControlPropertyType, const TSharedPtr<IRemoteControlMaskingFactory>& InMaskingFactory)
@@ -2040,7 +2095,7 @@ URemoteControlPreset* FRemoteControlModule::ResolvePreset(FName PresetName) cons
 		{
 			if (Asset.AssetName == PresetName)
 			{
-				return Cast<URemoteControlPreset>(Asset.GetAsset());
+				return LoadPresetAsset(Asset);
 			}
 		}
 	}
@@ -2078,7 +2133,7 @@ URemoteControlPreset* FRemoteControlModule::ResolvePreset(const FGuid& PresetId)
 			{
 				if (RemoteControlUtil::GetPresetId(Asset) == PresetId)
 				{
-					return Cast<URemoteControlPreset>(Asset.GetAsset());
+					return LoadPresetAsset(Asset);
 				}
 			}
 		}
@@ -2112,6 +2167,212 @@ URemoteControlPreset* FRemoteControlModule::ResolvePreset(const FGuid& PresetId)
 	return nullptr;
 }
 
+void FRemoteControlModule::ResolvePresetAsync(FName PresetName, FOnPresetResolved OnResolved)
+{
+	if (const TWeakObjectPtr<URemoteControlPreset>* EmbeddedPreset = EmbeddedPresets.Find(PresetName))
+	{
+		if (EmbeddedPreset->IsValid())
+		{
+			OnResolved.ExecuteIfBound(EmbeddedPreset->Get());
+			return;
+		}
+	}
+
+	FAssetData PresetAsset;
+	if (!FindPresetAsset(PresetName, PresetAsset))
+	{
+		OnResolved.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	RequestPresetLoad(PresetAsset, MoveTemp(OnResolved));
+}
+
+void FRemoteControlModule::ResolvePresetAsync(const FGuid& PresetId, FOnPresetResolved OnResolved)
+{
+	for (const TPair<FName, TWeakObjectPtr<URemoteControlPreset>>& Pair : EmbeddedPresets)
+	{
+		if (Pair.Value.IsValid() && Pair.Value->GetPresetId() == PresetId)
+		{
+			OnResolved.ExecuteIfBound(Pair.Value.Get());
+			return;
+		}
+	}
+
+	FAssetData PresetAsset;
+	if (!FindPresetAsset(PresetId, PresetAsset))
+	{
+		OnResolved.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	RequestPresetLoad(PresetAsset, MoveTemp(OnResolved));
+}
+
+bool FRemoteControlModule::GetPresetLoadTime(const FGuid& PresetId, double& OutLoadTimeSeconds) const
+{
+	if (const double* LoadTime = PresetLoadTimes.Find(PresetId))
+	{
+		OutLoadTimeSeconds = *LoadTime;
+		return true;
+	}
+
+	return false;
+}
+
+bool FRemoteControlModule::FindPresetAsset(FName PresetName, FAssetData& OutAsset) const
+{
+	if (const TArray<FAssetData>* Assets = CachedPresetsByName.Find(PresetName))
+	{
+		if (const FAssetData* Asset = Assets->FindByPredicate([PresetName](const FAssetData& InAsset) { return InAsset.AssetName == PresetName; }))
+		{
+			OutAsset = *Asset;
+			return true;
+		}
+	}
+
+	if (RemoteControlUtil::FindPresetAssetByName(PresetName, OutAsset))
+	{
+		CachedPresetsByName.FindOrAdd(PresetName).AddUnique(OutAsset);
+		return true;
+	}
+
+	return false;
+}
+
+bool FRemoteControlModule::FindPresetAsset(const FGuid& PresetId, FAssetData& OutAsset) const
+{
+	if (const FName* AssetName = CachedPresetNamesById.Find(PresetId))
+	{
+		if (const TArray<FAssetData>* Assets = CachedPresetsByName.Find(*AssetName))
+		{
+			if (const FAssetData* Asset = Assets->FindByPredicate([&PresetId](const FAssetData& InAsset) { return RemoteControlUtil::GetPresetId(InAsset) == PresetId; }))
+			{
+				OutAsset = *Asset;
+				return true;
+			}
+		}
+	}
+
+	if (RemoteControlUtil::FindPresetAssetById(PresetId, OutAsset))
+	{
+		CachedPresetNamesById.Emplace(PresetId, OutAsset.AssetName);
+		CachedPresetsByName.FindOrAdd(OutAsset.AssetName).AddUnique(OutAsset);
+		return true;
+	}
+
+	return false;
+}
+
+URemoteControlPreset* FRemoteControlModule::LoadPresetAsset(const FAssetData& PresetAsset) const
+{
+	if (PresetAsset.IsAssetLoaded())
+	{
+		return Cast<URemoteControlPreset>(PresetAsset.GetAsset());
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	URemoteControlPreset* Preset = Cast<URemoteControlPreset>(PresetAsset.GetAsset());
+	const double LoadTime = FPlatformTime::Seconds() - StartTime;
+
+	if (Preset)
+	{
+		PresetLoadTimes.Add(Preset->GetPresetId(), LoadTime);
+		UE_LOG(LogRemoteControl, Log, TEXT("Preset %s was loaded synchronously in %.2f ms. Consider adding it to the presets to preload in the Remote Control settings."), *PresetAsset.AssetName.ToString(), LoadTime * 1000.0);
+	}
+
+	return Preset;
+}
+
+TSharedPtr<FStreamableHandle> FRemoteControlModule::RequestPresetLoad(const FAssetData& PresetAsset, FOnPresetResolved OnResolved)
+{
+	if (PresetAsset.IsAssetLoaded())
+	{
+		OnResolved.ExecuteIfBound(Cast<URemoteControlPreset>(PresetAsset.GetAsset()));
+		return nullptr;
+	}
+
+	const FSoftObjectPath PresetPath = PresetAsset.GetSoftObjectPath();
+	if (FPendingPresetLoad* PendingLoad = PendingPresetLoads.Find(PresetPath))
+	{
+		PendingLoad->Callbacks.Add(MoveTemp(OnResolved));
+		return PendingLoad->Handle;
+	}
+
+	FPendingPresetLoad& NewLoad = PendingPresetLoads.Add(PresetPath);
+	NewLoad.Callbacks.Add(MoveTemp(OnResolved));
+	NewLoad.StartTime = FPlatformTime::Seconds();
+
+	// The completion delegate can be called before RequestAsyncLoad returns, so look the entry up again before storing the handle.
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(PresetPath, FStreamableDelegate::CreateRaw(this, &FRemoteControlModule::OnPresetLoaded, PresetPath));
+	if (FPendingPresetLoad* PendingLoad = PendingPresetLoads.Find(PresetPath))
+	{
+		PendingLoad->Handle = Handle;
+	}
+
+	return Handle;
+}
+
+void FRemoteControlModule::OnPresetLoaded(FSoftObjectPath PresetPath)
+{
+	FPendingPresetLoad PendingLoad;
+	if (!PendingPresetLoads.RemoveAndCopyValue(PresetPath, PendingLoad))
+	{
+		return;
+	}
+
+	URemoteControlPreset* Preset = Cast<URemoteControlPreset>(PresetPath.ResolveObject());
+	if (Preset)
+	{
+		const double LoadTime = FPlatformTime::Seconds() - PendingLoad.StartTime;
+		PresetLoadTimes.Add(Preset->GetPresetId(), LoadTime);
+		UE_LOG(LogRemoteControl, Verbose, TEXT("Preset %s was loaded asynchronously in %.2f ms."), *Preset->GetName(), LoadTime * 1000.0);
+	}
+	else
+	{
+		UE_LOG(LogRemoteControl, Warning, TEXT("Failed to load preset %s."), *PresetPath.ToString());
+	}
+
+	for (FOnPresetResolved& Callback : PendingLoad.Callbacks)
+	{
+		Callback.ExecuteIfBound(Preset);
+	}
+}
+
+void FRemoteControlModule::PreloadPresets()
+{
+	const TArray<FSoftObjectPath>& PresetsToPreload = GetDefault<URemoteControlSettings>()->PresetsToPreload;
+	if (PresetsToPreload.IsEmpty())
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		AssetRegistry.OnFilesLoaded().AddRaw(this, &FRemoteControlModule::PreloadPresets);
+		return;
+	}
+
+	for (const FSoftObjectPath& PresetPath : PresetsToPreload)
+	{
+		const FAssetData PresetAsset = AssetRegistry.GetAssetByObjectPath(PresetPath);
+		if (PresetAsset.IsValid())
+		{
+			// Presets that are already loaded still need a handle to stay loaded until their first use.
+			TSharedPtr<FStreamableHandle> Handle = PresetAsset.IsAssetLoaded() ? StreamableManager.RequestAsyncLoad(PresetPath) : RequestPresetLoad(PresetAsset, FOnPresetResolved());
+			if (Handle.IsValid())
+			{
+				PreloadedPresetHandles.Add(MoveTemp(Handle));
+			}
+		}
+		else
+		{
+			UE_LOG(LogRemoteControl, Warning, TEXT("Preset %s listed in the presets to preload could not be found."), *PresetPath.ToString());
+		}
+	}
+}
+
 URemoteControlPreset* FRemoteControlModule::CreateTransientPreset()
 {
 	const FName AssetName(*FString::Printf(TEXT("TransientRCPreset%d"), NextTransientPresetIndex));
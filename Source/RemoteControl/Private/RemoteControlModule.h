@@ -5,6 +5,7 @@
 #include "Containers/Ticker.h"
 #include "CoreMinimal.h"
 #include "Engine/EngineTypes.h"
+#include "Engine/StreamableManager.h"
 #include "Factories/IRCDefaultValueFactory.h"
 #include "Factories/IRemoteControlMaskingFactory.h"
 #include "IRemoteControlInterceptionFeature.h"
@@ -17,6 +18,9 @@ PRAGMA_DISABLE_DEPRECATION_WARNINGS
 
 class FRemoteControlModule : public IRemoteControlModule
 {
+	/** Measures DeserializeDeltaModificationData in isolation. */
+	friend class FRemoteControlDeltaModificationBenchmark;
+
 public:
 	//~ Begin IModuleInterface
 	virtual void StartupModule() override;
@@ -36,6 +40,7 @@ public:
 	virtual bool HasDefaultValueCustomization(const UObject* InObject, const FProperty* InProperty) const override;
 	virtual void ResetToDefaultValue(UObject* InObject, FRCResetToDefaultArgs& InArgs) override;
 	virtual void PerformMasking(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) override;
+	virtual void PerformBatchedMasking(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations) override;
 	virtual void RegisterMaskingFactoryForType(UScriptStruct* RemoteControlPropertyType, const TSharedPtr<IRemoteControlMaskingFactory>& InMaskingFactory) override;
 	virtual void UnregisterMaskingFactoryForType(UScriptStruct* RemoteControlPropertyType) override;
 	virtual bool SupportsMasking(const FProperty* InProperty) const override;
@@ -55,6 +60,9 @@ public:
 	virtual TOptional<FExposedProperty> ResolvePresetProperty(const FResolvePresetFieldArgs& Args) const override;
 	virtual URemoteControlPreset* ResolvePreset(FName PresetName) const override;
 	virtual URemoteControlPreset* ResolvePreset(const FGuid& PresetId) const override;
+	virtual void ResolvePresetAsync(FName PresetName, FOnPresetResolved OnResolved) override;
+	virtual void ResolvePresetAsync(const FGuid& PresetId, FOnPresetResolved OnResolved) override;
+	virtual bool GetPresetLoadTime(const FGuid& PresetId, double& OutLoadTimeSeconds) const override;
 	virtual URemoteControlPreset* CreateTransientPreset() override;
 	virtual bool DestroyTransientPreset(FName PresetName) override;
 	virtual bool DestroyTransientPreset(const FGuid& PresetId) override;
@@ -86,6 +94,25 @@ private:
 
 	/** Cache all presets in the project for the ResolvePreset function. */
 	void CachePresets() const;
+
+	/** Find the asset data of a preset without loading it. */
+	bool FindPresetAsset(FName PresetName, FAssetData& OutAsset) const;
+	bool FindPresetAsset(const FGuid& PresetId, FAssetData& OutAsset) const;
+
+	/** Get the preset from its asset data, loading it synchronously and recording the load time if needed. */
+	URemoteControlPreset* LoadPresetAsset(const FAssetData& PresetAsset) const;
+
+	/**
+	 * Request an asynchronous load of a preset, coalescing requests for the same asset.
+	 * @return The handle of the load, nullptr if the preset is already loaded.
+	 */
+	TSharedPtr<FStreamableHandle> RequestPresetLoad(const FAssetData& PresetAsset, FOnPresetResolved OnResolved);
+
+	/** Called by the streamable manager when a preset load requested by RequestPresetLoad completes. */
+	void OnPresetLoaded(FSoftObjectPath PresetPath);
+
+	/** Start loading the presets listed in the PresetsToPreload setting. */
+	void PreloadPresets();
 	
 	//~ Asset registry callbacks
 	void OnAssetAdded(const FAssetData& AssetData);
@@ -219,6 +246,31 @@ private:
 	 **/
 	TMap<FName, TWeakObjectPtr<URemoteControlPreset>> EmbeddedPresets;
 
+	/** An asynchronous preset load that is in flight. */
+	struct FPendingPresetLoad
+	{
+		/** Handle to the streamable request, keeps the load alive. */
+		TSharedPtr<FStreamableHandle> Handle;
+
+		/** Callbacks of every resolution waiting on this load. */
+		TArray<FOnPresetResolved> Callbacks;
+
+		/** Time at which the load was requested. */
+		double StartTime = 0.0;
+	};
+
+	/** Used to stream preset packages in without blocking the game thread. */
+	FStreamableManager StreamableManager;
+
+	/** Preset loads that are in flight, by preset path. */
+	TMap<FSoftObjectPath, FPendingPresetLoad> PendingPresetLoads;
+
+	/** Handles of the presets listed in PresetsToPreload, they keep the presets from being garbage collected before their first use. */
+	TArray<TSharedPtr<FStreamableHandle>> PreloadedPresetHandles;
+
+	/** Time spent loading each preset loaded by the module, in seconds. */
+	mutable TMap<FGuid, double> PresetLoadTimes;
+
 	/** Temporary presets that aren't saved as assets or directly visible to the editor's user. */
 	TSet<FAssetData> TransientPresets;
 
@@ -581,10 +581,17 @@ void FRemoteControlPresetLayout::AddField(FGuid GroupId, FGuid FieldId)
 		FRCTransactionListenerHelper<const FGuid&, const FGuid&, int32>(ERCTransaction::Undo, Owner->GetPresetId(), OnFieldDeleted(), GroupId, FieldId, Group->AccessFields().Num() - 1);
 		FRCTransactionListenerHelper<const FGuid&, const FGuid&, int32>(ERCTransaction::Redo, Owner->GetPresetId(), OnFieldAdded(), GroupId, FieldId, Group->AccessFields().Num() - 1);
 
-		Owner->OnPresetLayoutModified().Broadcast(Owner.Get());
+		if (Owner->bOngoingBulkOperation)
+		{
+			Owner->bBulkLayoutModified = true;
+		}
+		else
+		{
+			Owner->OnPresetLayoutModified().Broadcast(Owner.Get());
 
-		FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Undo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
-		FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Redo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
+			FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Undo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
+			FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Redo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
+		}
 	}
 }
 
@@ -633,10 +640,17 @@ void FRemoteControlPresetLayout::RemoveFieldAt(FGuid GroupId, int32 Index)
 		FRCTransactionListenerHelper<const FGuid&, const FGuid&, int32>(ERCTransaction::Undo, Owner->GetPresetId(), OnFieldAdded(), GroupId, FieldId, Index);
 		FRCTransactionListenerHelper<const FGuid&, const FGuid&, int32>(ERCTransaction::Redo, Owner->GetPresetId(), OnFieldDeleted(), GroupId, FieldId, Index);
 
-		Owner->OnPresetLayoutModified().Broadcast(Owner.Get());
+		if (Owner->bOngoingBulkOperation)
+		{
+			Owner->bBulkLayoutModified = true;
+		}
+		else
+		{
+			Owner->OnPresetLayoutModified().Broadcast(Owner.Get());
 
-		FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Undo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
-		FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Redo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
+			FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Undo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
+			FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Redo, Owner->GetPresetId(), Owner->OnPresetLayoutModified(), Owner.Get());
+		}
 	}
 }
 
@@ -1084,6 +1098,42 @@ TWeakPtr<FRemoteControlProperty> URemoteControlPreset::ExposeProperty(UObject* O
 	return RCPropertyPtr;
 }
 
+TArray<TWeakPtr<FRemoteControlProperty>> URemoteControlPreset::ExposeProperties(TConstArrayView<FRemoteControlPresetExposePropertyArgs> Properties)
+{
+	TArray<TWeakPtr<FRemoteControlProperty>> ExposedProperties;
+	ExposedProperties.Reserve(Properties.Num());
+
+	// When nested in another bulk operation, the entities are notified along with the outer operation's.
+	const bool bOuterOperation = !bOngoingBulkOperation;
+	if (bOuterOperation)
+	{
+		Registry->Modify();
+		PropertyIdRegistry->Modify();
+		bOngoingBulkOperation = true;
+	}
+
+	for (const FRemoteControlPresetExposePropertyArgs& Property : Properties)
+	{
+		ExposedProperties.Add(ExposeProperty(Property.Object, Property.FieldPath, Property.Args));
+	}
+
+	if (bOuterOperation)
+	{
+		const TArray<FGuid> ExposedEntityIds = MoveTemp(BulkExposedEntityIds);
+		EndBulkOperation();
+
+		if (ExposedEntityIds.Num())
+		{
+			OnEntitiesExposedDelegate.Broadcast(this, ExposedEntityIds);
+
+			FRCTransactionListenerHelper<URemoteControlPreset*, const TArray<FGuid>&>(ERCTransaction::Undo, GetPresetId(), OnEntitiesUnexposed(), this, ExposedEntityIds);
+			FRCTransactionListenerHelper<URemoteControlPreset*, const TArray<FGuid>&>(ERCTransaction::Redo, GetPresetId(), OnEntitiesExposed(), this, ExposedEntityIds);
+		}
+	}
+
+	return ExposedProperties;
+}
+
 TWeakPtr<FRemoteControlFunction> URemoteControlPreset::ExposeFunction(UObject* Object, UFunction* Function, FRemoteControlPresetExposeArgs Args)
 {
 	if (!Object || !Function || !Object->GetClass() || !Object->GetClass()->FindFunctionByName(Function->GetFName()))
@@ -1124,8 +1174,11 @@ TWeakPtr<FRemoteControlFunction> URemoteControlPreset::ExposeFunction(UObject* O
 
 TSharedPtr<FRemoteControlEntity> URemoteControlPreset::Expose(FRemoteControlEntity&& Entity, UScriptStruct* EntityType, const FGuid& GroupId)
 {
-	Registry->Modify();
-	PropertyIdRegistry->Modify();
+	if (!bOngoingBulkOperation)
+	{
+		Registry->Modify();
+		PropertyIdRegistry->Modify();
+	}
 
 #if WITH_EDITOR
 	if (FEngineAnalytics::IsAvailable())
@@ -1156,11 +1209,18 @@ TSharedPtr<FRemoteControlEntity> URemoteControlPreset::Expose(FRemoteControlEnti
 	CachedData.LayoutGroupId = Group->Id;
 
 	Layout.AddField(Group->Id, RCEntity->GetId());
-	
-	OnEntityExposed().Broadcast(this, RCEntity->GetId());
 
-	FRCTransactionListenerHelper<URemoteControlPreset*, const FGuid&>(ERCTransaction::Undo, GetPresetId(), OnEntityUnexposed(), this, RCEntity->GetId());
-	FRCTransactionListenerHelper<URemoteControlPreset*, const FGuid&>(ERCTransaction::Redo, GetPresetId(), OnEntityExposed(), this, RCEntity->GetId());
+	if (bOngoingBulkOperation)
+	{
+		BulkExposedEntityIds.Add(RCEntity->GetId());
+	}
+	else
+	{
+		OnEntityExposed().Broadcast(this, RCEntity->GetId());
+
+		FRCTransactionListenerHelper<URemoteControlPreset*, const FGuid&>(ERCTransaction::Undo, GetPresetId(), OnEntityUnexposed(), this, RCEntity->GetId());
+		FRCTransactionListenerHelper<URemoteControlPreset*, const FGuid&>(ERCTransaction::Redo, GetPresetId(), OnEntityExposed(), this, RCEntity->GetId());
+	}
 
 	return RCEntity;
 }
@@ -1521,20 +1581,12 @@ void URemoteControlPreset::HandleDisplayClusterConfigChange(UObject* DisplayClus
 					PresetPtr->Modify();
 					Binding->Modify();
 					Binding->SetBoundObject(NewObject);
-				}
 
-				for (const TSharedPtr<FRemoteControlField>& Entity : PresetPtr->Registry->GetExposedEntities<FRemoteControlField>())
-				{
-					for (TWeakObjectPtr<URemoteControlBinding> WeakBinding : Entity->Bindings)
+					for (const FGuid& EntityId : PresetPtr->Registry->GetEntitiesUsingBinding(Binding))
 					{
-						if (!WeakBinding.IsValid())
+						if (PresetPtr->Registry->GetExposedEntity<FRemoteControlField>(EntityId))
 						{
-							continue;
-						}
-
-						if (ModifiedBindings.Contains(WeakBinding.Get()))
-						{
-							PresetPtr->PerFrameUpdatedEntities.Add(Entity->GetId());
+							PresetPtr->PerFrameUpdatedEntities.Add(EntityId);
 						}
 					}
 				}
@@ -1735,18 +1787,84 @@ void URemoteControlPreset::Unexpose(const FGuid& EntityId)
 		OnEntityUnexposedDelegate.Broadcast(this, EntityId);
 
 		Registry->Modify();
-		Registry->RemoveExposedEntity(EntityId);
-
 		PropertyIdRegistry->Modify();
-		PropertyIdRegistry->RemoveIdentifiedField(EntityId);
+		RemoveExposedEntity(EntityId);
+	}
+}
+
+void URemoteControlPreset::Unexpose(TConstArrayView<FGuid> EntityIds)
+{
+	TArray<FGuid> UnexposedEntityIds;
+	UnexposedEntityIds.Reserve(EntityIds.Num());
+
+	TSet<FGuid> UniqueEntityIds;
+	UniqueEntityIds.Reserve(EntityIds.Num());
 
-		if (FRCCachedFieldData* CachedData = FieldCache.Find(EntityId))
+	for (const FGuid& EntityId : EntityIds)
+	{
+		bool bAlreadyInSet = false;
+		UniqueEntityIds.Add(EntityId, &bAlreadyInSet);
+
+		if (!bAlreadyInSet && EntityId.IsValid() && Registry->GetExposedEntity(EntityId).IsValid())
 		{
-			Layout.RemoveField(CachedData->LayoutGroupId, EntityId);
-			FieldCache.Remove(EntityId);
-			PropertyWatchers.Remove(EntityId);
+			UnexposedEntityIds.Add(EntityId);
 		}
 	}
+
+	if (UnexposedEntityIds.IsEmpty())
+	{
+		return;
+	}
+
+	FRCTransactionListenerHelper<URemoteControlPreset*, const TArray<FGuid>&>(ERCTransaction::Undo, GetPresetId(), OnEntitiesExposed(), this, UnexposedEntityIds);
+	FRCTransactionListenerHelper<URemoteControlPreset*, const TArray<FGuid>&>(ERCTransaction::Redo, GetPresetId(), OnEntitiesUnexposed(), this, UnexposedEntityIds);
+
+	// Notify before removing the entities so listeners can still access them.
+	OnEntitiesUnexposedDelegate.Broadcast(this, UnexposedEntityIds);
+
+	Registry->Modify();
+	PropertyIdRegistry->Modify();
+
+	const bool bOuterOperation = !bOngoingBulkOperation;
+	bOngoingBulkOperation = true;
+
+	for (const FGuid& EntityId : UnexposedEntityIds)
+	{
+		RemoveExposedEntity(EntityId);
+	}
+
+	if (bOuterOperation)
+	{
+		EndBulkOperation();
+	}
+}
+
+void URemoteControlPreset::RemoveExposedEntity(const FGuid& EntityId)
+{
+	Registry->RemoveExposedEntity(EntityId);
+	PropertyIdRegistry->RemoveIdentifiedField(EntityId);
+
+	if (FRCCachedFieldData* CachedData = FieldCache.Find(EntityId))
+	{
+		Layout.RemoveField(CachedData->LayoutGroupId, EntityId);
+		FieldCache.Remove(EntityId);
+		PropertyWatchers.Remove(EntityId);
+	}
+}
+
+void URemoteControlPreset::EndBulkOperation()
+{
+	bOngoingBulkOperation = false;
+
+	if (bBulkLayoutModified)
+	{
+		bBulkLayoutModified = false;
+
+		OnPresetLayoutModified().Broadcast(this);
+
+		FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Undo, GetPresetId(), OnPresetLayoutModified(), this);
+		FRCTransactionListenerHelper<URemoteControlPreset*>(ERCTransaction::Redo, GetPresetId(), OnPresetLayoutModified(), this);
+	}
 }
 
 void URemoteControlPreset::CacheLayoutData()
@@ -1935,6 +2053,16 @@ TArray<TSharedPtr<const FRemoteControlEntity>> URemoteControlPreset::GetEntities
 	return const_cast<const URemoteControlExposeRegistry*>(ToRawPtr(Registry))->GetExposedEntities(EntityType);
 }
 
+void URemoteControlPreset::ForEachEntity(const UScriptStruct* EntityType, TFunctionRef<bool(const TSharedPtr<FRemoteControlEntity>&)> Callback) const
+{
+	Registry->ForEachExposedEntity(EntityType, Callback);
+}
+
+int32 URemoteControlPreset::GetNumExposedEntities(const UScriptStruct* EntityType) const
+{
+	return Registry->GetNumExposedEntities(EntityType);
+}
+
 const UScriptStruct* URemoteControlPreset::GetExposedEntityType(const FGuid& ExposedEntityId) const
 {
 	return Registry->GetExposedEntityType(ExposedEntityId);
@@ -2540,18 +2668,25 @@ void URemoteControlPreset::OnReplaceObjects(const TMap<UObject*, UObject*>& Repl
 		}
 	}
 
-	for (const TSharedPtr<FRemoteControlField>& Entity : Registry->GetExposedEntities<FRemoteControlField>())
+	TSet<UObject*> ReplacementObjects;
+	ReplacementObjects.Reserve(ReplacementObjectMap.Num());
+	for (const TPair<UObject*, UObject*>& Replacement : ReplacementObjectMap)
+	{
+		ReplacementObjects.Add(Replacement.Value);
+	}
+
+	for (URemoteControlBinding* Binding : Bindings)
 	{
-		for (TWeakObjectPtr<URemoteControlBinding> Binding : Entity->Bindings)
+		if (!Binding || (!ModifiedBindings.Contains(Binding) && !ReplacementObjects.Contains(Binding->Resolve())))
 		{
-			if (!Binding.IsValid())
-			{
-				continue;
-			}
-				
-			if (ModifiedBindings.Contains(Binding.Get()) || ReplacementObjectMap.FindKey(Binding->Resolve()))
+			continue;
+		}
+
+		for (const FGuid& EntityId : Registry->GetEntitiesUsingBinding(Binding))
+		{
+			if (Registry->GetExposedEntity<FRemoteControlField>(EntityId))
 			{
-				PerFrameUpdatedEntities.Add(Entity->GetId());
+				PerFrameUpdatedEntities.Add(EntityId);
 			}
 		}
 	}
@@ -2606,6 +2741,8 @@ void URemoteControlPreset::OnPackageReloaded(EPackageReloadPhase Phase, FPackage
 		{
 			RepointedPreset->OnEntityExposedDelegate = OnEntityExposedDelegate;
 			RepointedPreset->OnEntityUnexposedDelegate = OnEntityUnexposedDelegate;
+			RepointedPreset->OnEntitiesExposedDelegate = OnEntitiesExposedDelegate;
+			RepointedPreset->OnEntitiesUnexposedDelegate = OnEntitiesUnexposedDelegate;
 			RepointedPreset->OnEntitiesUpdatedDelegate = OnEntitiesUpdatedDelegate;
 			RepointedPreset->OnPropertyChangedDelegate = OnPropertyChangedDelegate;
 			RepointedPreset->OnPropertyExposedDelegate = OnPropertyExposedDelegate;
@@ -2643,19 +2780,13 @@ void URemoteControlPreset::CleanUpBindings()
 		}
 	}
 
-	for (TSharedPtr<FRemoteControlEntity> Entity : Registry->GetExposedEntities<FRemoteControlEntity>())
+	for (URemoteControlBinding* Binding : PerFrameBindingsToClean)
 	{
-		if (Entity)
+		// Update bindings that were "touched" regardless of if they were pruned, so that the UI can re-resolve the binding
+		// if one of the object was moved to a sublevel.
+		for (const FGuid& EntityId : Registry->GetEntitiesUsingBinding(Binding))
 		{
-			for (auto It = Entity->Bindings.CreateIterator(); It; ++It)
-			{
-				// Update bindings that were "touched" regardless of if they were pruned, so that the UI can re-resolve the binding
-				// if one of the object was moved to a sublevel.
-				if (PerFrameBindingsToClean.Contains(It->Get()))
-				{
-					PerFrameUpdatedEntities.Add(Entity->GetId());
-				}
-			}
+			PerFrameUpdatedEntities.Add(EntityId);
 		}
 	}
 
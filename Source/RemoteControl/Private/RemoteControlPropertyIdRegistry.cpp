@@ -140,6 +140,7 @@ void URemoteControlPropertyIdRegistry::Initialize()
 	}
 
 	IdentifiedFields.Reset();
+	bChainReactionTargetsDirty = true;
 	for (TWeakPtr<FRemoteControlEntity> RCEntity : SourcePreset->GetExposedEntities())
 	{
 		if (const TSharedPtr<FRemoteControlField> RCField = StaticCastSharedPtr<FRemoteControlField>(RCEntity.Pin()))
@@ -160,6 +161,12 @@ void URemoteControlPropertyIdRegistry::PostEditChangeProperty(FPropertyChangedEv
 	UObject::PostEditChangeProperty(InPropertyChangedEvent);
 	Initialize();
 }
+
+void URemoteControlPropertyIdRegistry::PostEditUndo()
+{
+	Super::PostEditUndo();
+	bChainReactionTargetsDirty = true;
+}
 #endif
 
 void URemoteControlPropertyIdRegistry::PerformChainReaction(const FRemoteControlPropertyIdArgs& InArgs)
@@ -170,23 +177,13 @@ void URemoteControlPropertyIdRegistry::PerformChainReaction(const FRemoteControl
 		return;
 	}
 
-	TSet<FGuid> TargetProperties;
-
-	Algo::TransformIf(IdentifiedFields, TargetProperties,
-		[InArgs](const FRCPropertyIdWrapper& Wrapper)
-		{
-			return Wrapper.IsValid()
-			&& Wrapper.GetPropertyId() == InArgs.PropertyId
-			&& Wrapper.GetSuperType() == InArgs.SuperType
-			&& Wrapper.GetSubType() == InArgs.SubType;
-		},
-		[](const FRCPropertyIdWrapper& Wrapper)
-		{
-			return Wrapper.GetEntityId();
-		}
-		);
+	const TArray<FGuid>* TargetProperties = FindChainReactionTargets(InArgs);
+	if (!TargetProperties)
+	{
+		return;
+	}
 
-	for (const FGuid& TargetProperty : TargetProperties)
+	for (const FGuid& TargetProperty : *TargetProperties)
 	{
 		if (TSharedPtr<FRemoteControlProperty> TargetRCProperty = SourcePreset->GetExposedEntity<FRemoteControlProperty>(TargetProperty).Pin())
 		{
@@ -234,19 +231,19 @@ void URemoteControlPropertyIdRegistry::PerformChainReaction(const FRemoteControl
 			ObjectRef.Access = ERCAccess::WRITE_ACCESS;
 			ObjectRef.PropertyPathInfo = TargetRCProperty->FieldPathInfo.ToString();
 
+			// The value is the same for every bound object, so it is only serialized once
+			TArray<uint8> Buffer;
+
 			for (UObject* Object : TargetRCProperty->GetBoundObjects())
 			{
 				if (IRemoteControlModule::Get().ResolveObjectProperty(ObjectRef.Access, Object, ObjectRef.PropertyPathInfo, ObjectRef))
 				{
-					TArray<uint8> Buffer;
-					FMemoryWriter Writer(Buffer);
-
-					FCborStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
-
-					FStructSerializerPolicies Policies; 
-					Policies.MapSerialization = EStructSerializerMapPolicies::Array;
-
-					(*RealPropContainer)->SerializeToBackend(SerializerBackend);
+					if (Buffer.IsEmpty())
+					{
+						FMemoryWriter Writer(Buffer);
+						FCborStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
+						(*RealPropContainer)->SerializeToBackend(SerializerBackend);
+					}
 
 					// Deserialization
 					FMemoryReader Reader(Buffer);
@@ -274,6 +271,7 @@ void URemoteControlPropertyIdRegistry::AddIdentifiedField(const TSharedRef<FRemo
 					Modify();
 #endif
 					IdentifiedFields.Add(MoveTemp(Wrapper));
+					bChainReactionTargetsDirty = true;
 				}
 			}
 		}
@@ -293,6 +291,7 @@ void URemoteControlPropertyIdRegistry::UpdateIdentifiedField(const TSharedRef<FR
 		if (FRCPropertyIdWrapper* Wrapper = IdentifiedFields.FindByHash(Hash, InFieldToIdentify->GetId()))
 		{
 			Wrapper->SetPropertyId(InFieldToIdentify->PropertyId);
+			bChainReactionTargetsDirty = true;
 			OnPropertyIdUpdated().Broadcast();
 		}
 	}
@@ -308,6 +307,7 @@ void URemoteControlPropertyIdRegistry::RemoveIdentifiedField(const FGuid& InEnti
 		Modify();
 #endif
 		IdentifiedFields.RemoveByHash(Hash, InEntityId);
+		bChainReactionTargetsDirty = true;
 	}
 }
 
@@ -425,5 +425,24 @@ void URemoteControlPropertyIdRegistry::UpdateEntityIds(const TMap<FGuid, FGuid>&
 		}
 	
 		IdentifiedFields = MoveTemp(RehashedIdentifiedFields);
+		bChainReactionTargetsDirty = true;
+	}
+}
+
+const TArray<FGuid>* URemoteControlPropertyIdRegistry::FindChainReactionTargets(const FRemoteControlPropertyIdArgs& InArgs)
+{
+	if (bChainReactionTargetsDirty)
+	{
+		ChainReactionTargets.Reset();
+		for (const FRCPropertyIdWrapper& Wrapper : IdentifiedFields)
+		{
+			if (Wrapper.IsValid())
+			{
+				ChainReactionTargets.FindOrAdd(MakeTuple(Wrapper.GetPropertyId(), Wrapper.GetSuperType(), Wrapper.GetSubType())).Add(Wrapper.GetEntityId());
+			}
+		}
+		bChainReactionTargetsDirty = false;
 	}
+
+	return ChainReactionTargets.Find(MakeTuple(InArgs.PropertyId, InArgs.SuperType, InArgs.SubType));
 }
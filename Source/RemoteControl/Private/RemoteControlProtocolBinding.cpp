@@ -692,38 +692,44 @@ bool FRemoteControlProtocolEntity::ApplyProtocolValueToProperty(double InProtoco
 
 	ObjectRef.PropertyPathInfo = RemoteControlProperty->FieldPathInfo.ToString();
 
-	bool bSuccess = true;
-	for (UObject* Object : RemoteControlProperty->GetBoundObjects())
+	// The interpolated value is the same for every bound object
+	TArray<uint8> InterpolatedBuffer;
+	if (!GetInterpolatedPropertyBuffer(Property, InProtocolValue, InterpolatedBuffer))
 	{
-		IRemoteControlModule::Get().ResolveObjectProperty(ObjectRef.Access, Object, ObjectRef.PropertyPathInfo, ObjectRef);
+		return true;
+	}
 
-		TSharedPtr<FRCMaskingOperation> MaskingOperation = MakeShared<FRCMaskingOperation>(ObjectRef.PropertyPathInfo, Object);
+	const ERCMask Masks = OverridenMasks == ERCMask::NoMask ? RemoteControlProperty->GetActiveMasks() : OverridenMasks;
 
-		if (OverridenMasks == ERCMask::NoMask)
-		{
-			MaskingOperation->Masks = RemoteControlProperty->GetActiveMasks();
-		}
-		else
-		{
-			MaskingOperation->Masks = OverridenMasks;
-		}
+	TArray<FRCObjectReference> ObjectRefs;
+	TArray<TSharedRef<FRCMaskingOperation>> MaskingOperations;
+	for (UObject* Object : RemoteControlProperty->GetBoundObjects())
+	{
+		IRemoteControlModule::Get().ResolveObjectProperty(ObjectRef.Access, Object, ObjectRef.PropertyPathInfo, ObjectRef);
+		ObjectRefs.Add(ObjectRef);
 
-		// Cache the values.
-		IRemoteControlModule::Get().PerformMasking(MaskingOperation.ToSharedRef());
+		TSharedRef<FRCMaskingOperation> MaskingOperation = MakeShared<FRCMaskingOperation>(ObjectRef.PropertyPathInfo, Object);
+		MaskingOperation->Masks = Masks;
+		MaskingOperations.Add(MaskingOperation);
+	}
 
-		// Set properties after interpolation
-		TArray<uint8> InterpolatedBuffer;
-		if (GetInterpolatedPropertyBuffer(Property, InProtocolValue, InterpolatedBuffer))
-		{
-			FMemoryReader MemoryReader(InterpolatedBuffer);
-			FCborStructDeserializerBackend CborStructDeserializerBackend(MemoryReader);
-			bSuccess &= IRemoteControlModule::Get().SetObjectProperties(ObjectRef, CborStructDeserializerBackend, ERCPayloadType::Cbor, InterpolatedBuffer);
+	// Cache the values.
+	IRemoteControlModule::Get().PerformBatchedMasking(MaskingOperations);
 
-			// Apply the masked the values.
-			IRemoteControlModule::Get().PerformMasking(MaskingOperation.ToSharedRef());
-		}
+	// Set properties after interpolation.
+	// The unmasked value still goes through SetObjectProperties, so transactions, interception and setters apply to it,
+	// and the masking pass below writes each object a second time to restore the components that aren't masked.
+	bool bSuccess = true;
+	for (const FRCObjectReference& BoundObjectRef : ObjectRefs)
+	{
+		FMemoryReader MemoryReader(InterpolatedBuffer);
+		FCborStructDeserializerBackend CborStructDeserializerBackend(MemoryReader);
+		bSuccess &= IRemoteControlModule::Get().SetObjectProperties(BoundObjectRef, CborStructDeserializerBackend, ERCPayloadType::Cbor, InterpolatedBuffer);
 	}
 
+	// Apply the masked values.
+	IRemoteControlModule::Get().PerformBatchedMasking(MaskingOperations);
+
 	return bSuccess;
 }
 
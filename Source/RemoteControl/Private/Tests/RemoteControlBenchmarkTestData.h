@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "RemoteControlBenchmarkTestData.generated.h"
+
+USTRUCT()
+struct FRemoteControlBenchmarkLeafStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	float Value = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	FVector Vector = FVector(1.0f, 2.0f, 3.0f);
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	FLinearColor Color = FLinearColor(0.1f, 0.2f, 0.3f, 1.0f);
+};
+
+USTRUCT()
+struct FRemoteControlBenchmarkNestedStruct
+{
+	GENERATED_BODY()
+
+	FRemoteControlBenchmarkNestedStruct()
+	{
+		LeafArray.SetNum(8);
+	}
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	FRemoteControlBenchmarkLeafStruct Leaf;
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	TArray<FRemoteControlBenchmarkLeafStruct> LeafArray;
+};
+
+USTRUCT()
+struct FRemoteControlBenchmarkOuterStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	FRemoteControlBenchmarkNestedStruct Nested;
+};
+
+/** Object holding the kinds of properties benchmarked: scalars, structs, arrays, maps and nested structs. */
+UCLASS()
+class URemoteControlBenchmarkTestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	URemoteControlBenchmarkTestObject()
+	{
+		for (int32 Index = 0; Index < 64; ++Index)
+		{
+			FloatArray.Add(static_cast<float>(Index));
+		}
+
+		for (int32 Index = 0; Index < 16; ++Index)
+		{
+			ColorMap.Add(FString::Printf(TEXT("Key%d"), Index), FLinearColor(Index / 16.0f, 0.5f, 0.5f, 1.0f));
+		}
+	}
+
+	static const FName GetFloatWithSetterValuePropertyName()
+	{
+		return GET_MEMBER_NAME_CHECKED(URemoteControlBenchmarkTestObject, FloatWithSetterValue);
+	}
+
+	UFUNCTION(BlueprintGetter)
+	float GetFloatWithSetterValue() { return FloatWithSetterValue; }
+
+	UFUNCTION(BlueprintSetter)
+	void SetFloatWithSetterValue(const float NewValue) { FloatWithSetterValue = NewValue; }
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	float FloatValue = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	FVector VectorValue = FVector(10.0f, 20.0f, 30.0f);
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	TArray<float> FloatArray;
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	TMap<FString, FLinearColor> ColorMap;
+
+	UPROPERTY(EditAnywhere, Category = "RC")
+	FRemoteControlBenchmarkOuterStruct OuterStruct;
+
+private:
+	UPROPERTY(EditAnywhere, Category = "RC", BlueprintGetter = GetFloatWithSetterValue, BlueprintSetter = SetFloatWithSetterValue)
+	float FloatWithSetterValue = 0.5f;
+};
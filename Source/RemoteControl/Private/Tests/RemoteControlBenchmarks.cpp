@@ -0,0 +1,435 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "Backends/CborStructDeserializerBackend.h"
+#include "Backends/CborStructSerializerBackend.h"
+#include "Backends/JsonStructDeserializerBackend.h"
+#include "Backends/JsonStructSerializerBackend.h"
+
+#include "IRemoteControlModule.h"
+#include "RemoteControlBenchmarkTestData.h"
+#include "RemoteControlModule.h"
+#include "RemoteControlPreset.h"
+
+#include <atomic>
+
+/**
+ * Microbenchmarks of the primitives the remote control read and write paths are built on.
+ * They are filtered as performance tests and report ns/op and allocations/op, both as test info and telemetry,
+ * so changes to these functions can be measured, ie. with: -ExecCmds="Automation RunTests Plugins.RemoteControl.Benchmark" -nullrhi
+ */
+namespace RemoteControlBenchmark
+{
+	/** Time spent finding how many iterations to run. */
+	constexpr double CalibrationSeconds = 0.05;
+
+	/** Time an operation is measured for. */
+	constexpr double MeasureSeconds = 0.25;
+
+	constexpr uint64 MaxIterations = 1 << 24;
+
+	/** Allocator forwarding to the engine allocator and counting the allocations made from the measuring thread. */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		void StartCounting()
+		{
+			Count = 0;
+			CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+		}
+
+		uint64 StopCounting()
+		{
+			CountingThreadId = 0;
+			return Count;
+		}
+
+		//~ Begin FMalloc interface
+		virtual void* Malloc(SIZE_T Size, uint32 Alignment) override { CountAllocation(); return InnerMalloc->Malloc(Size, Alignment); }
+		virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override { CountAllocation(); return InnerMalloc->TryMalloc(Size, Alignment); }
+		virtual void* MallocZeroed(SIZE_T Size, uint32 Alignment) override { CountAllocation(); return InnerMalloc->MallocZeroed(Size, Alignment); }
+		virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override { if (Size) { CountAllocation(); } return InnerMalloc->Realloc(Original, Size, Alignment); }
+		virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override { if (Size) { CountAllocation(); } return InnerMalloc->TryRealloc(Original, Size, Alignment); }
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+		//~ End FMalloc interface
+
+	private:
+		void CountAllocation()
+		{
+			if (CountingThreadId == FPlatformTLS::GetCurrentThreadId())
+			{
+				++Count;
+			}
+		}
+
+	private:
+		FMalloc* InnerMalloc;
+		std::atomic<uint32> CountingThreadId{ 0 };
+		uint64 Count = 0;
+	};
+
+	/** Installs the counting allocator for the duration of a scope. */
+	class FScopedAllocationCounter
+	{
+	public:
+		FScopedAllocationCounter()
+			: PreviousMalloc(GMalloc)
+		{
+			// Never destroyed, other threads may still be calling into it after it has been uninstalled.
+			static FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+			Counter = CountingMalloc;
+			Counter->StartCounting();
+			GMalloc = Counter;
+		}
+
+		~FScopedAllocationCounter()
+		{
+			GMalloc = PreviousMalloc;
+		}
+
+		uint64 Stop()
+		{
+			return Counter->StopCounting();
+		}
+
+	private:
+		FMalloc* PreviousMalloc;
+		FCountingMalloc* Counter;
+	};
+
+	struct FBenchmarkResult
+	{
+		uint64 Iterations = 0;
+		double NanosecondsPerOp = 0.0;
+		double AllocationsPerOp = 0.0;
+		bool bSucceeded = true;
+	};
+
+	/**
+	 * Run an operation enough times to get a stable measurement.
+	 * @param Operation Returns whether the operation succeeded.
+	 */
+	template<typename OperationType>
+	FBenchmarkResult Measure(OperationType&& Operation)
+	{
+		FBenchmarkResult Result;
+
+		// Double the iteration count until the calibration time is reached, which also warms caches and lazily initialized state.
+		uint64 Iterations = 1;
+		for (;;)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (uint64 Index = 0; Index < Iterations; ++Index)
+			{
+				Result.bSucceeded &= Operation();
+			}
+
+			const double Elapsed = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			if (Elapsed >= CalibrationSeconds || Iterations >= MaxIterations)
+			{
+				Iterations = FMath::Clamp<uint64>(static_cast<uint64>(Iterations * MeasureSeconds / FMath::Max(Elapsed, UE_DOUBLE_SMALL_NUMBER)), 1, MaxIterations);
+				break;
+			}
+
+			Iterations *= 2;
+		}
+
+		uint64 Allocations = 0;
+		uint64 ElapsedCycles = 0;
+		{
+			FScopedAllocationCounter AllocationCounter;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (uint64 Index = 0; Index < Iterations; ++Index)
+			{
+				Result.bSucceeded &= Operation();
+			}
+			ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+			Allocations = AllocationCounter.Stop();
+		}
+
+		Result.Iterations = Iterations;
+		Result.NanosecondsPerOp = FPlatformTime::ToSeconds64(ElapsedCycles) * 1e9 / Iterations;
+		Result.AllocationsPerOp = static_cast<double>(Allocations) / Iterations;
+		return Result;
+	}
+
+	void Report(FAutomationTestBase& Test, const FString& Name, const FBenchmarkResult& Result)
+	{
+		Test.TestTrue(FString::Printf(TEXT("%s succeeds"), *Name), Result.bSucceeded);
+		Test.AddInfo(FString::Printf(TEXT("%s: %.1f ns/op, %.2f allocs/op (%llu iterations)"), *Name, Result.NanosecondsPerOp, Result.AllocationsPerOp, Result.Iterations));
+		Test.AddTelemetryData(Name + TEXT(".NsPerOp"), Result.NanosecondsPerOp);
+		Test.AddTelemetryData(Name + TEXT(".AllocsPerOp"), Result.AllocationsPerOp);
+	}
+
+	struct FBenchmarkPath
+	{
+		const TCHAR* Name;
+		const TCHAR* Path;
+	};
+
+	/** Scalar, struct, array and map properties at increasing nesting depths. */
+	const FBenchmarkPath BenchmarkPaths[] =
+	{
+		{ TEXT("Scalar"), TEXT("FloatValue") },
+		{ TEXT("Struct"), TEXT("VectorValue") },
+		{ TEXT("Array"), TEXT("FloatArray") },
+		{ TEXT("ArrayElement"), TEXT("FloatArray[32]") },
+		{ TEXT("Map"), TEXT("ColorMap") },
+		{ TEXT("MapValueMember"), TEXT("ColorMap[\"Key8\"].R") },
+		{ TEXT("NestedStructDepth3"), TEXT("OuterStruct.Nested.Leaf") },
+		{ TEXT("NestedScalarDepth4"), TEXT("OuterStruct.Nested.Leaf.Value") },
+		{ TEXT("NestedArrayDepth5"), TEXT("OuterStruct.Nested.LeafArray[3].Color.G") }
+	};
+
+	/** Paths whose values can be combined by delta operations. */
+	const FBenchmarkPath DeltaPaths[] =
+	{
+		{ TEXT("Scalar"), TEXT("FloatValue") },
+		{ TEXT("Struct"), TEXT("VectorValue") },
+		{ TEXT("NestedStructDepth3"), TEXT("OuterStruct.Nested.Leaf") },
+		{ TEXT("NestedScalarDepth4"), TEXT("OuterStruct.Nested.Leaf.Value") }
+	};
+
+	bool ResolveObjectReference(FAutomationTestBase& Test, ERCAccess Access, UObject* Object, const FString& Path, FRCObjectReference& OutObjectRef)
+	{
+		FString ErrorText;
+		if (!IRemoteControlModule::Get().ResolveObjectProperty(Access, Object, FRCFieldPathInfo{ Path }, OutObjectRef, &ErrorText))
+		{
+			Test.AddError(FString::Printf(TEXT("Could not resolve %s: %s"), *Path, *ErrorText));
+			return false;
+		}
+
+		return true;
+	}
+
+	/** Serialize the current value of a property to use as a payload when setting it. */
+	TArray<uint8> MakePayload(const FRCObjectReference& ObjectRef, ERCPayloadType PayloadType)
+	{
+		TArray<uint8> Payload;
+		FMemoryWriter Writer(Payload);
+		if (PayloadType == ERCPayloadType::Cbor)
+		{
+			FCborStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
+			IRemoteControlModule::Get().GetObjectProperties(ObjectRef, SerializerBackend);
+		}
+		else
+		{
+			FJsonStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
+			IRemoteControlModule::Get().GetObjectProperties(ObjectRef, SerializerBackend);
+		}
+		return Payload;
+	}
+
+	/** Benchmark setting a property from a payload, optionally passing the payload on to interceptors. */
+	void BenchmarkSetObjectProperties(FAutomationTestBase& Test, const FString& Name, UObject* Object, const FString& Path, ERCAccess Access, ERCPayloadType PayloadType, bool bIncludeInterceptPayload)
+	{
+		FRCObjectReference ObjectRef;
+		if (!ResolveObjectReference(Test, Access, Object, Path, ObjectRef))
+		{
+			return;
+		}
+
+		const TArray<uint8> Payload = MakePayload(ObjectRef, PayloadType);
+		const TArray<uint8> InterceptPayload = bIncludeInterceptPayload ? Payload : TArray<uint8>();
+
+		Report(Test, Name, Measure([&ObjectRef, &Payload, &InterceptPayload, PayloadType]()
+		{
+			FMemoryReader Reader(Payload);
+			if (PayloadType == ERCPayloadType::Cbor)
+			{
+				FCborStructDeserializerBackend DeserializerBackend(Reader);
+				return IRemoteControlModule::Get().SetObjectProperties(ObjectRef, DeserializerBackend, PayloadType, InterceptPayload);
+			}
+
+			FJsonStructDeserializerBackend DeserializerBackend(Reader);
+			return IRemoteControlModule::Get().SetObjectProperties(ObjectRef, DeserializerBackend, PayloadType, InterceptPayload);
+		}));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlResolvePathBenchmark, "Plugins.RemoteControl.Benchmark.FieldPathResolve", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FRemoteControlResolvePathBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlBenchmark;
+
+	TStrongObjectPtr<URemoteControlBenchmarkTestObject> TestObject{ NewObject<URemoteControlBenchmarkTestObject>() };
+
+	for (const FBenchmarkPath& BenchmarkPath : BenchmarkPaths)
+	{
+		FRCFieldPathInfo FieldPath{ BenchmarkPath.Path };
+		Report(*this, FString::Printf(TEXT("Resolve.%s"), BenchmarkPath.Name), Measure([&FieldPath, &TestObject]()
+		{
+			return FieldPath.Resolve(TestObject.Get());
+		}));
+
+		// Parsing is part of resolving a path received from a request.
+		Report(*this, FString::Printf(TEXT("ParseAndResolve.%s"), BenchmarkPath.Name), Measure([Path = BenchmarkPath.Path, &TestObject]()
+		{
+			FRCFieldPathInfo ParsedPath{ Path };
+			return ParsedPath.Resolve(TestObject.Get());
+		}));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlResolveObjectPropertyBenchmark, "Plugins.RemoteControl.Benchmark.ResolveObjectProperty", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FRemoteControlResolveObjectPropertyBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlBenchmark;
+
+	TStrongObjectPtr<URemoteControlBenchmarkTestObject> TestObject{ NewObject<URemoteControlBenchmarkTestObject>() };
+
+	for (const FBenchmarkPath& BenchmarkPath : BenchmarkPaths)
+	{
+		const FRCFieldPathInfo FieldPath{ BenchmarkPath.Path };
+		Report(*this, FString::Printf(TEXT("ResolveObjectProperty.%s"), BenchmarkPath.Name), Measure([&FieldPath, &TestObject]()
+		{
+			FRCObjectReference ObjectRef;
+			return IRemoteControlModule::Get().ResolveObjectProperty(ERCAccess::READ_ACCESS, TestObject.Get(), FieldPath, ObjectRef);
+		}));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlGetObjectPropertiesBenchmark, "Plugins.RemoteControl.Benchmark.GetObjectProperties", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FRemoteControlGetObjectPropertiesBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlBenchmark;
+
+	TStrongObjectPtr<URemoteControlBenchmarkTestObject> TestObject{ NewObject<URemoteControlBenchmarkTestObject>() };
+
+	TArray<uint8> Buffer;
+	for (const FBenchmarkPath& BenchmarkPath : BenchmarkPaths)
+	{
+		FRCObjectReference ObjectRef;
+		if (!ResolveObjectReference(*this, ERCAccess::READ_ACCESS, TestObject.Get(), BenchmarkPath.Path, ObjectRef))
+		{
+			continue;
+		}
+
+		Report(*this, FString::Printf(TEXT("GetObjectProperties.Json.%s"), BenchmarkPath.Name), Measure([&ObjectRef, &Buffer]()
+		{
+			Buffer.Reset();
+			FMemoryWriter Writer(Buffer);
+			FJsonStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
+			return IRemoteControlModule::Get().GetObjectProperties(ObjectRef, SerializerBackend);
+		}));
+
+		Report(*this, FString::Printf(TEXT("GetObjectProperties.Cbor.%s"), BenchmarkPath.Name), Measure([&ObjectRef, &Buffer]()
+		{
+			Buffer.Reset();
+			FMemoryWriter Writer(Buffer);
+			FCborStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
+			return IRemoteControlModule::Get().GetObjectProperties(ObjectRef, SerializerBackend);
+		}));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlSetObjectPropertiesBenchmark, "Plugins.RemoteControl.Benchmark.SetObjectProperties", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FRemoteControlSetObjectPropertiesBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlBenchmark;
+
+	TStrongObjectPtr<URemoteControlBenchmarkTestObject> TestObject{ NewObject<URemoteControlBenchmarkTestObject>() };
+
+	for (const FBenchmarkPath& BenchmarkPath : BenchmarkPaths)
+	{
+		BenchmarkSetObjectProperties(*this, FString::Printf(TEXT("SetObjectProperties.Json.%s"), BenchmarkPath.Name), TestObject.Get(), BenchmarkPath.Path, ERCAccess::WRITE_ACCESS, ERCPayloadType::Json, false);
+		BenchmarkSetObjectProperties(*this, FString::Printf(TEXT("SetObjectProperties.Cbor.%s"), BenchmarkPath.Name), TestObject.Get(), BenchmarkPath.Path, ERCAccess::WRITE_ACCESS, ERCPayloadType::Cbor, false);
+	}
+
+	// Passing the payload runs the interception and allowed property checks.
+	BenchmarkSetObjectProperties(*this, TEXT("SetObjectProperties.Intercepted.Scalar"), TestObject.Get(), TEXT("FloatValue"), ERCAccess::WRITE_ACCESS, ERCPayloadType::Json, true);
+	BenchmarkSetObjectProperties(*this, TEXT("SetObjectProperties.Intercepted.NestedScalarDepth4"), TestObject.Get(), TEXT("OuterStruct.Nested.Leaf.Value"), ERCAccess::WRITE_ACCESS, ERCPayloadType::Json, true);
+
+	BenchmarkSetObjectProperties(*this, TEXT("SetObjectProperties.Transaction.Scalar"), TestObject.Get(), TEXT("FloatValue"), ERCAccess::WRITE_TRANSACTION_ACCESS, ERCPayloadType::Json, false);
+	BenchmarkSetObjectProperties(*this, TEXT("SetObjectProperties.Transaction.NestedScalarDepth4"), TestObject.Get(), TEXT("OuterStruct.Nested.Leaf.Value"), ERCAccess::WRITE_TRANSACTION_ACCESS, ERCPayloadType::Json, false);
+
+	// Properties with setters are modified through a function call.
+	const FString SetterPath = URemoteControlBenchmarkTestObject::GetFloatWithSetterValuePropertyName().ToString();
+	BenchmarkSetObjectProperties(*this, TEXT("SetObjectProperties.Setter"), TestObject.Get(), SetterPath, ERCAccess::WRITE_ACCESS, ERCPayloadType::Json, false);
+	BenchmarkSetObjectProperties(*this, TEXT("SetObjectProperties.Setter.Intercepted"), TestObject.Get(), SetterPath, ERCAccess::WRITE_ACCESS, ERCPayloadType::Json, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlDeltaModificationBenchmark, "Plugins.RemoteControl.Benchmark.DeserializeDeltaModificationData", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FRemoteControlDeltaModificationBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlBenchmark;
+
+	TStrongObjectPtr<URemoteControlBenchmarkTestObject> TestObject{ NewObject<URemoteControlBenchmarkTestObject>() };
+
+	TArray<uint8> DeltaData;
+	for (const FBenchmarkPath& BenchmarkPath : DeltaPaths)
+	{
+		FRCObjectReference ObjectRef;
+		if (!ResolveObjectReference(*this, ERCAccess::WRITE_ACCESS, TestObject.Get(), BenchmarkPath.Path, ObjectRef))
+		{
+			continue;
+		}
+
+		const TArray<uint8> Payload = MakePayload(ObjectRef, ERCPayloadType::Json);
+		Report(*this, FString::Printf(TEXT("DeserializeDeltaModificationData.%s"), BenchmarkPath.Name), Measure([&ObjectRef, &Payload, &DeltaData]()
+		{
+			FMemoryReader Reader(Payload);
+			FJsonStructDeserializerBackend DeserializerBackend(Reader);
+			return FRemoteControlModule::DeserializeDeltaModificationData(ObjectRef, DeserializerBackend, ERCModifyOperation::ADD, DeltaData);
+		}));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlGetBoundObjectsBenchmark, "Plugins.RemoteControl.Benchmark.GetBoundObjects", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FRemoteControlGetBoundObjectsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlBenchmark;
+
+	TStrongObjectPtr<URemoteControlPreset> Preset{ NewObject<URemoteControlPreset>() };
+	TStrongObjectPtr<URemoteControlBenchmarkTestObject> TestObject{ NewObject<URemoteControlBenchmarkTestObject>() };
+
+	for (const FBenchmarkPath& BenchmarkPath : BenchmarkPaths)
+	{
+		TSharedPtr<FRemoteControlProperty> RCProperty = Preset->ExposeProperty(TestObject.Get(), FRCFieldPathInfo{ BenchmarkPath.Path }).Pin();
+		if (!RCProperty)
+		{
+			AddError(FString::Printf(TEXT("Could not expose %s"), BenchmarkPath.Path));
+			continue;
+		}
+
+		Report(*this, FString::Printf(TEXT("GetBoundObjects.%s"), BenchmarkPath.Name), Measure([&RCProperty]()
+		{
+			return RCProperty->GetBoundObjects().Num() == 1;
+		}));
+	}
+
+	return true;
+}
@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "Factories/IRemoteControlMaskingFactory.h"
+#include "IRemoteControlModule.h"
+#include "RemoteControlTestData.h"
+
+namespace RemoteControlMaskingTest
+{
+	/**
+	 * Masks a property of the test object the way protocol bindings do: the value is cached, overwritten with the new value,
+	 * then the components that aren't masked are restored from the cache.
+	 */
+	template<typename StructType>
+	StructType ApplyMask(URemoteControlMaskingTestObject* InTestObject, StructType& InOutProperty, FName InPropertyName, const StructType& InOldValue, const StructType& InNewValue, ERCMask InMasks)
+	{
+		InOutProperty = InOldValue;
+
+		TSharedRef<FRCMaskingOperation> MaskingOperation = MakeShared<FRCMaskingOperation>(FRCFieldPathInfo{ InPropertyName.ToString() }, InTestObject);
+		MaskingOperation->Masks = InMasks;
+
+		IRemoteControlModule::Get().PerformMasking(MaskingOperation);
+		InOutProperty = InNewValue;
+		IRemoteControlModule::Get().PerformMasking(MaskingOperation);
+
+		return InOutProperty;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlMaskingTest, "Plugins.RemoteControl.Masking", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FRemoteControlMaskingTest::RunTest(const FString& Parameters)
+{
+	using namespace RemoteControlMaskingTest;
+
+	TStrongObjectPtr<URemoteControlMaskingTestObject> TestObject{ NewObject<URemoteControlMaskingTestObject>() };
+	URemoteControlMaskingTestObject* Object = TestObject.Get();
+
+	// Vectors, lanes map to X, Y, Z and W
+	const FVector OldVector(1.0, 2.0, 3.0);
+	const FVector NewVector(10.0, 20.0, 30.0);
+	TestTrue(TEXT("Vector Y is masked."), ApplyMask(Object, Object->Vector, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Vector), OldVector, NewVector, ERCMask::MaskB).Equals(FVector(1.0, 20.0, 3.0)));
+	TestTrue(TEXT("Vector X and Z are masked."), ApplyMask(Object, Object->Vector, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Vector), OldVector, NewVector, ERCMask::MaskA | ERCMask::MaskC).Equals(FVector(10.0, 2.0, 30.0)));
+
+	const FVector4 OldVector4(1.0, 2.0, 3.0, 4.0);
+	const FVector4 NewVector4(10.0, 20.0, 30.0, 40.0);
+	TestTrue(TEXT("Vector4 W is masked."), ApplyMask(Object, Object->Vector4, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Vector4), OldVector4, NewVector4, ERCMask::MaskD).Equals(FVector4(1.0, 2.0, 3.0, 40.0)));
+
+	// Rotators, lanes map to Roll, Pitch and Yaw
+	const FRotator OldRotator(10.0, 20.0, 30.0);
+	const FRotator NewRotator(40.0, 50.0, 60.0);
+	TestTrue(TEXT("Mask A is the rotator Roll."), ApplyMask(Object, Object->Rotator, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Rotator), OldRotator, NewRotator, ERCMask::MaskA).Equals(FRotator(10.0, 20.0, 60.0)));
+	TestTrue(TEXT("Mask B is the rotator Pitch."), ApplyMask(Object, Object->Rotator, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Rotator), OldRotator, NewRotator, ERCMask::MaskB).Equals(FRotator(40.0, 20.0, 30.0)));
+	TestTrue(TEXT("Mask C is the rotator Yaw."), ApplyMask(Object, Object->Rotator, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Rotator), OldRotator, NewRotator, ERCMask::MaskC).Equals(FRotator(10.0, 50.0, 30.0)));
+
+	// Integer vectors are cast back exactly, including values at the limits of int32
+	const FIntVector OldIntVector(-7, MAX_int32, 3);
+	const FIntVector NewIntVector(MIN_int32, 5, MAX_int32);
+	TestTrue(TEXT("IntVector X and Z are masked."), ApplyMask(Object, Object->IntVector, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, IntVector), OldIntVector, NewIntVector, ERCMask::MaskA | ERCMask::MaskC) == FIntVector(MIN_int32, MAX_int32, MAX_int32));
+	TestTrue(TEXT("IntVector Y is masked."), ApplyMask(Object, Object->IntVector, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, IntVector), OldIntVector, NewIntVector, ERCMask::MaskB) == FIntVector(-7, 5, 3));
+
+	const FIntVector4 OldIntVector4(1, 2, 3, -4);
+	const FIntVector4 NewIntVector4(10, 20, 30, MIN_int32);
+	TestTrue(TEXT("IntVector4 W is masked."), ApplyMask(Object, Object->IntVector4, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, IntVector4), OldIntVector4, NewIntVector4, ERCMask::MaskD) == FIntVector4(1, 2, 3, MIN_int32));
+	TestTrue(TEXT("IntVector4 X is masked."), ApplyMask(Object, Object->IntVector4, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, IntVector4), OldIntVector4, NewIntVector4, ERCMask::MaskA) == FIntVector4(10, 2, 3, -4));
+
+	// Colors, lanes map to R, G, B, and A for linear colors only
+	const FColor OldColor(10, 20, 30, 40);
+	const FColor NewColor(255, 0, 220, 250);
+	TestEqual(TEXT("Color R and B round-trip, alpha keeps the new value."), ApplyMask(Object, Object->Color, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Color), OldColor, NewColor, ERCMask::MaskA | ERCMask::MaskC), FColor(255, 20, 220, 250));
+	TestEqual(TEXT("Color G round-trips."), ApplyMask(Object, Object->Color, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Color), OldColor, NewColor, ERCMask::MaskB), FColor(10, 0, 30, 250));
+
+	const FLinearColor OldLinearColor(0.1f, 0.2f, 0.3f, 0.4f);
+	const FLinearColor NewLinearColor(0.5f, 0.6f, 0.7f, 0.8f);
+	TestTrue(TEXT("LinearColor A is masked."), ApplyMask(Object, Object->LinearColor, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, LinearColor), OldLinearColor, NewLinearColor, ERCMask::MaskD).Equals(FLinearColor(0.1f, 0.2f, 0.3f, 0.8f)));
+	TestTrue(TEXT("LinearColor R and G are masked."), ApplyMask(Object, Object->LinearColor, GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, LinearColor), OldLinearColor, NewLinearColor, ERCMask::MaskA | ERCMask::MaskB).Equals(FLinearColor(0.5f, 0.6f, 0.3f, 0.4f)));
+
+	// Batched operations apply each operation's own masks
+	Object->Vector = OldVector;
+	Object->Rotator = OldRotator;
+
+	TSharedRef<FRCMaskingOperation> VectorOperation = MakeShared<FRCMaskingOperation>(FRCFieldPathInfo{ GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Vector).ToString() }, Object);
+	VectorOperation->Masks = ERCMask::MaskA;
+	TSharedRef<FRCMaskingOperation> RotatorOperation = MakeShared<FRCMaskingOperation>(FRCFieldPathInfo{ GET_MEMBER_NAME_CHECKED(URemoteControlMaskingTestObject, Rotator).ToString() }, Object);
+	RotatorOperation->Masks = ERCMask::MaskC;
+	const TArray<TSharedRef<FRCMaskingOperation>> MaskingOperations = { VectorOperation, RotatorOperation };
+
+	IRemoteControlModule::Get().PerformBatchedMasking(MaskingOperations);
+	Object->Vector = NewVector;
+	Object->Rotator = NewRotator;
+	IRemoteControlModule::Get().PerformBatchedMasking(MaskingOperations);
+
+	TestTrue(TEXT("Batched vector X is masked."), Object->Vector.Equals(FVector(10.0, 2.0, 3.0)));
+	TestTrue(TEXT("Batched rotator Yaw is masked."), Object->Rotator.Equals(FRotator(10.0, 50.0, 30.0)));
+
+	return true;
+}
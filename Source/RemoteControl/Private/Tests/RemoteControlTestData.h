@@ -105,3 +105,31 @@ public:
 	UPROPERTY()
 	TMap<FString, FColor> StringColorMap;
 };
+
+UCLASS()
+class URemoteControlMaskingTestObject : public UObject
+{
+public:
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector Vector = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector4 Vector4 = FVector4(0.0, 0.0, 0.0, 0.0);
+
+	UPROPERTY()
+	FIntVector IntVector = FIntVector::ZeroValue;
+
+	UPROPERTY()
+	FIntVector4 IntVector4 = FIntVector4(0, 0, 0, 0);
+
+	UPROPERTY()
+	FRotator Rotator = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FColor Color = FColor::Black;
+
+	UPROPERTY()
+	FLinearColor LinearColor = FLinearColor::Black;
+};
@@ -2,12 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
+#include "RemoteControlBinding.h"
+#include "RemoteControlExposeRegistry.h"
 #include "RemoteControlPreset.h"
 #include "RemoteControlTestData.h"
 #include "StructDeserializer.h"
 #include "StructSerializer.h"
 #include "Backends/CborStructDeserializerBackend.h"
 #include "Backends/CborStructSerializerBackend.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
 #include "UObject/StrongObjectPtr.h"
 
 #define PROP_NAME(Class, Name) GET_MEMBER_NAME_CHECKED(Class, Name)
@@ -133,5 +137,203 @@ bool FRemoteControlPresetIntegrationTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlPresetBulkExposeTest, "Plugins.RemoteControl.BulkExpose", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FRemoteControlPresetBulkExposeTest::RunTest(const FString& Parameters)
+{
+	// Setup test data
+	TStrongObjectPtr<URemoteControlPreset> Preset{ NewObject<URemoteControlPreset>() };
+	TStrongObjectPtr<URemoteControlTestObject> TestObject{ NewObject<URemoteControlTestObject>() };
+
+	int32 NumEntityExposedEvents = 0;
+	int32 NumEntityUnexposedEvents = 0;
+	TArray<TArray<FGuid>> EntitiesExposedEvents;
+	TArray<TArray<FGuid>> EntitiesUnexposedEvents;
+	Preset->OnEntityExposed().AddLambda([&NumEntityExposedEvents](URemoteControlPreset*, const FGuid&) { ++NumEntityExposedEvents; });
+	Preset->OnEntityUnexposed().AddLambda([&NumEntityUnexposedEvents](URemoteControlPreset*, const FGuid&) { ++NumEntityUnexposedEvents; });
+	Preset->OnEntitiesExposed().AddLambda([&EntitiesExposedEvents](URemoteControlPreset*, const TArray<FGuid>& EntityIds) { EntitiesExposedEvents.Add(EntityIds); });
+	Preset->OnEntitiesUnexposed().AddLambda([&EntitiesUnexposedEvents, &Preset, this](URemoteControlPreset*, const TArray<FGuid>& EntityIds)
+	{
+		for (const FGuid& EntityId : EntityIds)
+		{
+			TestTrue(TEXT("Entities are still exposed when OnEntitiesUnexposed is broadcast."), Preset->IsExposed(EntityId));
+		}
+		EntitiesUnexposedEvents.Add(EntityIds);
+	});
+
+	// Execute test
+	TArray<FRemoteControlPresetExposePropertyArgs> Properties;
+	Properties.Add({ TestObject.Get(), FRCFieldPathInfo{ GET_TEST_PROP(IntArray)->GetName() } });
+	Properties.Add({ TestObject.Get(), FRCFieldPathInfo{ GET_TEST_PROP(IntSet)->GetName() } });
+	Properties.Add({ TestObject.Get(), FRCFieldPathInfo{ TEXT("InvalidPropertyName") } });
+	Properties.Add({ TestObject.Get(), FRCFieldPathInfo{ GET_TEST_PROP(IntMap)->GetName() } });
+
+	const TArray<TWeakPtr<FRemoteControlProperty>> ExposedProperties = Preset->ExposeProperties(Properties);
+
+	// Validate result
+	TestEqual(TEXT("ExposeProperties returns one result per argument."), ExposedProperties.Num(), Properties.Num());
+	TestFalse(TEXT("Properties that can't be resolved aren't exposed."), ExposedProperties[2].IsValid());
+	TestEqual(TEXT("OnEntityExposed isn't called for properties exposed in bulk."), NumEntityExposedEvents, 0);
+	TestEqual(TEXT("OnEntitiesExposed is called once."), EntitiesExposedEvents.Num(), 1);
+
+	TArray<FGuid> ExposedIds;
+	for (int32 Index : { 0, 1, 3 })
+	{
+		const TSharedPtr<FRemoteControlProperty> RCProp = ExposedProperties[Index].Pin();
+		if (!RCProp)
+		{
+			AddError(FString::Printf(TEXT("Property %s was not exposed."), *Properties[Index].FieldPath.ToString()));
+			continue;
+		}
+
+		RemoteControlTest::ValidateExposePropertyTest(*this, Preset.Get(), TestObject.Get(), RCProp->GetProperty(), *RCProp);
+		ExposedIds.Add(RCProp->GetId());
+	}
+
+	if (EntitiesExposedEvents.Num() == 1)
+	{
+		TestEqual(TEXT("OnEntitiesExposed contains the exposed entities in order."), EntitiesExposedEvents[0], ExposedIds);
+	}
+
+	if (ExposedIds.IsEmpty())
+	{
+		return false;
+	}
+
+	// Unexpose twice the same entity and one entity that isn't exposed.
+	TArray<FGuid> IdsToUnexpose = ExposedIds;
+	IdsToUnexpose.Add(ExposedIds[0]);
+	IdsToUnexpose.Add(FGuid::NewGuid());
+	Preset->Unexpose(IdsToUnexpose);
+
+	TestEqual(TEXT("OnEntityUnexposed isn't called for entities unexposed in bulk."), NumEntityUnexposedEvents, 0);
+	TestEqual(TEXT("OnEntitiesUnexposed is called once."), EntitiesUnexposedEvents.Num(), 1);
+	if (EntitiesUnexposedEvents.Num() == 1)
+	{
+		TestEqual(TEXT("OnEntitiesUnexposed only contains the exposed entities."), EntitiesUnexposedEvents[0], ExposedIds);
+	}
+
+	for (const FGuid& Id : ExposedIds)
+	{
+		TestFalse(TEXT("Entities are unexposed."), Preset->IsExposed(Id));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlPresetRegistryTest, "Plugins.RemoteControl.ExposeRegistry", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FRemoteControlPresetRegistryTest::RunTest(const FString& Parameters)
+{
+	// Setup test data
+	TStrongObjectPtr<URemoteControlPreset> Preset{ NewObject<URemoteControlPreset>() };
+	TStrongObjectPtr<URemoteControlTestObject> TestObject{ NewObject<URemoteControlTestObject>() };
+
+	auto Expose = [this, &Preset, &TestObject](FName PropertyName, const TCHAR* Label)
+	{
+		FRemoteControlPresetExposeArgs Args;
+		Args.Label = Label;
+		const TSharedPtr<FRemoteControlProperty> RCProp = Preset->ExposeProperty(TestObject.Get(), FRCFieldPathInfo{ PropertyName.ToString() }, Args).Pin();
+		TestTrue(FString::Printf(TEXT("%s is exposed."), *PropertyName.ToString()), RCProp.IsValid());
+		return RCProp ? RCProp->GetId() : FGuid();
+	};
+
+	auto TestLabel = [this, &Preset](const TCHAR* What, const FGuid& Id, const TCHAR* ExpectedLabel)
+	{
+		const TSharedPtr<const FRemoteControlEntity> Entity = Preset->GetExposedEntity(Id).Pin();
+		TestEqual(What, Entity ? Entity->GetLabel() : FName(), FName(ExpectedLabel));
+	};
+
+	// 1. Labels get the smallest free suffix
+	const FGuid IntArrayId = Expose(PROP_NAME(URemoteControlTestObject, IntArray), TEXT("Label"));
+	const FGuid IntSetId = Expose(PROP_NAME(URemoteControlTestObject, IntSet), TEXT("Label"));
+	TestLabel(TEXT("The first label is the base label."), IntArrayId, TEXT("Label"));
+	TestLabel(TEXT("Duplicate labels get a suffix."), IntSetId, TEXT("Label (1)"));
+
+	Preset->Unexpose(IntSetId);
+	const FGuid FloatArrayId = Expose(PROP_NAME(URemoteControlTestObject, FloatArray), TEXT("Label"));
+	TestLabel(TEXT("The suffix of an unexposed entity is reused."), FloatArrayId, TEXT("Label (1)"));
+
+	// 2. Renaming to an explicit suffix takes it out of order
+	TestEqual(TEXT("Renaming to a free suffixed label keeps it."), Preset->RenameExposedEntity(IntArrayId, TEXT("Label (3)")), FName(TEXT("Label (3)")));
+	const FGuid IntMapId = Expose(PROP_NAME(URemoteControlTestObject, IntMap), TEXT("Label"));
+	TestLabel(TEXT("The base label freed by a rename is reused."), IntMapId, TEXT("Label"));
+
+	const FGuid CStyleIntArrayId = Expose(PROP_NAME(URemoteControlTestObject, CStyleIntArray), TEXT("Label"));
+	const FGuid IntInnerStructMapId = Expose(PROP_NAME(URemoteControlTestObject, IntInnerStructMap), TEXT("Label"));
+	TestLabel(TEXT("The next suffix is generated."), CStyleIntArrayId, TEXT("Label (2)"));
+	TestLabel(TEXT("Suffixes taken by a rename are skipped."), IntInnerStructMapId, TEXT("Label (4)"));
+
+	// 3. Out of order suffixes, freed suffixes are reused smallest first
+	TestEqual(TEXT("Renaming past the next suffix keeps the label."), Preset->RenameExposedEntity(FloatArrayId, TEXT("Label (6)")), FName(TEXT("Label (6)")));
+	TestEqual(TEXT("Renaming to the next suffix keeps the label."), Preset->RenameExposedEntity(IntInnerStructMapId, TEXT("Label (5)")), FName(TEXT("Label (5)")));
+	TestEqual(TEXT("The smallest freed suffix is generated first."), Preset->GenerateUniqueLabel(TEXT("Label")), FName(TEXT("Label (1)")));
+
+	const FGuid StringColorMapId = Expose(PROP_NAME(URemoteControlTestObject, StringColorMap), TEXT("Label"));
+	TestLabel(TEXT("The smallest freed suffix is reused."), StringColorMapId, TEXT("Label (1)"));
+	TestEqual(TEXT("The second freed suffix is generated next."), Preset->GenerateUniqueLabel(TEXT("Label")), FName(TEXT("Label (4)")));
+	TestEqual(TEXT("Renaming to the second freed suffix keeps the label."), Preset->RenameExposedEntity(StringColorMapId, TEXT("Label (4)")), FName(TEXT("Label (4)")));
+	TestEqual(TEXT("A freed suffix taken by a rename isn't generated."), Preset->GenerateUniqueLabel(TEXT("Label")), FName(TEXT("Label (1)")));
+	TestEqual(TEXT("Renaming to the freed suffix keeps the label."), Preset->RenameExposedEntity(StringColorMapId, TEXT("Label (1)")), FName(TEXT("Label (1)")));
+	TestEqual(TEXT("The smallest freed suffix taken by a rename isn't generated."), Preset->GenerateUniqueLabel(TEXT("Label")), FName(TEXT("Label (4)")));
+	TestEqual(TEXT("Labels resolve to their entity."), Preset->GetExposedEntityId(TEXT("Label (6)")), FloatArrayId);
+
+	// 4. Type buckets
+	TestEqual(TEXT("Every exposed property is counted."), Preset->GetNumExposedEntities(FRemoteControlProperty::StaticStruct()), 6);
+	TestEqual(TEXT("Entities of derived types are counted."), Preset->GetNumExposedEntities(FRemoteControlEntity::StaticStruct()), 6);
+	TestEqual(TEXT("Entities of other types aren't counted."), Preset->GetNumExposedEntities(FRemoteControlFunction::StaticStruct()), 0);
+
+	// 5. Binding index
+	const TSharedPtr<const FRemoteControlEntity> IntMapEntity = Preset->GetExposedEntity(IntMapId).Pin();
+	URemoteControlBinding* Binding = IntMapEntity && IntMapEntity->GetBindings().Num() ? IntMapEntity->GetBindings()[0].Get() : nullptr;
+	if (!TestNotNull(TEXT("Exposed properties have a binding."), Binding))
+	{
+		return false;
+	}
+
+	auto TestEntitiesUsingBinding = [this, &Preset, Binding](const TCHAR* What, TArray<FGuid> ExpectedIds)
+	{
+		TArray<FGuid> EntityIds(Preset->Registry->GetEntitiesUsingBinding(Binding));
+		EntityIds.Sort();
+		ExpectedIds.Sort();
+		TestEqual(What, EntityIds, ExpectedIds);
+	};
+
+	TestEntitiesUsingBinding(TEXT("Properties of an object share its binding."), { IntArrayId, FloatArrayId, IntMapId, CStyleIntArrayId, IntInnerStructMapId, StringColorMapId });
+
+	// Undo restores the serialized registry, then rebuilds the indices.
+	TArray<uint8> RegistryState;
+	{
+		FObjectWriter RegistryWriter(Preset->Registry, RegistryState);
+	}
+
+	Preset->Unexpose(IntMapId);
+	TestEntitiesUsingBinding(TEXT("Unexposed entities are removed from the binding index."), { IntArrayId, FloatArrayId, CStyleIntArrayId, IntInnerStructMapId, StringColorMapId });
+	TestEqual(TEXT("Unexposed entities are removed from the type buckets."), Preset->GetNumExposedEntities(FRemoteControlProperty::StaticStruct()), 5);
+
+#if WITH_EDITOR
+	Preset->PerFrameUpdatedEntities.Reset();
+	Preset->PerFrameBindingsToClean.Add(Binding);
+	Preset->CleanUpBindings();
+	TestFalse(TEXT("Cleaning up a binding doesn't update the entities unexposed from it."), Preset->PerFrameUpdatedEntities.Contains(IntMapId));
+	TestEqual(TEXT("Cleaning up a binding updates the entities using it."), Preset->PerFrameUpdatedEntities.Num(), 5);
+
+	{
+		FObjectReader RegistryReader(Preset->Registry, RegistryState);
+	}
+	Preset->Registry->PostEditUndo();
+	TestTrue(TEXT("Undoing restores the unexposed entity."), Preset->IsExposed(IntMapId));
+	TestEntitiesUsingBinding(TEXT("Undoing restores the binding index."), { IntArrayId, FloatArrayId, IntMapId, CStyleIntArrayId, IntInnerStructMapId, StringColorMapId });
+	TestEqual(TEXT("Undoing restores the type buckets."), Preset->GetNumExposedEntities(FRemoteControlProperty::StaticStruct()), 6);
+	TestEqual(TEXT("Undoing restores the labels."), Preset->GetExposedEntityId(TEXT("Label")), IntMapId);
+	TestEqual(TEXT("Undoing restores the suffix index."), Preset->GenerateUniqueLabel(TEXT("Label")), FName(TEXT("Label (4)")));
+
+	Preset->PerFrameUpdatedEntities.Reset();
+	Preset->PerFrameBindingsToClean.Add(Binding);
+	Preset->CleanUpBindings();
+	TestTrue(TEXT("Cleaning up a binding updates the entities restored by undo."), Preset->PerFrameUpdatedEntities.Contains(IntMapId));
+#endif
+
+	return true;
+}
+
 #undef GET_TEST_PROP
 #undef PROP_NAME
@@ -76,6 +76,18 @@ public:
 	 */
 	virtual void ApplyMaskedValues(const TSharedRef<FRCMaskingOperation>& InMaskingOperation, bool bIsInteractive) = 0;
 
+	/**
+	 * Applies masked values to the given struct properties, modifying and notifying each object once per property.
+	 * @param InMaskingOperations Masking operations to perform, on properties supported by this factory.
+	 */
+	virtual void ApplyBatchedMaskedValues(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations, bool bIsInteractive)
+	{
+		for (const TSharedRef<FRCMaskingOperation>& MaskingOperation : InMaskingOperations)
+		{
+			ApplyMaskedValues(MaskingOperation, bIsInteractive);
+		}
+	}
+
 	/**
 	 * Caches premasking values from the given struct property.
 	 * @param InMaskingOperation Shared reference of the masking operation to perform.
@@ -39,6 +39,12 @@ DECLARE_DELEGATE_RetVal_TwoParams(FString /*Value*/, FEntityMetadataInitializer,
  */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPostPropertyModifiedRemotely, const FRCObjectReference& /*ObjectRef*/);
 
+/**
+ * Delegate called when an asynchronous preset resolution completes.
+ * The preset is nullptr if it could not be found or loaded.
+ */
+DECLARE_DELEGATE_OneParam(FOnPresetResolved, URemoteControlPreset* /*Preset*/);
+
 /**
  * Deserialize payload type for interception purposes
  */
@@ -318,6 +324,18 @@ public:
 	 */
 	virtual void PerformMasking(const TSharedRef<FRCMaskingOperation>& InMaskingOperation) = 0;
 
+	/**
+	 * Performs the given masking operations, the masked values of the operations sharing a factory are applied together.
+	 * @param InMaskingOperations Masking operations to be performed.
+	 */
+	virtual void PerformBatchedMasking(TConstArrayView<TSharedRef<FRCMaskingOperation>> InMaskingOperations)
+	{
+		for (const TSharedRef<FRCMaskingOperation>& MaskingOperation : InMaskingOperations)
+		{
+			PerformMasking(MaskingOperation);
+		}
+	}
+
 	/**
 	 * Register a masking factory to handle that masks the supported properties.
 	 */
@@ -489,6 +507,28 @@ public:
      */
 	virtual URemoteControlPreset* ResolvePreset(const FGuid& PresetId) const = 0;
 
+	/**
+	 * Get a preset using its name without blocking on its package being loaded.
+	 * @arg PresetName name of the preset to resolve.
+	 * @arg OnResolved called with the preset once it is loaded, immediately if it already is.
+	 */
+	virtual void ResolvePresetAsync(FName PresetName, FOnPresetResolved OnResolved) = 0;
+
+	/**
+	 * Get a preset using its id without blocking on its package being loaded.
+	 * @arg PresetId id of the preset to resolve.
+	 * @arg OnResolved called with the preset once it is loaded, immediately if it already is.
+	 */
+	virtual void ResolvePresetAsync(const FGuid& PresetId, FOnPresetResolved OnResolved) = 0;
+
+	/**
+	 * Get the time that was spent loading a preset's package.
+	 * @arg PresetId id of the preset.
+	 * @arg OutLoadTimeSeconds the load time, in seconds. For asynchronous loads, this is the time between the request and its completion.
+	 * @return false if the preset wasn't loaded by the remote control module.
+	 */
+	virtual bool GetPresetLoadTime(const FGuid& PresetId, double& OutLoadTimeSeconds) const = 0;
+
 	/**
 	 * Create a transient preset.
 	 * Make sure to call DestroyTransientPreset when done with the preset or it will stay in memory.
@@ -335,6 +335,12 @@ public:
 	/** Updates the display index of the virtual property (transaction aware) */
 	void SetDisplayIndex(const int32 InDisplayIndex);
 
+	/** Delegate called when the value is set through this virtual property. */
+	FSimpleMulticastDelegate& OnValueChanged() { return ValueChangedDelegate; }
+
+	/** Broadcasts OnValueChanged. Called by the value setters, and must be called by editors writing to the value memory directly. */
+	void NotifyValueChanged();
+
 public:
 	/** Unique property name */
 	UPROPERTY()
@@ -366,6 +372,10 @@ public:
 
 	UPROPERTY()
 	TMap<FName, FString> Metadata;
+
+private:
+	/** Called when the value is set through this virtual property. */
+	FSimpleMulticastDelegate ValueChangedDelegate;
 };
 
 /**
@@ -468,6 +478,12 @@ protected:
 	virtual const FInstancedPropertyBag* GetPropertyBagInstance() const override;
 	//~ End URCVirtualPropertyBase interface
 
+#if WITH_EDITOR
+	//~ Begin UObject interface
+	virtual void PostEditUndo() override;
+	//~ End UObject interface
+#endif
+
 private:
 	/** Instanced property bag for store a bag of properties. */
 	UPROPERTY()
@@ -10,6 +10,8 @@
 #include "RemoteControlInstanceMaterial.generated.h"
 
 class UDEditorParameterValue;
+class UMaterialEditorInstanceConstant;
+class UMaterialInstance;
 class URemoteControlBinding;
 class URemoteControlPreset;
 
@@ -58,6 +60,29 @@ public:
 	/** Store path to Material Instance */
 	UPROPERTY()
 	FSoftObjectPath InstancePath;
+
+private:
+#if WITH_EDITOR
+	/** Find the editor parameter value of this parameter, checking the cached slot first */
+	UDEditorParameterValue* FindEditorParameterValue(UMaterialInstance* InMaterialInstance);
+#endif
+
+	/** Original property path as a string, cached for path comparisons */
+	mutable FString CachedOriginalFieldPath;
+
+#if WITH_EDITOR
+	/** Material instance editor the editor parameter value was last found in */
+	TWeakObjectPtr<UMaterialEditorInstanceConstant> CachedEditorInstance;
+
+	/** Parameter group of the editor parameter value in CachedEditorInstance */
+	int32 CachedGroupIndex = INDEX_NONE;
+
+	/** Index of the editor parameter value in its parameter group */
+	int32 CachedEditorParameterIndex = INDEX_NONE;
+
+	/** Index of this parameter in the parameter values of the material instance */
+	int32 CachedParameterValueIndex = INDEX_NONE;
+#endif
 };
 
 class FRemoteControlInstanceMaterialFactory : public IRemoteControlPropertyFactory
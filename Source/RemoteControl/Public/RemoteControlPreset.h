@@ -48,6 +48,17 @@ struct REMOTECONTROL_API FRemoteControlPresetExposeArgs
 	bool bEnableEditCondition;
 };
 
+/** A property to expose with URemoteControlPreset::ExposeProperties. */
+struct FRemoteControlPresetExposePropertyArgs
+{
+	/** The object that holds the property. */
+	UObject* Object = nullptr;
+	/** The name/path to the property. */
+	FRCFieldPathInfo FieldPath;
+	/** Optional arguments used to expose the property. */
+	FRemoteControlPresetExposeArgs Args;
+};
+
 /** Arguments used to expose an entity (Actor, property, function, etc.) */
 struct REMOTECONTROL_API FRemoteControlPropertyIdArgs
 {
@@ -415,6 +426,15 @@ public:
 	 * @return The exposed property.
 	 */
 	TWeakPtr<FRemoteControlProperty> ExposeProperty(UObject* Object, FRCFieldPathInfo FieldPath, FRemoteControlPresetExposeArgs Args = FRemoteControlPresetExposeArgs());
+
+	/**
+	 * Expose a list of properties on this preset in a single operation.
+	 * The registry and layout are updated in one pass and listeners are notified once through OnEntitiesExposed,
+	 * OnEntityExposed is not called for these properties.
+	 * @param Properties The properties to expose.
+	 * @return The exposed properties, in the same order as the arguments. Properties that couldn't be exposed are left invalid.
+	 */
+	TArray<TWeakPtr<FRemoteControlProperty>> ExposeProperties(TConstArrayView<FRemoteControlPresetExposePropertyArgs> Properties);
 	
 	/**
 	 * Expose a function on this preset.
@@ -433,12 +453,12 @@ public:
 	{
 		static_assert(TIsDerivedFrom<ExposableEntityType, FRemoteControlEntity>::Value, "ExposableEntityType must derive from FRemoteControlEntity.");
 		TArray<TWeakPtr<const ExposableEntityType>> ReturnedEntities;
-		TArray<TSharedPtr<const FRemoteControlEntity>> Entities = GetEntities(ExposableEntityType::StaticStruct());
-		Algo::Transform(Entities, ReturnedEntities,
-			[](const TSharedPtr<const FRemoteControlEntity>& Entity)
-			{
-				return StaticCastSharedPtr<const ExposableEntityType>(Entity);
-			});
+		ReturnedEntities.Reserve(GetNumExposedEntities(ExposableEntityType::StaticStruct()));
+		ForEachEntity(ExposableEntityType::StaticStruct(), [&ReturnedEntities](const TSharedPtr<FRemoteControlEntity>& Entity)
+		{
+			ReturnedEntities.Add(StaticCastSharedPtr<const ExposableEntityType>(Entity));
+			return true;
+		});
 		return ReturnedEntities;
 	}
 
@@ -451,15 +471,33 @@ public:
 		static_assert(TIsDerivedFrom<ExposableEntityType, FRemoteControlEntity>::Value, "ExposableEntityType must derive from FRemoteControlEntity.");
 
 		TArray<TWeakPtr<ExposableEntityType>> ReturnedEntities;
-		TArray<TSharedPtr<FRemoteControlEntity>> Entities = GetEntities(ExposableEntityType::StaticStruct());
-		Algo::Transform(Entities, ReturnedEntities,
-			[](const TSharedPtr<FRemoteControlEntity>& Entity)
-			{
-				return StaticCastSharedPtr<ExposableEntityType>(Entity);
-			});
+		ReturnedEntities.Reserve(GetNumExposedEntities(ExposableEntityType::StaticStruct()));
+		ForEachEntity(ExposableEntityType::StaticStruct(), [&ReturnedEntities](const TSharedPtr<FRemoteControlEntity>& Entity)
+		{
+			ReturnedEntities.Add(StaticCastSharedPtr<ExposableEntityType>(Entity));
+			return true;
+		});
 		return ReturnedEntities;
 	}
 
+	/**
+	 * Call a function on each exposed entity of a certain type, without building an array of them.
+	 * Entities must not be exposed or unexposed from the callback.
+	 * @param Callback Called for each entity, return false to stop iterating.
+	 */
+	template <typename ExposableEntityType = FRemoteControlEntity>
+	void ForEachExposedEntity(TFunctionRef<bool(const TSharedPtr<ExposableEntityType>&)> Callback) const
+	{
+		static_assert(TIsDerivedFrom<ExposableEntityType, FRemoteControlEntity>::Value, "ExposableEntityType must derive from FRemoteControlEntity.");
+		ForEachEntity(ExposableEntityType::StaticStruct(), [&Callback](const TSharedPtr<FRemoteControlEntity>& Entity)
+		{
+			return Callback(StaticCastSharedPtr<ExposableEntityType>(Entity));
+		});
+	}
+
+	/** Get the number of exposed entities of a certain type, entities of derived types included. */
+	int32 GetNumExposedEntities(const UScriptStruct* EntityType) const;
+
 	TArray<TWeakPtr<FRemoteControlEntity>> GetExposedEntities(UScriptStruct* EntityType)
 	{
 		TArray<TWeakPtr<FRemoteControlEntity>> ReturnedEntities;
@@ -591,6 +629,14 @@ public:
 	 */
 	void Unexpose(const FGuid& EntityId);
 
+	/**
+	 * Unexpose a list of entities from the preset in a single operation.
+	 * Listeners are notified once through OnEntitiesUnexposed before the entities are removed,
+	 * OnEntityUnexposed is not called for these entities.
+	 * @param EntityIds The ids of the entities to unexpose.
+	 */
+	void Unexpose(TConstArrayView<FGuid> EntityIds);
+
 	/** Cache this preset's layout data. */
 	void CacheLayoutData();
 
@@ -633,6 +679,14 @@ public:
 	FOnPresetEntityEvent& OnEntityExposed() { return OnEntityExposedDelegate; }
 	FOnPresetEntityEvent& OnEntityUnexposed() { return OnEntityUnexposedDelegate; }
 
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPresetEntitiesEvent, URemoteControlPreset* /*Preset*/, const TArray<FGuid>& /*EntityIds*/);
+	/**
+	 * Delegates called once for all the entities of a bulk expose or unexpose operation, see ExposeProperties and Unexpose.
+	 * Listeners of OnEntityExposed and OnEntityUnexposed should also listen to these to be notified of every entity.
+	 */
+	FOnPresetEntitiesEvent& OnEntitiesExposed() { return OnEntitiesExposedDelegate; }
+	FOnPresetEntitiesEvent& OnEntitiesUnexposed() { return OnEntitiesUnexposedDelegate; }
+
 	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPresetExposedPropertiesModified, URemoteControlPreset* /*Preset*/, const TSet<FGuid>& /* ModifiedProperties */);
 	/**
 	 *  Delegate called with the list of exposed property that were modified in the last frame.
@@ -802,6 +856,12 @@ private:
 	//~ Callbacks called by the object targets
 	void OnExpose(const FExposeInfo& Info);
 	void OnUnexpose(FGuid UnexposedFieldId);
+
+	/** Remove an entity from the registry, the layout and the field caches. */
+	void RemoveExposedEntity(const FGuid& EntityId);
+
+	/** End the ongoing bulk operation and send the layout notifications it deferred. */
+	void EndBulkOperation();
 	
 	//~ Cache operations.
 	void CacheFieldLayoutData();
@@ -848,6 +908,7 @@ private:
 	TSharedPtr<FRemoteControlEntity> FindEntityById(const FGuid& EntityId, const UScriptStruct* EntityType = FRemoteControlEntity::StaticStruct());
 	TArray<TSharedPtr<FRemoteControlEntity>> GetEntities(UScriptStruct* EntityType);
 	TArray<TSharedPtr<const FRemoteControlEntity>> GetEntities(UScriptStruct* EntityType) const;
+	void ForEachEntity(const UScriptStruct* EntityType, TFunctionRef<bool(const TSharedPtr<FRemoteControlEntity>&)> Callback) const;
 
 public:	
 	/** Expose an entity in the registry. */
@@ -940,6 +1001,10 @@ private:
 	FOnPresetEntityEvent OnEntityExposedDelegate;
 	/** Delegate triggered when an entity is unexposed from the preset. */
 	FOnPresetEntityEvent OnEntityUnexposedDelegate;
+	/** Delegate triggered when entities are exposed in bulk. */
+	FOnPresetEntitiesEvent OnEntitiesExposedDelegate;
+	/** Delegate triggered when entities are unexposed in bulk from the preset. */
+	FOnPresetEntitiesEvent OnEntitiesUnexposedDelegate;
 	/** Delegate triggered when entities are modified and may need to be re-resolved. */
 	FOnPresetEntitiesUpdatedEvent OnEntitiesUpdatedDelegate;
 	/** Delegate triggered when an Entity is rebound */
@@ -1004,6 +1069,15 @@ private:
 	/** Used for OnObjectPropertyChanged to avoid being called by itself. */
 	bool bReentryGuard = false;
 
+	/** Whether a bulk expose or unexpose is ongoing, per entity and layout notifications are deferred until it completes. */
+	bool bOngoingBulkOperation = false;
+
+	/** Whether the layout was modified by the ongoing bulk operation. */
+	bool bBulkLayoutModified = false;
+
+	/** Ids of the entities exposed by the ongoing bulk operation. */
+	TArray<FGuid> BulkExposedEntityIds;
+
 	/** Holds manager that handles rebinding unbound entities upon load or map change. */
 	TPimplPtr<FRemoteControlPresetRebindingManager> RebindingManager;
 
@@ -1068,4 +1142,5 @@ private:
 	friend FRemoteControlPresetLayout;
 	friend FRemoteControlEntity;
 	friend class FRemoteControlPresetRebindingManager;
+	friend class FRemoteControlPresetRegistryTest;
 };
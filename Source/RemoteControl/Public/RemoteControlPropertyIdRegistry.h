@@ -123,6 +123,7 @@ public:
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& InPropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
 #endif
 
 	/**
@@ -215,11 +216,24 @@ public:
 	 */
 	void UpdateEntityIds(const TMap<FGuid, FGuid>& InEntityIdMap);
 
+private:
+	/** PropertyId, SuperType and SubType a chain reaction is performed for. */
+	using FChainReactionKey = TTuple<FName, FName, FName>;
+
+	/** Returns the entities targeted by a chain reaction, indexing the identified fields again if they changed. */
+	const TArray<FGuid>* FindChainReactionTargets(const FRemoteControlPropertyIdArgs& InArgs);
+
 private:
 	/** Holds the identified fields. */
 	UPROPERTY(Transient)
 	TSet<FRCPropertyIdWrapper> IdentifiedFields;
 
+	/** Valid identified fields indexed by PropertyId, SuperType and SubType. */
+	TMap<FChainReactionKey, TArray<FGuid>> ChainReactionTargets;
+
+	/** Whether the identified fields changed since ChainReactionTargets was built. */
+	bool bChainReactionTargetsDirty = true;
+
 	/** Delegate triggered when a property has its field Id changed. */
 	FOnPropertyIdUpdated OnPropertyIdUpdatedDelegate;
 
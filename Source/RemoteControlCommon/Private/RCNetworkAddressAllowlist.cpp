@@ -0,0 +1,193 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RCNetworkAddressAllowlist.h"
+
+#include "RemoteControlSettings.h"
+
+void FRCNetworkAddressAllowlist::Compile(const TSet<FRCNetworkAddressRange>& InRanges)
+{
+	Nodes.Reset();
+	RootNode = INDEX_NONE;
+
+	// Lower and upper bound of each octet, stored as [LowerA, UpperA, LowerB, UpperB...].
+	TArray<TArray<uint8>> RangeBounds;
+	TArray<int32> Ranges;
+	for (const FRCNetworkAddressRange& Range : InRanges)
+	{
+		TArray<uint8> Bounds = {
+			Range.LowerBound.ClassA, Range.UpperBound.ClassA,
+			Range.LowerBound.ClassB, Range.UpperBound.ClassB,
+			Range.LowerBound.ClassC, Range.UpperBound.ClassC,
+			Range.LowerBound.ClassD, Range.UpperBound.ClassD
+		};
+
+		// A range with an inverted octet can't contain any address.
+		bool bIsEmpty = false;
+		for (int32 Octet = 0; Octet < NumOctets; ++Octet)
+		{
+			bIsEmpty |= Bounds[Octet * 2] > Bounds[Octet * 2 + 1];
+		}
+
+		if (!bIsEmpty)
+		{
+			Ranges.Add(RangeBounds.Add(MoveTemp(Bounds)));
+		}
+	}
+
+	// Nodes already built for a given octet and set of ranges, so identical subtrees are shared.
+	TArray<TMap<TArray<int32>, int32>> BuiltNodes;
+	BuiltNodes.SetNum(NumOctets);
+
+	RootNode = BuildNode(0, RangeBounds, Ranges, BuiltNodes);
+}
+
+int32 FRCNetworkAddressAllowlist::BuildNode(int32 InOctet, const TArray<TArray<uint8>>& InRangeBounds, const TArray<int32>& InRanges, TArray<TMap<TArray<int32>, int32>>& InOutBuiltNodes)
+{
+	if (InRanges.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	if (InOctet == NumOctets)
+	{
+		return AllowedNode;
+	}
+
+	if (const int32* BuiltNode = InOutBuiltNodes[InOctet].Find(InRanges))
+	{
+		return *BuiltNode;
+	}
+
+	FNode Node;
+	TArray<int32> MatchingRanges;
+	for (int32 Value = 0; Value < 256; ++Value)
+	{
+		MatchingRanges.Reset();
+		for (int32 RangeIndex : InRanges)
+		{
+			const TArray<uint8>& Bounds = InRangeBounds[RangeIndex];
+			if (Value >= Bounds[InOctet * 2] && Value <= Bounds[InOctet * 2 + 1])
+			{
+				MatchingRanges.Add(RangeIndex);
+			}
+		}
+
+		Node.Children[Value] = BuildNode(InOctet + 1, InRangeBounds, MatchingRanges, InOutBuiltNodes);
+	}
+
+	const int32 NodeIndex = Nodes.Add(Node);
+	InOutBuiltNodes[InOctet].Add(InRanges, NodeIndex);
+	return NodeIndex;
+}
+
+bool FRCNetworkAddressAllowlist::Contains(const FString& InAddress) const
+{
+	uint8 Octets[NumOctets];
+	return ParseAddress(InAddress, Octets) && Contains(Octets);
+}
+
+bool FRCNetworkAddressAllowlist::Contains(const uint8 (&InOctets)[4]) const
+{
+	int32 NodeIndex = RootNode;
+	for (int32 Octet = 0; Octet < NumOctets && NodeIndex >= 0; ++Octet)
+	{
+		NodeIndex = Nodes[NodeIndex].Children[InOctets[Octet]];
+	}
+	return NodeIndex == AllowedNode;
+}
+
+bool FRCNetworkAddressAllowlist::ParseAddress(FStringView InAddress, uint8 (&OutOctets)[4])
+{
+	InAddress.TrimStartAndEndInline();
+
+	auto IsPort = [](FStringView InPort)
+	{
+		if (InPort.IsEmpty() || InPort.Len() > 5)
+		{
+			return false;
+		}
+
+		for (TCHAR Character : InPort)
+		{
+			if (!FChar::IsDigit(Character))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// Proxies append the port to the address, written as a.b.c.d:port or [::ffff:a.b.c.d]:port
+	int32 LastColonIndex = INDEX_NONE;
+	if (InAddress.StartsWith(TEXT('[')))
+	{
+		int32 ClosingBracketIndex = INDEX_NONE;
+		if (!InAddress.FindChar(TEXT(']'), ClosingBracketIndex))
+		{
+			return false;
+		}
+
+		const FStringView Port = InAddress.RightChop(ClosingBracketIndex + 1);
+		if (!Port.IsEmpty() && (!Port.StartsWith(TEXT(':')) || !IsPort(Port.RightChop(1))))
+		{
+			return false;
+		}
+		InAddress = InAddress.Mid(1, ClosingBracketIndex - 1);
+	}
+	else if (InAddress.FindLastChar(TEXT(':'), LastColonIndex))
+	{
+		// The last colon separates a port if it follows the dotted address.
+		int32 DotIndex = INDEX_NONE;
+		if (InAddress.Left(LastColonIndex).FindChar(TEXT('.'), DotIndex))
+		{
+			if (!IsPort(InAddress.RightChop(LastColonIndex + 1)))
+			{
+				return false;
+			}
+			InAddress.LeftInline(LastColonIndex);
+		}
+	}
+
+	// IPv4 addresses mapped to IPv6 are written as ::ffff:a.b.c.d
+	if (InAddress.FindLastChar(TEXT(':'), LastColonIndex))
+	{
+		if (!InAddress.Left(LastColonIndex + 1).Equals(TEXT("::ffff:"), ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+		InAddress.RightChopInline(LastColonIndex + 1);
+	}
+
+	int32 Octet = 0;
+	int32 Value = 0;
+	int32 NumDigits = 0;
+	for (TCHAR Character : InAddress)
+	{
+		if (FChar::IsDigit(Character))
+		{
+			Value = Value * 10 + (Character - TEXT('0'));
+			if (++NumDigits > 3 || Value > 255)
+			{
+				return false;
+			}
+		}
+		else if (Character == TEXT('.') && NumDigits > 0 && Octet < NumOctets - 1)
+		{
+			OutOctets[Octet++] = (uint8)Value;
+			Value = 0;
+			NumDigits = 0;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	if (Octet != NumOctets - 1 || NumDigits == 0)
+	{
+		return false;
+	}
+
+	OutOctets[Octet] = (uint8)Value;
+	return true;
+}
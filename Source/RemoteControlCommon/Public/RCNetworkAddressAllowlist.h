@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRCNetworkAddressRange;
+
+/**
+ * Compiled form of a set of allowlisted IPv4 address ranges.
+ * Ranges bound each octet of the address independently, so they are compiled into a trie with one level per octet,
+ * where identical subtrees are shared. Looking up an address is then four array lookups regardless of the number of ranges.
+ */
+class REMOTECONTROLCOMMON_API FRCNetworkAddressAllowlist
+{
+public:
+	/** Replace the compiled ranges. */
+	void Compile(const TSet<FRCNetworkAddressRange>& InRanges);
+
+	/** Whether an address string (ie. 192.168.1.1 or ::ffff:192.168.1.1) is in one of the ranges. */
+	bool Contains(const FString& InAddress) const;
+
+	/** Whether an address is in one of the ranges. */
+	bool Contains(const uint8 (&InOctets)[4]) const;
+
+	/**
+	 * Parse a dotted IPv4 address, also accepting IPv4 addresses mapped to IPv6.
+	 * A port appended to the address, as proxies do in x-forwarded-for (ie. 192.168.1.1:8080 or [::ffff:192.168.1.1]:8080), is ignored.
+	 * @return false if the string is not an IPv4 address.
+	 */
+	static bool ParseAddress(FStringView InAddress, uint8 (&OutOctets)[4]);
+
+private:
+	/** Number of octets in an IPv4 address, and depth of the trie. */
+	static constexpr int32 NumOctets = 4;
+
+	/** Child value marking an address as allowed on the last level of the trie. */
+	static constexpr int32 AllowedNode = -2;
+
+	/** A level of the trie, mapping each value of an octet to the node handling the next octet. */
+	struct FNode
+	{
+		int32 Children[256];
+	};
+
+	/** Build the node handling the given octet for the ranges that matched the previous octets. */
+	int32 BuildNode(int32 InOctet, const TArray<TArray<uint8>>& InRangeBounds, const TArray<int32>& InRanges, TArray<TMap<TArray<int32>, int32>>& InOutBuiltNodes);
+
+private:
+	/** Nodes of the trie. */
+	TArray<FNode> Nodes;
+
+	/** Node handling the first octet, INDEX_NONE when no address is allowed. */
+	int32 RootNode = INDEX_NONE;
+};
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Misc/ScopeRWLock.h"
+#include "RCNetworkAddressAllowlist.h"
 
 #include "RemoteControlSettings.generated.h"
 
@@ -239,22 +241,52 @@ public:
 			FRCNetworkAddressRange NewRange = { LowerAndUpperBounds, LowerAndUpperBounds };
 
 			AllowlistedClients.Add(NewRange);
+			RebuildAllowlist();
 		}
 	}
 	
 	virtual bool IsClientAllowed(const FString& InClientAddressStr) const
 	{
-		for (const FRCNetworkAddressRange& AllowlistedClient : AllowlistedClients)
-		{
-			if (AllowlistedClient.IsInRange(InClientAddressStr))
-			{
-				return true;
-			}
-		}
+		FReadScopeLock Lock(AllowlistLock);
+		return CompiledAllowlist.Contains(InClientAddressStr);
+	}
 
-		return false;
+	/** Recompile the allowlisted client ranges, must be called after modifying AllowlistedClients. */
+	void RebuildAllowlist()
+	{
+		FWriteScopeLock Lock(AllowlistLock);
+		CompiledAllowlist.Compile(AllowlistedClients);
+		ClientAccessVersion++;
+	}
+
+	/** Incremented every time settings affecting client access change, used to invalidate cached access checks. */
+	uint32 GetClientAccessVersion() const
+	{
+		return ClientAccessVersion;
+	}
+
+	//~ Begin UObject Interface
+	virtual void PostInitProperties() override
+	{
+		Super::PostInitProperties();
+		RebuildAllowlist();
 	}
 
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override
+	{
+		Super::PostReloadConfig(PropertyThatWasLoaded);
+		RebuildAllowlist();
+	}
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override
+	{
+		Super::PostEditChangeProperty(PropertyChangedEvent);
+		RebuildAllowlist();
+	}
+#endif
+	//~ End UObject Interface
+
 	/** Returns the names of the columns visualized in the RC Panel Entities list. */
 	static const TSet<FName>& GetExposedEntitiesColumnNames()
 	{
@@ -312,6 +344,12 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Remote Control Web Server", DisplayName = "Remote Control WebSocket Server Port")
 	uint32 RemoteControlWebSocketServerPort = 30020;
 	
+	/**
+	 * Presets to load asynchronously after engine startup, so the first request that references them doesn't block the game thread.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Remote Control Preset", DisplayName = "Presets to preload at startup", meta = (AllowedClasses = "/Script/RemoteControl.RemoteControlPreset"))
+	TArray<FSoftObjectPath> PresetsToPreload;
+
 	/** Show a warning icon for exposed editor-only fields. */
 	UPROPERTY(config, EditAnywhere, Category = "Remote Control Preset", DisplayName = "Show a warning when exposing editor-only entities.")
 	bool bDisplayInEditorOnlyWarnings = false;
@@ -386,4 +424,13 @@ public:
 private:
 	UPROPERTY(config)
     bool bSecuritySettingsReviewed = false;
+
+	/** AllowlistedClients compiled for constant time lookups. */
+	FRCNetworkAddressAllowlist CompiledAllowlist;
+
+	/** Protects CompiledAllowlist, since clients can be validated outside of the game thread. */
+	mutable FRWLock AllowlistLock;
+
+	/** Version of the settings affecting client access. */
+	uint32 ClientAccessVersion = 0;
 };
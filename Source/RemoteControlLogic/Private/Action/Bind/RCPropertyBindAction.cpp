@@ -77,33 +77,23 @@ static void SetStructPropertyFromController(const FProperty* RemoteControlProper
 	}
 }
 
-// Workaround method to extract the index of an Array Property element from its name
+// Extracts the index of an Array Property element from its name
 // e.g. MaterialOverride[3] will return 3, MaterialOverride[12] will return 12, etc
-static int32 GetPropertyIndexInArray(const TSharedRef<FRemoteControlProperty>& InRemoteControlEntityAsProperty)
+static int32 GetPropertyIndexInArray(const FRemoteControlProperty& InRemoteControlEntityAsProperty)
 {
-	FString FieldName = InRemoteControlEntityAsProperty->FieldName.ToString();
+	const FString FieldName = InRemoteControlEntityAsProperty.FieldName.ToString();
 
-	const TSharedPtr<IRemoteControlPropertyHandle>& RemoteControlHandle = InRemoteControlEntityAsProperty->GetPropertyHandle();
-	if (!ensure(RemoteControlHandle))
+	int32 OpeningBracketIndex = INDEX_NONE;
+	if (!FieldName.EndsWith(TEXT("]")) || !FieldName.FindLastChar(TEXT('['), OpeningBracketIndex))
 	{
-		return -1;
+		// Whole array, set its first element
+		return 0;
 	}
 
-	const TSharedPtr<IRemoteControlPropertyHandleArray>& AsArray = RemoteControlHandle->AsArray();
-	const int32 ElementsNum = AsArray->GetNumElements();
-
-	FieldName.RemoveFromEnd(TEXT("]"));
-	
-	// Number of integer digits, so that we know how many characters to keep at the end of the string
-	const int32 Digits = FMath::Floor(FMath::LogX(10.0f, ElementsNum) + 1);
-	const int32 CharactersToRemove = FieldName.Len() - Digits;
-	FieldName.RemoveAt(0, CharactersToRemove, EAllowShrinking::Yes);
-	const int32 Index = FCString::Atoi(*FieldName);
-
-	return Index;
+	return FCString::Atoi(*FieldName.Mid(OpeningBracketIndex + 1, FieldName.Len() - OpeningBracketIndex - 2));
 }
 
-static void SetObjectPropertyFromController(const TSharedRef<FRemoteControlProperty>& InRemoteControlEntityAsProperty, const URCController* Controller)
+static void SetObjectPropertyFromController(const TSharedRef<FRemoteControlProperty>& InRemoteControlEntityAsProperty, const URCController* Controller, int32 InArrayElementIndex)
 {
 	FProperty* RemoteControlProperty = InRemoteControlEntityAsProperty->GetProperty();
 	if (RemoteControlProperty == nullptr)
@@ -152,11 +142,9 @@ static void SetObjectPropertyFromController(const TSharedRef<FRemoteControlPrope
 			{
 				if (RemoteControlProperty->IsA(FArrayProperty::StaticClass()))
 				{
-					// Extract index in array, based on field name
-					const int32 Index = GetPropertyIndexInArray(InRemoteControlEntityAsProperty);	
-					if (const TSharedPtr<IRemoteControlPropertyHandle>& ElementToUpdate = RemoteControlHandle->AsArray()->GetElement(Index))
+					if (const TSharedPtr<IRemoteControlPropertyHandle>& ElementToUpdate = RemoteControlHandle->AsArray()->GetElement(InArrayElementIndex))
 					{
-						ElementToUpdate->SetValueInArray(ObjectValue, Index);					
+						ElementToUpdate->SetValueInArray(ObjectValue, InArrayElementIndex);
 					}
 				}
 				else
@@ -352,7 +340,12 @@ void URCPropertyBindAction::Execute() const
 		}
 		else if (ControllerAsProperty->IsA(FObjectProperty::StaticClass()))
 		{
-			SetObjectPropertyFromController(RemoteControlEntityAsProperty.ToSharedRef(), Controller);
+			if (!ArrayElementIndex.IsSet())
+			{
+				ResolveArrayElementIndex(*RemoteControlEntityAsProperty);
+			}
+
+			SetObjectPropertyFromController(RemoteControlEntityAsProperty.ToSharedRef(), Controller, ArrayElementIndex.GetValue());
 		}
 
 		// Editor specific updates
@@ -377,3 +370,15 @@ void URCPropertyBindAction::Execute() const
 	#endif
 	}
 }
+
+void URCPropertyBindAction::UpdateEntityIds(const TMap<FGuid, FGuid>& InEntityIdMap)
+{
+	ArrayElementIndex.Reset();
+
+	Super::UpdateEntityIds(InEntityIdMap);
+}
+
+void URCPropertyBindAction::ResolveArrayElementIndex(const FRemoteControlProperty& InRemoteControlProperty) const
+{
+	ArrayElementIndex = GetPropertyIndexInArray(InRemoteControlProperty);
+}
@@ -57,31 +57,21 @@ void URCPropertyAction::Execute() const
 	
 	if (TSharedPtr<FRemoteControlProperty> RemoteControlProperty = PresetWeakPtr->GetExposedEntity<FRemoteControlProperty>(ExposedFieldId).Pin())
 	{
-		FRCObjectReference ObjectRef;
-		ObjectRef.Property = RemoteControlProperty->GetProperty();
-		ObjectRef.Access = ERCAccess::WRITE_ACCESS;
-	
-		ObjectRef.PropertyPathInfo = RemoteControlProperty->FieldPathInfo.ToString();
-	
-		bool bSuccess = true;
-		for (UObject* Object : RemoteControlProperty->GetBoundObjects())
+		const TArray<FRCObjectReference>& Targets = GetCompiledTargets(RemoteControlProperty);
+		if (Targets.Num())
 		{
-			if (IRemoteControlModule::Get().ResolveObjectProperty(ObjectRef.Access, Object, ObjectRef.PropertyPathInfo, ObjectRef))
+			// Serialize the value once, it's the same payload for every bound object.
+			TArray<uint8> Buffer;
+			FMemoryWriter Writer(Buffer);
+			FCborStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
+			PropertySelfContainer->SerializeToBackend(SerializerBackend);
+
+			for (const FRCObjectReference& ObjectRef : Targets)
 			{
-				TArray<uint8> Buffer;
-				FMemoryWriter Writer(Buffer);
-	
-				FCborStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
-	
-				FStructSerializerPolicies Policies; 
-				Policies.MapSerialization = EStructSerializerMapPolicies::Array;
-				
-				PropertySelfContainer->SerializeToBackend(SerializerBackend);
-	
 				// Deserialization
 				FMemoryReader Reader(Buffer);
 				FCborStructDeserializerBackend DeserializerBackend(Reader);
-	
+
 				IRemoteControlModule::Get().SetObjectProperties(ObjectRef, DeserializerBackend, ERCPayloadType::Cbor, Buffer);
 			}
 		}
@@ -90,6 +80,60 @@ void URCPropertyAction::Execute() const
 	Super::Execute();
 }
 
+const TArray<FRCObjectReference>& URCPropertyAction::GetCompiledTargets(const TSharedPtr<FRemoteControlProperty>& InRemoteControlProperty) const
+{
+	const TArray<UObject*> BoundObjects = InRemoteControlProperty->GetBoundObjects();
+
+	bool bUpToDate = CompiledTargets.bCanReuseReferences
+		&& CompiledTargets.Property.HasSameObject(InRemoteControlProperty.Get())
+		&& CompiledTargets.PathHash == InRemoteControlProperty->FieldPathInfo.PathHash
+		&& CompiledTargets.BoundObjects.Num() == BoundObjects.Num();
+
+	for (int32 Index = 0; bUpToDate && Index < BoundObjects.Num(); ++Index)
+	{
+		bUpToDate = CompiledTargets.BoundObjects[Index].Get() == BoundObjects[Index] && CompiledTargets.References[Index].IsValid();
+	}
+
+	if (bUpToDate)
+	{
+		return CompiledTargets.References;
+	}
+
+	CompiledTargets.Property = InRemoteControlProperty;
+	CompiledTargets.PathHash = InRemoteControlProperty->FieldPathInfo.PathHash;
+	CompiledTargets.BoundObjects.Reset(BoundObjects.Num());
+	CompiledTargets.References.Reset(BoundObjects.Num());
+	CompiledTargets.bCanReuseReferences = true;
+
+	const FRCFieldPathInfo& FieldPathInfo = InRemoteControlProperty->FieldPathInfo;
+	for (int32 SegmentIndex = 0; SegmentIndex < FieldPathInfo.GetSegmentCount(); ++SegmentIndex)
+	{
+		const FRCFieldPathSegment& Segment = FieldPathInfo.GetFieldSegment(SegmentIndex);
+		if (Segment.ArrayIndex != INDEX_NONE || !Segment.MapKey.IsEmpty())
+		{
+			CompiledTargets.bCanReuseReferences = false;
+			break;
+		}
+	}
+
+	for (UObject* Object : BoundObjects)
+	{
+		FRCObjectReference ObjectRef;
+		if (IRemoteControlModule::Get().ResolveObjectProperty(ERCAccess::WRITE_ACCESS, Object, FieldPathInfo, ObjectRef))
+		{
+			CompiledTargets.BoundObjects.Add(Object);
+			CompiledTargets.References.Add(MoveTemp(ObjectRef));
+		}
+		else
+		{
+			// Resolve again on the next execution, the object might not be ready yet.
+			CompiledTargets.bCanReuseReferences = false;
+		}
+	}
+
+	return CompiledTargets.References;
+}
+
 void URCPropertyAction::UpdateEntityIds(const TMap<FGuid, FGuid>& InEntityIdMap)
 {
 	if (PropertySelfContainer)
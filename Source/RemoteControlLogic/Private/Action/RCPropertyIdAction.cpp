@@ -25,6 +25,7 @@ URCPropertyIdAction::~URCPropertyIdAction()
 	if (PresetWeakPtr.IsValid())
 	{
 		PresetWeakPtr->OnEntityUnexposed().RemoveAll(this);
+		PresetWeakPtr->OnEntitiesUnexposed().RemoveAll(this);
 		if (const TObjectPtr<URemoteControlPropertyIdRegistry> Registry = PresetWeakPtr->GetPropertyIdRegistry())
 		{
 			Registry->OnPropertyIdUpdated().RemoveAll(this);
@@ -44,30 +45,23 @@ void URCPropertyIdAction::Execute() const
 		return;
 	}
 
+	FRemoteControlPropertyIdArgs PropertyIdArgs;
+	PropertyIdArgs.RealProperties = RealPropertySelfContainer;
+
 	for (const TPair<FPropertyIdContainerKey, TObjectPtr<URCVirtualPropertySelfContainer>>& PropertyContainer : PropertySelfContainer)
 	{
-		if (FProperty* Property = PropertyContainer.Value->GetProperty())
+		if (PropertyContainer.Value && PropertyContainer.Value->GetProperty())
 		{
-			FRemoteControlPropertyIdArgs PropertyIdArgs;
-			PropertyIdArgs.VirtualProperty = PropertyContainer.Value;
-			PropertyIdArgs.PropertyId = PropertyContainer.Key.PropertyId;
-			PropertyIdArgs.RealProperties = RealPropertySelfContainer;
-
-			TSharedPtr<IPropertyIdHandler> PropertyIdHandler = IRemoteControlModule::Get().GetPropertyIdHandlerFor(Property);
-			if (!PropertyIdHandler.IsValid())
+			const FContainerTypes& ContainerTypes = GetContainerTypes(PropertyContainer.Key, PropertyContainer.Value);
+			if (!ContainerTypes.bHasHandler)
 			{
 				continue;
 			}
 
-			PropertyIdArgs.SuperType = PropertyIdHandler->GetPropertySuperTypeName(Property);
-			const EPropertyBagPropertyType PropertyBagType = PropertyIdHandler->GetPropertyType(Property);
-
-			if (PropertyBagType == EPropertyBagPropertyType::Enum ||
-				PropertyBagType == EPropertyBagPropertyType::Object ||
-				PropertyBagType == EPropertyBagPropertyType::Struct)
-			{
-				PropertyIdArgs.SubType = PropertyIdHandler->GetPropertySubTypeName(Property);
-			}
+			PropertyIdArgs.VirtualProperty = PropertyContainer.Value;
+			PropertyIdArgs.PropertyId = PropertyContainer.Key.PropertyId;
+			PropertyIdArgs.SuperType = ContainerTypes.SuperType;
+			PropertyIdArgs.SubType = ContainerTypes.SubType;
 
 			PresetWeakPtr->PerformChainReaction(PropertyIdArgs);
 		}
@@ -92,6 +86,16 @@ void URCPropertyIdAction::UpdateEntityIds(const TMap<FGuid, FGuid>& InEntityIdMa
 		}
 	}
 	
+	// The real containers are looked up by entity id when performing the chain reaction
+	TMap<FGuid, TObjectPtr<URCVirtualPropertySelfContainer>> RemappedRealPropertySelfContainer;
+	RemappedRealPropertySelfContainer.Reserve(RealPropertySelfContainer.Num());
+	for (TPair<FGuid, TObjectPtr<URCVirtualPropertySelfContainer>>& RealPropertyEntry : RealPropertySelfContainer)
+	{
+		const FGuid* NewEntityId = InEntityIdMap.Find(RealPropertyEntry.Key);
+		RemappedRealPropertySelfContainer.Add(NewEntityId ? *NewEntityId : RealPropertyEntry.Key, RealPropertyEntry.Value);
+	}
+	RealPropertySelfContainer = MoveTemp(RemappedRealPropertySelfContainer);
+	
 	Super::UpdateEntityIds(InEntityIdMap);
 }
 
@@ -120,6 +124,7 @@ void URCPropertyIdAction::UpdatePropertyId()
 	if (URemoteControlPreset* Preset = PresetWeakPtr.Get())
 	{
 		PropertySelfContainer.Empty();
+		CachedContainerTypes.Empty();
 		TArray<FGuid> CurrentRCGuidsInAction;
 		const TObjectPtr<URemoteControlPropertyIdRegistry> PropertyIdRegistry = Preset->GetPropertyIdRegistry();
 
@@ -283,6 +288,7 @@ void URCPropertyIdAction::Initialize()
 	if (PresetWeakPtr.IsValid())
 	{
 		PresetWeakPtr->OnEntityUnexposed().AddUObject(this, &URCPropertyIdAction::OnEntityUnexposed);
+		PresetWeakPtr->OnEntitiesUnexposed().AddUObject(this, &URCPropertyIdAction::OnEntitiesUnexposed);
 		if (const TObjectPtr<URemoteControlPropertyIdRegistry> Registry = PresetWeakPtr->GetPropertyIdRegistry())
 		{
 			Registry->OnPropertyIdUpdated().AddUObject(this, &URCPropertyIdAction::UpdatePropertyId);
@@ -310,3 +316,74 @@ void URCPropertyIdAction::OnEntityUnexposed(URemoteControlPreset* InPreset, cons
 	//We refresh to be sure to not miss anything
 	UpdatePropertyId();
 }
+
+void URCPropertyIdAction::OnEntitiesUnexposed(URemoteControlPreset* InPreset, const TArray<FGuid>& InGuids)
+{
+	if (InPreset)
+	{
+		bool bPropertyIdUpdated = false;
+		bool bAllEntitiesValid = true;
+		for (const FGuid& Guid : InGuids)
+		{
+			const TSharedPtr<FRemoteControlField> UnexposedEntity = StaticCastSharedPtr<FRemoteControlField>(InPreset->GetExposedEntity(Guid).Pin());
+			if (!UnexposedEntity.IsValid())
+			{
+				bAllEntitiesValid = false;
+				break;
+			}
+
+			if (UnexposedEntity->PropertyId == PropertyId)
+			{
+				InPreset->GetPropertyIdRegistry()->RemoveIdentifiedField(UnexposedEntity->GetId());
+				bPropertyIdUpdated = true;
+			}
+		}
+
+		if (bAllEntitiesValid)
+		{
+			//Only broadcast once for all the unexposed properties sharing the propertyId of this PropertyIdAction
+			if (bPropertyIdUpdated)
+			{
+				InPreset->GetPropertyIdRegistry()->OnPropertyIdUpdated().Broadcast();
+			}
+			return;
+		}
+	}
+	//Same as OnEntityUnexposed, refresh if any of the entities can't be checked
+	UpdatePropertyId();
+}
+
+const URCPropertyIdAction::FContainerTypes& URCPropertyIdAction::GetContainerTypes(const FPropertyIdContainerKey& InKey, URCVirtualPropertySelfContainer* InContainer) const
+{
+	FProperty* InProperty = InContainer->GetProperty();
+	const UPropertyBag* PropertyBag = InContainer->GetPropertyBagInstance()->GetPropertyBagStruct();
+
+	FContainerTypes& ContainerTypes = CachedContainerTypes.FindOrAdd(InKey);
+	if (ContainerTypes.Property == InProperty && ContainerTypes.PropertyBag.Get() == PropertyBag)
+	{
+		return ContainerTypes;
+	}
+
+	ContainerTypes = FContainerTypes();
+	ContainerTypes.Property = InProperty;
+	ContainerTypes.PropertyBag = PropertyBag;
+
+	const TSharedPtr<IPropertyIdHandler> PropertyIdHandler = IRemoteControlModule::Get().GetPropertyIdHandlerFor(InProperty);
+	if (!PropertyIdHandler.IsValid())
+	{
+		return ContainerTypes;
+	}
+
+	ContainerTypes.bHasHandler = true;
+	ContainerTypes.SuperType = PropertyIdHandler->GetPropertySuperTypeName(InProperty);
+	const EPropertyBagPropertyType PropertyBagType = PropertyIdHandler->GetPropertyType(InProperty);
+
+	if (PropertyBagType == EPropertyBagPropertyType::Enum ||
+		PropertyBagType == EPropertyBagPropertyType::Object ||
+		PropertyBagType == EPropertyBagPropertyType::Struct)
+	{
+		ContainerTypes.SubType = PropertyIdHandler->GetPropertySubTypeName(InProperty);
+	}
+
+	return ContainerTypes;
+}
@@ -36,6 +36,8 @@ URCPropertyBindAction* URCBehaviourBind::AddPropertyBindAction(const TSharedRef<
 	BindAction->Controller = ControllerWeakPtr.Get();
 	BindAction->Id = FGuid::NewGuid();
 
+	BindAction->ResolveArrayElementIndex(*InRemoteControlProperty);
+
 	// Add action to array
 	ActionContainer->AddAction(BindAction);
 
@@ -97,59 +99,196 @@ bool URCBehaviourBind::CanHaveActionForField(const TSharedPtr<FRemoteControlFiel
 	return false;
 }
 
-static bool EvaluateBindCompatibility(const TMap<FFieldClass*, TArray<FFieldClass*>>& BindingsMap, const FFieldClass* ControllerPropertyClass, const FFieldClass* InRemoteControlPropertyClass)
+namespace UE::RCBehaviourBind::Private
 {
-	TArray< FFieldClass*> Keys;
-	BindingsMap.GenerateKeyArray(Keys);
+	/**
+	 * Bind compatibility between Controller and Remote Control property types.
+	 * The conversion rules are expanded once over every property class, so a query is a single lookup instead of walking the rules and their class hierarchies.
+	 */
+	class FBindCompatibilityTable
+	{
+	public:
+		static const FBindCompatibilityTable& Get()
+		{
+			static const FBindCompatibilityTable Table;
+			return Table;
+		}
 
-	for (const FFieldClass* PropertyType : Keys)
-	{
-		if (ControllerPropertyClass->IsChildOf(PropertyType))
+		/** Whether a Controller property class binds to a Remote Control property class through related types. */
+		bool IsIndirectBind(const FFieldClass* InControllerPropertyClass, const FFieldClass* InRemoteControlPropertyClass) const
+		{
+			return IndirectBinds.Contains(MakeTuple(InControllerPropertyClass, InRemoteControlPropertyClass));
+		}
+
+		/** Whether a Controller property class binds to a Remote Control property class through numeric conversion. */
+		bool IsNumericConversion(const FFieldClass* InControllerPropertyClass, const FFieldClass* InRemoteControlPropertyClass) const
+		{
+			return NumericConversions.Contains(MakeTuple(InControllerPropertyClass, InRemoteControlPropertyClass));
+		}
+
+		/** Whether a Controller property class binds to a Remote Control struct property through numeric conversion. */
+		bool IsNumericConversionToStruct(const FFieldClass* InControllerPropertyClass, const FProperty* InRemoteControlProperty) const
 		{
-			const TArray<FFieldClass*>* SupportedBindings = BindingsMap.Find(PropertyType);
+			const FStructProperty* RCFieldStructProperty = CastField<FStructProperty>(InRemoteControlProperty);
+			if (!RCFieldStructProperty || !RCFieldStructProperty->Struct)
+			{
+				return false;
+			}
 
-			if (SupportedBindings)
+			if (const TArray<UScriptStruct*>* SupportedStructs = NumericConversionStructs.Find(InControllerPropertyClass))
 			{
-				for (const FFieldClass* SupportedBinding : *SupportedBindings)
+				for (const UScriptStruct* SupportedStruct : *SupportedStructs)
 				{
-					if (InRemoteControlPropertyClass->IsChildOf(SupportedBinding))
+					if (RCFieldStructProperty->Struct->IsChildOf(SupportedStruct))
 					{
 						return true;
 					}
 				}
 			}
+
+			return false;
 		}
-	}
 
-	return false;
-}
+		/** Whether a Controller struct binds to a Remote Control struct through explicit conversion. */
+		bool IsStructConversion(const UScriptStruct* InControllerStruct, const UScriptStruct* InRemoteControlStruct) const
+		{
+			if (const TArray<UScriptStruct*>* SupportedConversions = StructConversions.Find(InControllerStruct))
+			{
+				return SupportedConversions->Contains(InRemoteControlStruct);
+			}
 
-static bool EvaluateBindCompatibility(const TMap<FFieldClass*, TArray<UScriptStruct*>>& InBindingsMap, const FFieldClass* InControllerPropertyClass, const FProperty* InRemoteControlProperty)
-{
-	TArray<FFieldClass*> Keys;
-	InBindingsMap.GenerateKeyArray(Keys);
+			return false;
+		}
 
-	if (const FStructProperty* RCFieldStructProperty = CastField<FStructProperty>(InRemoteControlProperty))
-	{
-		for (const FFieldClass* PropertyType : Keys)
+		/** Property Bag type used by Controllers to represent a Remote Control property class, None if unsupported. */
+		EPropertyBagPropertyType GetPropertyBagType(const FFieldClass* InPropertyClass) const
+		{
+			const EPropertyBagPropertyType* PropertyBagType = PropertyBagTypes.Find(InPropertyClass);
+			return PropertyBagType ? *PropertyBagType : EPropertyBagPropertyType::None;
+		}
+
+	private:
+		FBindCompatibilityTable()
 		{
-			if (InControllerPropertyClass->IsChildOf(PropertyType))
+			// Indirect Binding (related types)
+			//
+			const TMap<FFieldClass*, TArray<FFieldClass*>> SupportedIndirectBindsMap =
+			{
+				/* Controller Type */                           /* Supported Remote Control Property Types */
+
+				{ FStrProperty::StaticClass(),      /* --> */   { FTextProperty::StaticClass(),     FNameProperty::StaticClass()}},
+				{ FNumericProperty::StaticClass(),  /* --> */   { FNumericProperty::StaticClass(),  FBoolProperty::StaticClass(),  FByteProperty::StaticClass(), FEnumProperty::StaticClass() } },
+				{ FBoolProperty::StaticClass(),     /* --> */   { FFloatProperty::StaticClass(),    FIntProperty::StaticClass(),   FBoolProperty::StaticClass() } }
+			};
+
+			// Indirect Binding (via numeric conversion)
+			//
+			const TMap<FFieldClass*, TArray<FFieldClass*>> SupportedNumericConversionsMap =
+			{
+				/* Controller Type */                           /* Supported Remote Control Property Types */
+
+				{ FStrProperty::StaticClass(),      /* --> */   { FNumericProperty::StaticClass(), FBoolProperty::StaticClass(),  FByteProperty::StaticClass()  } },
+				{ FNumericProperty::StaticClass(),  /* --> */   { FStrProperty::StaticClass(),     FTextProperty::StaticClass(),  FNameProperty::StaticClass() } }
+			};
+
+			// Indirect Binding (via numeric conversion)
+			//
+			const TMap<FFieldClass*, TArray<UScriptStruct*>> SupportedNumericConversionsStructMap =
+			{
+				/* Controller Type */                           /* Supported Remote Control Property Types */
+				{ FNumericProperty::StaticClass(),  /* --> */   { TBaseStructure<FVector>::Get(), TBaseStructure<FVector2D>::Get(), TBaseStructure<FRotator>::Get(), } }
+			};
+
+			// Indirect Binding (for Structs)
+			//
+			StructConversions =
+			{
+				/* Struct Type */                                 /* Supported Struct Types */
+
+				{ TBaseStructure<FColor>::Get(),      /* --> */   { TBaseStructure<FLinearColor>::Get()  } }
+			};
+
+			const TMap<EPropertyBagPropertyType, TArray<FFieldClass*>> PropertyBagTypesMap =
 			{
-				if (const TArray<UScriptStruct*>* SupportedBindings = InBindingsMap.Find(PropertyType))
+				/* Property Bag Type */                           /* Input - Remote Control Property Type */
+				{ EPropertyBagPropertyType::String,  /* --> */    { FStrProperty::StaticClass(),      FTextProperty::StaticClass(),     FNameProperty::StaticClass()}},
+				{ EPropertyBagPropertyType::Int32,   /* --> */    { FIntProperty::StaticClass(),      FInt64Property::StaticClass(),    FInt16Property::StaticClass(),   FUInt32Property::StaticClass(),
+																   FUInt64Property::StaticClass(),   FUInt16Property::StaticClass(),   FEnumProperty::StaticClass(),    FByteProperty::StaticClass() } },
+				{ EPropertyBagPropertyType::Float,   /* --> */    { FFloatProperty::StaticClass(),    FDoubleProperty::StaticClass() } },
+				{ EPropertyBagPropertyType::Bool,    /* --> */    { FBoolProperty::StaticClass() } },
+				{ EPropertyBagPropertyType::Struct,  /* --> */    { FStructProperty::StaticClass() }, },
+				{ EPropertyBagPropertyType::Object,  /* --> */    { FObjectProperty::StaticClass() } /* this will probably never occur, so we manually set the out bag type later */ }
+			};
+
+			for (const TPair<EPropertyBagPropertyType, TArray<FFieldClass*>>& PropertyBagType : PropertyBagTypesMap)
+			{
+				for (const FFieldClass* PropertyClass : PropertyBagType.Value)
+				{
+					PropertyBagTypes.Add(PropertyClass, PropertyBagType.Key);
+				}
+			}
+
+			const TArray<FFieldClass*>& AllFieldClasses = FFieldClass::GetAllFieldClasses();
+			for (const FFieldClass* ControllerPropertyClass : AllFieldClasses)
+			{
+				for (const FFieldClass* RemoteControlPropertyClass : AllFieldClasses)
 				{
-					for (const UScriptStruct* SupportedBinding : *SupportedBindings)
+					if (EvaluateBindCompatibility(SupportedIndirectBindsMap, ControllerPropertyClass, RemoteControlPropertyClass))
 					{
-						if (RCFieldStructProperty->Struct && RCFieldStructProperty->Struct->IsChildOf(SupportedBinding))
+						IndirectBinds.Add(MakeTuple(ControllerPropertyClass, RemoteControlPropertyClass));
+					}
+
+					if (EvaluateBindCompatibility(SupportedNumericConversionsMap, ControllerPropertyClass, RemoteControlPropertyClass))
+					{
+						NumericConversions.Add(MakeTuple(ControllerPropertyClass, RemoteControlPropertyClass));
+					}
+				}
+
+				for (const TPair<FFieldClass*, TArray<UScriptStruct*>>& SupportedStructs : SupportedNumericConversionsStructMap)
+				{
+					if (ControllerPropertyClass->IsChildOf(SupportedStructs.Key))
+					{
+						NumericConversionStructs.FindOrAdd(ControllerPropertyClass).Append(SupportedStructs.Value);
+					}
+				}
+			}
+		}
+
+		static bool EvaluateBindCompatibility(const TMap<FFieldClass*, TArray<FFieldClass*>>& InBindingsMap, const FFieldClass* InControllerPropertyClass, const FFieldClass* InRemoteControlPropertyClass)
+		{
+			for (const TPair<FFieldClass*, TArray<FFieldClass*>>& SupportedBindings : InBindingsMap)
+			{
+				if (InControllerPropertyClass->IsChildOf(SupportedBindings.Key))
+				{
+					for (const FFieldClass* SupportedBinding : SupportedBindings.Value)
+					{
+						if (InRemoteControlPropertyClass->IsChildOf(SupportedBinding))
 						{
 							return true;
 						}
 					}
 				}
 			}
+
+			return false;
 		}
-	}
 
-	return false;
+	private:
+		/** Controller and Remote Control property class pairs bindable through related types. */
+		TSet<TTuple<const FFieldClass*, const FFieldClass*>> IndirectBinds;
+
+		/** Controller and Remote Control property class pairs bindable through numeric conversion. */
+		TSet<TTuple<const FFieldClass*, const FFieldClass*>> NumericConversions;
+
+		/** Structs each Controller property class binds to through numeric conversion. */
+		TMap<const FFieldClass*, TArray<UScriptStruct*>> NumericConversionStructs;
+
+		/** Structs each Controller struct binds to through explicit conversion. */
+		TMap<const UScriptStruct*, TArray<UScriptStruct*>> StructConversions;
+
+		/** Property Bag type of each supported Remote Control property class. */
+		TMap<const FFieldClass*, EPropertyBagPropertyType> PropertyBagTypes;
+	};
 }
 
 static bool EvaluateCustomControllerBindCompatibility(const URCController* InController,  const FFieldClass* InControllerPropertyClass, const FFieldClass* InRemoteControlPropertyClass, const FProperty* InRemoteControlProperty)
@@ -215,43 +354,7 @@ bool URCBehaviourBind::CanHaveActionForField(URCController* Controller, TSharedR
 		}
 	}
 	
-	// Indirect Binding (related types)
-	//
-	const static TMap<FFieldClass*, TArray<FFieldClass*>> SupportedIndirectBindsMap =
-	{
-		/* Controller Type */                           /* Supported Remote Control Property Types */
-
-		{ FStrProperty::StaticClass(),      /* --> */   { FTextProperty::StaticClass(),     FNameProperty::StaticClass()}},
-		{ FNumericProperty::StaticClass(),  /* --> */   { FNumericProperty::StaticClass(),  FBoolProperty::StaticClass(),  FByteProperty::StaticClass(), FEnumProperty::StaticClass() } },
-		{ FBoolProperty::StaticClass(),     /* --> */   { FFloatProperty::StaticClass(),    FIntProperty::StaticClass(),   FBoolProperty::StaticClass() } }
-	};
-
-	// Indirect Binding (via numeric conversion)
-	//
-	const static TMap<FFieldClass*, TArray<FFieldClass*>> SupportedNumericConversionsMap =
-	{
-		/* Controller Type */                           /* Supported Remote Control Property Types */
-
-		{ FStrProperty::StaticClass(),      /* --> */   { FNumericProperty::StaticClass(), FBoolProperty::StaticClass(),  FByteProperty::StaticClass()  } },
-		{ FNumericProperty::StaticClass(),  /* --> */   { FStrProperty::StaticClass(),     FTextProperty::StaticClass(),  FNameProperty::StaticClass() } }
-	};
-
-	// Indirect Binding (via numeric conversion)
-	//
-	const static TMap<FFieldClass*, TArray<UScriptStruct*>> SupportedNumericConversionsStructMap =
-	{
-		/* Controller Type */                           /* Supported Remote Control Property Types */
-		{ FNumericProperty::StaticClass(),  /* --> */   { TBaseStructure<FVector>::Get(), TBaseStructure<FVector2D>::Get(), TBaseStructure<FRotator>::Get(), } }
-	};
-
-	// Indirect Binding (for Structs)
-	//
-	const static TMap<UScriptStruct*, TArray<UScriptStruct*>> SupportedStructConversions =
-	{
-		/* Struct Type */                                 /* Supported Struct Types */
-
-		{ TBaseStructure<FColor>::Get(),      /* --> */   { TBaseStructure<FLinearColor>::Get()  } }
-	};
+	const UE::RCBehaviourBind::Private::FBindCompatibilityTable& CompatibilityTable = UE::RCBehaviourBind::Private::FBindCompatibilityTable::Get();
 
 	const FFieldClass* ControllerPropertyClass = ControllerAsProperty->GetClass();
 	const FFieldClass* RemoteControlPropertyClass = RemoteControlProperty->GetClass();
@@ -264,19 +367,19 @@ bool URCBehaviourBind::CanHaveActionForField(URCController* Controller, TSharedR
 		return true;
 	}
 	// Indirect Binding (related types)
-	else if (EvaluateBindCompatibility(SupportedIndirectBindsMap, ControllerPropertyClass, RemoteControlPropertyClass))
+	else if (CompatibilityTable.IsIndirectBind(ControllerPropertyClass, RemoteControlPropertyClass))
 	{
 		return true;
 	}
 	// Indirect Binding (Numeric to struct)
-	else if (EvaluateBindCompatibility(SupportedNumericConversionsStructMap, ControllerPropertyClass, RemoteControlProperty))
+	else if (CompatibilityTable.IsNumericConversionToStruct(ControllerPropertyClass, RemoteControlProperty))
 	{
 		return true;
 	}
 	// Indirect Binding (Numeric Conversion)
 	else if (bInAllowNumericInputAsStrings)
 	{
-		if (EvaluateBindCompatibility(SupportedNumericConversionsMap, ControllerPropertyClass, RemoteControlPropertyClass))
+		if (CompatibilityTable.IsNumericConversion(ControllerPropertyClass, RemoteControlPropertyClass))
 		{
 			return true;
 		}
@@ -293,15 +396,9 @@ bool URCBehaviourBind::CanHaveActionForField(URCController* Controller, TSharedR
 				{
 					return true; // Binding via matching Struct
 				}
-				else
+				else if (CompatibilityTable.IsStructConversion(StructProperty->Struct, RCFieldStructProperty->Struct))
 				{
-					if (const TArray<UScriptStruct*>* SupportedConversions = SupportedStructConversions.Find(StructProperty->Struct))
-					{
-						if (SupportedConversions->Contains(RCFieldStructProperty->Struct))
-						{
-							return true; // Bind via explicit conversion
-						}
-					}
+					return true; // Bind via explicit conversion
 				}
 			}
 		}
@@ -340,30 +437,7 @@ bool URCBehaviourBind::CanHaveActionForField(URCController* Controller, TSharedR
 
 bool URCBehaviourBind::GetPropertyBagTypeFromFieldProperty(const FProperty* InProperty, EPropertyBagPropertyType& OutPropertyBagType, UObject*& OutStructObject)
 {
-	const static TMap<EPropertyBagPropertyType, TArray<FFieldClass*>> PropertyBagTypesMap =
-	{
-		/* Property Bag Type */                           /* Input - Remote Control Property Type */
-		{ EPropertyBagPropertyType::String,  /* --> */    { FStrProperty::StaticClass(),      FTextProperty::StaticClass(),     FNameProperty::StaticClass()}},
-		{ EPropertyBagPropertyType::Int32,   /* --> */    { FIntProperty::StaticClass(),      FInt64Property::StaticClass(),    FInt16Property::StaticClass(),   FUInt32Property::StaticClass(),
-														   FUInt64Property::StaticClass(),   FUInt16Property::StaticClass(),   FEnumProperty::StaticClass(),    FByteProperty::StaticClass() } },
-		{ EPropertyBagPropertyType::Float,   /* --> */    { FFloatProperty::StaticClass(),    FDoubleProperty::StaticClass() } },
-		{ EPropertyBagPropertyType::Bool,    /* --> */    { FBoolProperty::StaticClass() } },
-		{ EPropertyBagPropertyType::Struct,  /* --> */    { FStructProperty::StaticClass() }, },
-		{ EPropertyBagPropertyType::Object,  /* --> */    { FObjectProperty::StaticClass() } /* this will probably never occur, so we manually set the out bag type later */ }
-	};
-
-	OutPropertyBagType = EPropertyBagPropertyType::None;
-
-	TArray<EPropertyBagPropertyType> Keys;
-	PropertyBagTypesMap.GenerateKeyArray(Keys);
-
-	for (const EPropertyBagPropertyType PropertyBagType : Keys)
-	{
-		if (PropertyBagTypesMap.Find(PropertyBagType)->Contains(InProperty->GetClass()))
-		{
-			OutPropertyBagType = PropertyBagType;
-		}
-	}
+	OutPropertyBagType = UE::RCBehaviourBind::Private::FBindCompatibilityTable::Get().GetPropertyBagType(InProperty->GetClass());
 
 	// Extract the inner Struct object if this is a Struct Property
 	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
@@ -5,12 +5,45 @@
 #include "Action/RCAction.h"
 #include "Action/RCFunctionAction.h"
 #include "Action/RCPropertyAction.h"
+#include "Algo/BinarySearch.h"
 #include "Behaviour/Builtin/Conditional/RCBehaviourConditionalNode.h"
 #include "PropertyBag.h"
 #include "RCVirtualProperty.h"
 #include "RemoteControlField.h"
 #include "Controller/RCController.h"
 
+namespace UE::RCBehaviourConditional::Private
+{
+	/** Compares the controller with the comparand of a condition through the virtual property comparators. An Else condition on its own always passes. */
+	bool IsConditionPassing(URCController* InController, ERCBehaviourConditionType InConditionType, URCVirtualPropertySelfContainer* InComparand)
+	{
+		switch (InConditionType)
+		{
+		case ERCBehaviourConditionType::IsEqual:
+			return InComparand && InController->IsValueEqual(InComparand);
+
+		case ERCBehaviourConditionType::IsGreaterThan:
+			return InComparand && InController->IsValueGreaterThan(InComparand);
+
+		case ERCBehaviourConditionType::IsGreaterThanOrEqualTo:
+			return InComparand && InController->IsValueGreaterThanOrEqualTo(InComparand);
+
+		case ERCBehaviourConditionType::IsLesserThan:
+			return InComparand && InController->IsValueLesserThan(InComparand);
+
+		case ERCBehaviourConditionType::IsLesserThanOrEqualTo:
+			return InComparand && InController->IsValueLesserThanOrEqualTo(InComparand);
+
+		case ERCBehaviourConditionType::Else:
+			return true;
+
+		default:
+			ensureAlwaysMsgf(false, TEXT("Unimplemented comparator!"));
+			return false;
+		}
+	}
+}
+
 URCBehaviourConditional::URCBehaviourConditional()
 {
 }
@@ -50,6 +83,7 @@ void URCBehaviourConditional::OnActionAdded(URCAction* Action, const ERCBehaviou
 	FRCBehaviourCondition Condition(InConditionType, InComparand);
 
 	Conditions.Add(Action, MoveTemp(Condition));
+	InvalidateConditions();
 }
 
 URCAction* URCBehaviourConditional::AddConditionalAction(const TSharedRef<const FRemoteControlField> InRemoteControlField, const ERCBehaviourConditionType InConditionType, const TObjectPtr<URCVirtualPropertySelfContainer> InComparand)
@@ -141,6 +175,20 @@ FText URCBehaviourConditional::GetConditionTypeAsText(ERCBehaviourConditionType
 	return ConditionDisplayText;
 }
 
+void URCBehaviourConditional::SetConditionType(URCAction* InAction, const ERCBehaviourConditionType InConditionType)
+{
+	if (FRCBehaviourCondition* Condition = Conditions.Find(InAction))
+	{
+		Condition->ConditionType = InConditionType;
+		InvalidateConditions();
+	}
+}
+
+void URCBehaviourConditional::InvalidateConditions()
+{
+	CompiledConditions.NumActions = INDEX_NONE;
+}
+
 void URCBehaviourConditional::NotifyActionValueChanged(URCAction* InChangedAction)
 {
 	if (InChangedAction)
@@ -149,110 +197,376 @@ void URCBehaviourConditional::NotifyActionValueChanged(URCAction* InChangedActio
 	}
 }
 
-void URCBehaviourConditional::ExecuteInternal(const TSet<TObjectPtr<URCAction>>& InActionsToExecute)
+#if WITH_EDITOR
+void URCBehaviourConditional::PostEditUndo()
 {
-	const URCBehaviourNode* BehaviourNode = GetBehaviourNode();
-	check(BehaviourNode);
+	Super::PostEditUndo();
 
-	if (BehaviourNode->GetClass() != URCBehaviourConditionalNode::StaticClass())
+	InvalidateConditions();
+}
+#endif
+
+bool URCBehaviourConditional::GetConditionValue(const URCVirtualPropertyBase* InVirtualProperty, FConditionValue& OutValue)
+{
+	const FProperty* Property = InVirtualProperty->GetProperty();
+	const uint8* ValuePtr = InVirtualProperty->GetValuePtr();
+	if (!Property || !ValuePtr)
 	{
-		return; // Allow custom Blueprints to drive their own behaviour entirely
+		return false;
 	}
 
-	// Execute before the logic
-	BehaviourNode->PreExecute(this);
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		if (NumericProperty->IsFloatingPoint())
+		{
+			// Adding zero folds -0 into 0, they are equal but don't hash the same.
+			OutValue.Number = NumericProperty->GetFloatingPointPropertyValue(ValuePtr) + 0.0;
+			return true;
+		}
 
-	bool bConditionPass = false;
+		// 64 bit integers can't be represented exactly by a double.
+		if (NumericProperty->IsInteger() && !Property->IsA<FInt64Property>() && !Property->IsA<FUInt64Property>())
+		{
+			OutValue.Number = static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+			return true;
+		}
 
-	/* Consider the following sequence of conditions for a hypothetical Controller "Tricode"
-	*  For Tricode with current value "Tri2"
-	* 
-	*   =Tri1    <FALSE>  (Action 1)           ...skip...
-	* 
-	*   =Tri2   <TRUE>    (Action 2a)      ...execute...
-	*   =Tri2   <TRUE>    (Action 2b)      ...execute...
-	* 
-	*   =Tri3   <FALSE>  (Action 3)          ...skip...
-	* 
-	*    Else                    (Action 4a)        ...skip...
-	*    Else                    (Action 4b)        ...skip...
-	*    Else                    (Action 4c)        ...skip...
-	* 
-	* For such multiple equality rows we want to know if at least one of them succeeded. 
-	* The flag bHasEqualitySuccess is used for determining whether Else should be executed 
-	*/
-	bool bHasEqualitySuccess = false;
-	bool bPreviousConditionPass = false;
+		return false;
+	}
+
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		OutValue.Number = BoolProperty->GetPropertyValue(ValuePtr) ? 1.0 : 0.0;
+		return true;
+	}
+
+	// String keys compare case insensitively, as FString and FName do.
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		OutValue.String = StrProperty->GetPropertyValue(ValuePtr);
+		return true;
+	}
+
+	if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		OutValue.String = NameProperty->GetPropertyValue(ValuePtr).ToString();
+		return true;
+	}
+
+	return false;
+}
+
+bool URCBehaviourConditional::GetOrderedConditionValue(const URCVirtualPropertyBase* InVirtualProperty, double& OutValue)
+{
+	const FProperty* Property = InVirtualProperty->GetProperty();
+	const uint8* ValuePtr = InVirtualProperty->GetValuePtr();
+	if (!Property || !ValuePtr)
+	{
+		return false;
+	}
+
+	// Same types as the virtual property comparators.
+	if (const FIntProperty* IntProperty = CastField<FIntProperty>(Property))
+	{
+		OutValue = IntProperty->GetPropertyValue(ValuePtr);
+		return true;
+	}
+
+	if (const FFloatProperty* FloatProperty = CastField<FFloatProperty>(Property))
+	{
+		OutValue = FloatProperty->GetPropertyValue(ValuePtr);
+		return !FMath::IsNaN(OutValue);
+	}
 
+	if (const FDoubleProperty* DoubleProperty = CastField<FDoubleProperty>(Property))
+	{
+		OutValue = DoubleProperty->GetPropertyValue(ValuePtr);
+		return !FMath::IsNaN(OutValue);
+	}
+
+	return false;
+}
+
+void URCBehaviourConditional::CompileConditions(const URCController* InController)
+{
+	CompiledConditions = FCompiledConditions();
+	CompiledConditions.ControllerProperty = InController->GetProperty();
+	CompiledConditions.NumActions = ActionContainer->GetActions().Num();
+	CompiledConditions.NumConditions = Conditions.Num();
+
+	FConditionValue ControllerValue;
+	const bool bCanCompileEquality = CompiledConditions.ControllerProperty && GetConditionValue(InController, ControllerValue);
+
+	double ControllerOrderedValue;
+	const bool bCanCompileOrdered = GetOrderedConditionValue(InController, ControllerOrderedValue);
+
+	int32 PreviousConditionIndex = INDEX_NONE;
 	ERCBehaviourConditionType PreviousConditionType = ERCBehaviourConditionType::None;
 
-	// execute all the action if the given action is null otherwise only execute the given action
-	for (const TObjectPtr<URCAction>& Action : InActionsToExecute)
+	for (URCAction* Action : ActionContainer->GetActions())
 	{
-		FRCBehaviourCondition* Condition = Conditions.Find(Action);
+		const FRCBehaviourCondition* Condition = Conditions.Find(Action);
 		if (!Condition)
 		{
 			ensureMsgf(false, TEXT("Unable to find condition for Action"));
 			continue;
 		}
 
+		// Editing the comparand in place invalidates the compiled conditions.
+		if (Condition->Comparand && !Condition->Comparand->OnValueChanged().IsBoundToObject(this))
+		{
+			Condition->Comparand->OnValueChanged().AddUObject(this, &URCBehaviourConditional::InvalidateConditions);
+		}
+
 		const ERCBehaviourConditionType ConditionType = Condition->ConditionType;
+		const int32 ConditionIndex = CompiledConditions.Actions.Add(Action);
+		CompiledConditions.ConditionTypes.Add(ConditionType);
+		CompiledConditions.Comparands.Add(Condition->Comparand);
+
+		int32 EqualityBlock = INDEX_NONE;
+		TArray<FOrderedCondition>* OrderedConditions = nullptr;
 
-		if (ConditionType != PreviousConditionType) // New block
+		switch (ConditionType)
+		{
+		case ERCBehaviourConditionType::IsEqual:
 		{
-			if (ConditionType != ERCBehaviourConditionType::Else)
+			if (PreviousConditionType != ERCBehaviourConditionType::IsEqual)
+			{
+				++CompiledConditions.NumEqualityBlocks;
+			}
+			EqualityBlock = CompiledConditions.NumEqualityBlocks - 1;
+
+			if (!bCanCompileEquality)
+			{
+				CompiledConditions.UncompiledConditions.Add(ConditionIndex);
+				break;
+			}
+
+			// Comparands of another type are never equal to the controller.
+			const FProperty* ComparandProperty = Condition->Comparand ? Condition->Comparand->GetProperty() : nullptr;
+			FConditionValue ComparandValue;
+			if (ComparandProperty && ComparandProperty->GetClass() == CompiledConditions.ControllerProperty->GetClass() && GetConditionValue(Condition->Comparand, ComparandValue))
 			{
-				bHasEqualitySuccess = false; // Reset flag for starting a new block of equality checks
+				CompiledConditions.EqualityConditions.FindOrAdd(MoveTemp(ComparandValue)).Add(ConditionIndex);
 			}
+			break;
 		}
 
-		URCController* RCController = ControllerWeakPtr.Get();
-		if (RCController)
+		case ERCBehaviourConditionType::IsGreaterThan:
+			OrderedConditions = &CompiledConditions.GreaterThanConditions;
+			break;
+
+		case ERCBehaviourConditionType::IsGreaterThanOrEqualTo:
+			OrderedConditions = &CompiledConditions.GreaterThanOrEqualToConditions;
+			break;
+
+		case ERCBehaviourConditionType::IsLesserThan:
+			OrderedConditions = &CompiledConditions.LesserThanConditions;
+			break;
+
+		case ERCBehaviourConditionType::IsLesserThanOrEqualTo:
+			OrderedConditions = &CompiledConditions.LesserThanOrEqualToConditions;
+			break;
+
+		case ERCBehaviourConditionType::Else:
+			CompiledConditions.ElseConditions.Emplace(ConditionIndex, PreviousConditionIndex);
+			break;
+
+		default:
+			CompiledConditions.UncompiledConditions.Add(ConditionIndex);
+		}
+
+		if (OrderedConditions)
 		{
-			switch (ConditionType)
+			double ComparandValue;
+			if (bCanCompileOrdered && Condition->Comparand && GetOrderedConditionValue(Condition->Comparand, ComparandValue))
+			{
+				OrderedConditions->Add({ ComparandValue, ConditionIndex });
+			}
+			else
 			{
-			case ERCBehaviourConditionType::IsEqual:
-				bConditionPass = RCController->IsValueEqual(Condition->Comparand);
-				bHasEqualitySuccess |= bConditionPass;
-				break;			
+				CompiledConditions.UncompiledConditions.Add(ConditionIndex);
+			}
+		}
 
-			case ERCBehaviourConditionType::IsGreaterThan:
-				bConditionPass = RCController->IsValueGreaterThan(Condition->Comparand);
-				break;
+		CompiledConditions.EqualityBlocks.Add(EqualityBlock);
 
-			case ERCBehaviourConditionType::IsGreaterThanOrEqualTo:
-				bConditionPass = RCController->IsValueGreaterThanOrEqualTo(Condition->Comparand);
-				break;
+		// Else conditions depend on the conditions preceding them, so they don't count as a previous condition.
+		if (ConditionType != ERCBehaviourConditionType::Else)
+		{
+			PreviousConditionIndex = ConditionIndex;
+		}
+		PreviousConditionType = ConditionType;
+	}
 
-			case ERCBehaviourConditionType::IsLesserThan:
-				bConditionPass = RCController->IsValueLesserThan(Condition->Comparand);
-				break;
+	for (TArray<FOrderedCondition>* OrderedConditions : { &CompiledConditions.GreaterThanConditions, &CompiledConditions.GreaterThanOrEqualToConditions, &CompiledConditions.LesserThanConditions, &CompiledConditions.LesserThanOrEqualToConditions })
+	{
+		OrderedConditions->StableSort([](const FOrderedCondition& A, const FOrderedCondition& B) { return A.Comparand < B.Comparand; });
+	}
+}
 
-			case ERCBehaviourConditionType::IsLesserThanOrEqualTo:
-				bConditionPass = RCController->IsValueLesserThanOrEqualTo(Condition->Comparand);
-				break;
+void URCBehaviourConditional::EvaluateCompiledConditions(const URCController* InController, TArray<int32>& OutPassingConditions)
+{
+	const FCompiledConditions& Compiled = CompiledConditions;
 
-			case ERCBehaviourConditionType::Else:
-				// If the previous condition failed and no prior equality condition succeeded (among multiple =rows above) then execute Else!
-				bConditionPass = !bPreviousConditionPass && !bHasEqualitySuccess;
-				break;
+	OutPassingConditions.Reset();
+	ConditionPasses.Reset();
+	ConditionPasses.Add(false, Compiled.Actions.Num());
+	EqualityBlockPasses.Reset();
+	EqualityBlockPasses.Add(false, Compiled.NumEqualityBlocks);
 
-			default:				
-				ensureAlwaysMsgf(false, TEXT("Unimplemented comparator!"));
-			}
+	auto MarkPassing = [&Compiled, &OutPassingConditions, this](int32 InConditionIndex)
+	{
+		OutPassingConditions.Add(InConditionIndex);
+		ConditionPasses[InConditionIndex] = true;
+
+		if (Compiled.EqualityBlocks[InConditionIndex] != INDEX_NONE)
+		{
+			EqualityBlockPasses[Compiled.EqualityBlocks[InConditionIndex]] = true;
+		}
+	};
 
-			PreviousConditionType = ConditionType;
+	FConditionValue ControllerValue;
+	if (!Compiled.EqualityConditions.IsEmpty() && GetConditionValue(InController, ControllerValue))
+	{
+		if (const TArray<int32>* EqualConditions = Compiled.EqualityConditions.Find(ControllerValue))
+		{
+			for (const int32 ConditionIndex : *EqualConditions)
+			{
+				MarkPassing(ConditionIndex);
+			}
+		}
+	}
 
-			if (ConditionType != ERCBehaviourConditionType::Else)
+	// Comparands are sorted, so the conditions of each type passing are a contiguous range.
+	double ControllerOrderedValue;
+	if (GetOrderedConditionValue(InController, ControllerOrderedValue))
+	{
+		auto MarkRangePassing = [&MarkPassing](const TArray<FOrderedCondition>& InConditions, int32 InBegin, int32 InEnd)
+		{
+			for (int32 Index = InBegin; Index < InEnd; ++Index)
 			{
-				bPreviousConditionPass = bConditionPass; // Else should not contribute to the previous state flag to support multiple Else Actions (created via Add All Action, etc)
+				MarkPassing(InConditions[Index].ConditionIndex);
 			}
+		};
+
+		const TArray<FOrderedCondition>& GreaterThan = Compiled.GreaterThanConditions;
+		MarkRangePassing(GreaterThan, 0, Algo::LowerBoundBy(GreaterThan, ControllerOrderedValue, &FOrderedCondition::Comparand));
+
+		const TArray<FOrderedCondition>& GreaterThanOrEqualTo = Compiled.GreaterThanOrEqualToConditions;
+		MarkRangePassing(GreaterThanOrEqualTo, 0, Algo::UpperBoundBy(GreaterThanOrEqualTo, ControllerOrderedValue, &FOrderedCondition::Comparand));
+
+		const TArray<FOrderedCondition>& LesserThan = Compiled.LesserThanConditions;
+		MarkRangePassing(LesserThan, Algo::UpperBoundBy(LesserThan, ControllerOrderedValue, &FOrderedCondition::Comparand), LesserThan.Num());
+
+		const TArray<FOrderedCondition>& LesserThanOrEqualTo = Compiled.LesserThanOrEqualToConditions;
+		MarkRangePassing(LesserThanOrEqualTo, Algo::LowerBoundBy(LesserThanOrEqualTo, ControllerOrderedValue, &FOrderedCondition::Comparand), LesserThanOrEqualTo.Num());
+	}
+
+	URCController* Controller = const_cast<URCController*>(InController);
+	for (const int32 ConditionIndex : Compiled.UncompiledConditions)
+	{
+		if (UE::RCBehaviourConditional::Private::IsConditionPassing(Controller, Compiled.ConditionTypes[ConditionIndex], Compiled.Comparands[ConditionIndex].Get()))
+		{
+			MarkPassing(ConditionIndex);
 		}
+	}
 
-		if (bConditionPass)
+	// Else passes if the condition preceding it failed and no condition of its equality block succeeded.
+	for (const TPair<int32, int32>& ElseCondition : Compiled.ElseConditions)
+	{
+		const int32 PreviousConditionIndex = ElseCondition.Value;
+		const bool bPreviousConditionPass = PreviousConditionIndex != INDEX_NONE && ConditionPasses[PreviousConditionIndex];
+		const int32 PreviousEqualityBlock = PreviousConditionIndex != INDEX_NONE ? Compiled.EqualityBlocks[PreviousConditionIndex] : INDEX_NONE;
+		const bool bHasEqualitySuccess = PreviousEqualityBlock != INDEX_NONE && EqualityBlockPasses[PreviousEqualityBlock];
+
+		if (!bPreviousConditionPass && !bHasEqualitySuccess)
+		{
+			OutPassingConditions.Add(ElseCondition.Key);
+		}
+	}
+
+	// Actions execute in the order of the action container.
+	OutPassingConditions.Sort();
+}
+
+void URCBehaviourConditional::ExecuteInternal(const TSet<TObjectPtr<URCAction>>& InActionsToExecute)
+{
+	const URCBehaviourNode* BehaviourNode = GetBehaviourNode();
+	check(BehaviourNode);
+
+	if (BehaviourNode->GetClass() != URCBehaviourConditionalNode::StaticClass())
+	{
+		return; // Allow custom Blueprints to drive their own behaviour entirely
+	}
+
+	// Execute before the logic
+	BehaviourNode->PreExecute(this);
+
+	URCController* RCController = ControllerWeakPtr.Get();
+	if (!RCController)
+	{
+		return;
+	}
+
+	// A single action is evaluated on its own.
+	if (InActionsToExecute.Num() == 1)
+	{
+		URCAction* Action = *InActionsToExecute.CreateConstIterator();
+
+		const FRCBehaviourCondition* Condition = Conditions.Find(Action);
+		if (!Condition)
+		{
+			ensureMsgf(false, TEXT("Unable to find condition for Action"));
+			return;
+		}
+
+		if (UE::RCBehaviourConditional::Private::IsConditionPassing(RCController, Condition->ConditionType, Condition->Comparand))
 		{
 			Action->Execute();
 			BehaviourNode->OnPassed(this);
 		}
+		return;
 	}
+
+	/* Consider the following sequence of conditions for a hypothetical Controller "Tricode"
+	*  For Tricode with current value "Tri2"
+	* 
+	*   =Tri1    <FALSE>  (Action 1)           ...skip...
+	* 
+	*   =Tri2   <TRUE>    (Action 2a)      ...execute...
+	*   =Tri2   <TRUE>    (Action 2b)      ...execute...
+	* 
+	*   =Tri3   <FALSE>  (Action 3)          ...skip...
+	* 
+	*    Else                    (Action 4a)        ...skip...
+	*    Else                    (Action 4b)        ...skip...
+	*    Else                    (Action 4c)        ...skip...
+	* 
+	* Equality conditions are looked up by the controller value and ordered conditions by binary search in their sorted comparands,
+	* Else then executes if the condition preceding it failed and no equality condition of that block succeeded.
+	*/
+	const bool bConditionsUpToDate = CompiledConditions.NumActions == ActionContainer->GetActions().Num()
+		&& CompiledConditions.NumConditions == Conditions.Num()
+		&& CompiledConditions.ControllerProperty == RCController->GetProperty();
+
+	if (!bConditionsUpToDate)
+	{
+		CompileConditions(RCController);
+	}
+
+	// Taken out of the member while executing, an action executing this behaviour again uses an array of its own.
+	TArray<int32> PassingConditionIndices = MoveTemp(PassingConditions);
+	EvaluateCompiledConditions(RCController, PassingConditionIndices);
+
+	for (const int32 ConditionIndex : PassingConditionIndices)
+	{
+		if (URCAction* Action = CompiledConditions.Actions[ConditionIndex].Get())
+		{
+			Action->Execute();
+			BehaviourNode->OnPassed(this);
+		}
+	}
+
+	PassingConditions = MoveTemp(PassingConditionIndices);
 }
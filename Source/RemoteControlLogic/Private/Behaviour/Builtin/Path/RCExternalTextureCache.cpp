@@ -0,0 +1,264 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Behaviour/Builtin/Path/RCExternalTextureCache.h"
+
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/xxhash.h"
+#include "HttpModule.h"
+#include "IImageWrapperModule.h"
+#include "ImageCore.h"
+#include "ImageUtils.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Modules/ModuleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRemoteControlSetAssetByPathTextureCacheSizeMB(
+	TEXT("RemoteControl.SetAssetByPath.TextureCacheSizeMB"),
+	256,
+	TEXT("Maximum amount of memory in megabytes used to cache the textures loaded from external paths by Set Asset By Path behaviours. 0 disables the cache.")
+);
+
+namespace UE::RCExternalTextureCache::Private
+{
+	TSharedPtr<FRCExternalTextureCache> Instance;
+}
+
+void FRCExternalTextureCache::Startup()
+{
+	UE::RCExternalTextureCache::Private::Instance = MakeShared<FRCExternalTextureCache>();
+}
+
+void FRCExternalTextureCache::Shutdown()
+{
+	UE::RCExternalTextureCache::Private::Instance.Reset();
+}
+
+TSharedPtr<FRCExternalTextureCache> FRCExternalTextureCache::Get()
+{
+	return UE::RCExternalTextureCache::Private::Instance;
+}
+
+void FRCExternalTextureCache::Load(const FString& InPath, FOnTextureLoaded InOnLoaded)
+{
+	// Files are reloaded once modified, urls are cached until evicted.
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*InPath);
+
+	if (UTexture2D* Texture = FindByPath(InPath, TimeStamp))
+	{
+		InOnLoaded.ExecuteIfBound(Texture);
+		return;
+	}
+
+	if (TArray<FOnTextureLoaded>* PendingCallbacks = PendingLoads.Find(InPath))
+	{
+		PendingCallbacks->Add(MoveTemp(InOnLoaded));
+		return;
+	}
+
+	PendingLoads.Add(InPath).Add(MoveTemp(InOnLoaded));
+	ReadContent(InPath, TimeStamp);
+}
+
+void FRCExternalTextureCache::Prefetch(const FString& InPath)
+{
+	Load(InPath, FOnTextureLoaded());
+}
+
+void FRCExternalTextureCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<uint64, FTextureEntry>& Texture : Textures)
+	{
+		Collector.AddReferencedObject(Texture.Value.Texture);
+	}
+}
+
+FString FRCExternalTextureCache::GetReferencerName() const
+{
+	return TEXT("FRCExternalTextureCache");
+}
+
+UTexture2D* FRCExternalTextureCache::FindByPath(const FString& InPath, const FDateTime& InTimeStamp)
+{
+	const FPathEntry* PathEntry = Paths.Find(InPath);
+	if (!PathEntry || PathEntry->TimeStamp != InTimeStamp)
+	{
+		return nullptr;
+	}
+
+	return FindByHash(PathEntry->ContentHash);
+}
+
+UTexture2D* FRCExternalTextureCache::FindByHash(uint64 InContentHash)
+{
+	FTextureEntry* TextureEntry = Textures.Find(InContentHash);
+	if (!TextureEntry)
+	{
+		return nullptr;
+	}
+
+	TextureEntry->LastAccess = ++AccessCounter;
+	return TextureEntry->Texture;
+}
+
+void FRCExternalTextureCache::ReadContent(const FString& InPath, const FDateTime& InTimeStamp)
+{
+	const TWeakPtr<FRCExternalTextureCache> WeakCache = AsShared();
+
+	// Local and Network Drives
+	if (InTimeStamp != FDateTime::MinValue())
+	{
+		Async(EAsyncExecution::ThreadPool, [WeakCache, Path = InPath, InTimeStamp]()
+		{
+			TSharedPtr<TArray<uint8>> Content = MakeShared<TArray<uint8>>();
+			if (!FFileHelper::LoadFileToArray(*Content, *Path))
+			{
+				Content.Reset();
+			}
+
+			HashContent(WeakCache, Path, InTimeStamp, MoveTemp(Content));
+		});
+		return;
+	}
+
+	// Http Link
+	TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->OnProcessRequestComplete().BindLambda([WeakCache, Path = InPath](FHttpRequestPtr InHttpRequest, FHttpResponsePtr InHttpResponse, bool bSucceeded)
+	{
+		TSharedPtr<TArray<uint8>> Content;
+		if (bSucceeded && InHttpResponse.IsValid() && EHttpResponseCodes::IsOk(InHttpResponse->GetResponseCode()))
+		{
+			Content = MakeShared<TArray<uint8>>(InHttpResponse->GetContent());
+		}
+
+		Async(EAsyncExecution::ThreadPool, [WeakCache, Path, Content = MoveTemp(Content)]() mutable
+		{
+			HashContent(WeakCache, Path, FDateTime::MinValue(), MoveTemp(Content));
+		});
+	});
+	HttpRequest->SetURL(InPath);
+	HttpRequest->SetVerb(TEXT("GET"));
+
+	if (!HttpRequest->ProcessRequest())
+	{
+		CompletePendingLoad(InPath, nullptr);
+	}
+}
+
+void FRCExternalTextureCache::HashContent(TWeakPtr<FRCExternalTextureCache> InWeakCache, const FString& InPath, const FDateTime& InTimeStamp, TSharedPtr<TArray<uint8>> InContent)
+{
+	const uint64 ContentHash = InContent ? FXxHash64::HashBuffer(InContent->GetData(), InContent->Num()).Hash : 0;
+
+	AsyncTask(ENamedThreads::GameThread, [InWeakCache, Path = InPath, InTimeStamp, ContentHash, Content = MoveTemp(InContent)]()
+	{
+		if (const TSharedPtr<FRCExternalTextureCache> Cache = InWeakCache.Pin())
+		{
+			Cache->OnContentRead(Path, InTimeStamp, ContentHash, Content);
+		}
+	});
+}
+
+void FRCExternalTextureCache::OnContentRead(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash, TSharedPtr<TArray<uint8>> InContent)
+{
+	if (!InContent)
+	{
+		CompletePendingLoad(InPath, nullptr);
+		return;
+	}
+
+	// Same image under another path.
+	if (UTexture2D* Texture = FindByHash(InContentHash))
+	{
+		AddPath(InPath, InTimeStamp, InContentHash);
+		CompletePendingLoad(InPath, Texture);
+		return;
+	}
+
+	// The module has to be loaded on the game thread, decoding is safe from any thread.
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::Get().LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	const TWeakPtr<FRCExternalTextureCache> WeakCache = AsShared();
+
+	Async(EAsyncExecution::ThreadPool, [&ImageWrapperModule, WeakCache, Path = InPath, InTimeStamp, InContentHash, Content = MoveTemp(InContent)]()
+	{
+		TSharedPtr<FImage> Image = MakeShared<FImage>();
+		if (!ImageWrapperModule.DecompressImage(Content->GetData(), Content->Num(), *Image))
+		{
+			Image.Reset();
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakCache, Path, InTimeStamp, InContentHash, Image = MoveTemp(Image)]()
+		{
+			if (const TSharedPtr<FRCExternalTextureCache> Cache = WeakCache.Pin())
+			{
+				Cache->OnContentDecoded(Path, InTimeStamp, InContentHash, Image);
+			}
+		});
+	});
+}
+
+void FRCExternalTextureCache::OnContentDecoded(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash, TSharedPtr<FImage> InImage)
+{
+	UTexture2D* Texture = InImage ? FImageUtils::CreateTexture2DFromImage(*InImage) : nullptr;
+	if (Texture)
+	{
+		Add(InPath, InTimeStamp, InContentHash, Texture, InImage->RawData.Num());
+	}
+
+	CompletePendingLoad(InPath, Texture);
+}
+
+void FRCExternalTextureCache::Add(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash, UTexture2D* InTexture, int64 InSizeBytes)
+{
+	const int64 MaxSizeBytes = (int64)FMath::Max(CVarRemoteControlSetAssetByPathTextureCacheSizeMB.GetValueOnGameThread(), 0) * 1024 * 1024;
+	if (InSizeBytes > MaxSizeBytes || Textures.Contains(InContentHash))
+	{
+		return;
+	}
+
+	while (Textures.Num() && SizeBytes + InSizeBytes > MaxSizeBytes)
+	{
+		TMap<uint64, FTextureEntry>::TIterator LeastRecent = Textures.CreateIterator();
+		for (TMap<uint64, FTextureEntry>::TIterator It = Textures.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastAccess < LeastRecent.Value().LastAccess)
+			{
+				LeastRecent = It;
+			}
+		}
+
+		const uint64 EvictedHash = LeastRecent.Key();
+		SizeBytes -= LeastRecent.Value().SizeBytes;
+		LeastRecent.RemoveCurrent();
+
+		for (TMap<FString, FPathEntry>::TIterator It = Paths.CreateIterator(); It; ++It)
+		{
+			if (It.Value().ContentHash == EvictedHash)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	SizeBytes += InSizeBytes;
+	Textures.Add(InContentHash, FTextureEntry{ InTexture, InSizeBytes, ++AccessCounter });
+	AddPath(InPath, InTimeStamp, InContentHash);
+}
+
+void FRCExternalTextureCache::AddPath(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash)
+{
+	Paths.Add(InPath, FPathEntry{ InContentHash, InTimeStamp });
+}
+
+void FRCExternalTextureCache::CompletePendingLoad(const FString& InPath, UTexture2D* InTexture)
+{
+	TArray<FOnTextureLoaded> Callbacks;
+	PendingLoads.RemoveAndCopyValue(InPath, Callbacks);
+
+	for (const FOnTextureLoaded& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound(InTexture);
+	}
+}
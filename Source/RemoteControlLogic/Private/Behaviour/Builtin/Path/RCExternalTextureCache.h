@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UTexture2D;
+struct FImage;
+
+/**
+ * Textures loaded from local files or http urls by the Set Asset By Path behaviour.
+ * Files are read and decoded on worker threads, only the texture creation happens on the game thread.
+ * Textures are cached by content hash, and by path so reloading a path only costs a timestamp check,
+ * the least recently used ones are evicted once they exceed RemoteControl.SetAssetByPath.TextureCacheSizeMB.
+ */
+class FRCExternalTextureCache : public FGCObject, public TSharedFromThis<FRCExternalTextureCache>
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnTextureLoaded, UTexture2D* /*Texture, nullptr if it couldn't be loaded*/);
+
+	/** Creates the cache, called on module startup. */
+	static void Startup();
+
+	/** Destroys the cache, called on module shutdown. */
+	static void Shutdown();
+
+	/** Returns the cache, nullptr outside of the module lifetime. */
+	static TSharedPtr<FRCExternalTextureCache> Get();
+
+	/**
+	 * Loads the texture at a local file path or http url.
+	 * The callback is called immediately if the texture is cached, otherwise on the game thread once the texture is created.
+	 */
+	void Load(const FString& InPath, FOnTextureLoaded InOnLoaded);
+
+	/** Loads a texture into the cache ahead of its use. */
+	void Prefetch(const FString& InPath);
+
+	//~ Begin FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject interface
+
+private:
+	friend class FRCExternalTextureCacheEvictionTest;
+
+	/** Returns the texture cached for a path, nullptr if it isn't cached or the file was modified since. */
+	UTexture2D* FindByPath(const FString& InPath, const FDateTime& InTimeStamp);
+
+	/** Returns the texture cached for a content hash, nullptr if it isn't cached. */
+	UTexture2D* FindByHash(uint64 InContentHash);
+
+	/** Reads the content of a path on a worker thread, or through an http request. */
+	void ReadContent(const FString& InPath, const FDateTime& InTimeStamp);
+
+	/** Hashes the content of a path on a worker thread and hands it back to the cache on the game thread. */
+	static void HashContent(TWeakPtr<FRCExternalTextureCache> InWeakCache, const FString& InPath, const FDateTime& InTimeStamp, TSharedPtr<TArray<uint8>> InContent);
+
+	/** Called on the game thread once the content of a path was read and hashed. */
+	void OnContentRead(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash, TSharedPtr<TArray<uint8>> InContent);
+
+	/** Called on the game thread once the content of a path was decoded. */
+	void OnContentDecoded(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash, TSharedPtr<FImage> InImage);
+
+	/** Caches a texture, evicting the least recently used ones until it fits in the memory budget. */
+	void Add(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash, UTexture2D* InTexture, int64 InSizeBytes);
+
+	/** Caches the content hash of a path. */
+	void AddPath(const FString& InPath, const FDateTime& InTimeStamp, uint64 InContentHash);
+
+	/** Calls back every load waiting on a path. */
+	void CompletePendingLoad(const FString& InPath, UTexture2D* InTexture);
+
+private:
+	struct FPathEntry
+	{
+		/** Hash of the content of the path when it was loaded. */
+		uint64 ContentHash = 0;
+
+		/** Modification time of the file when it was loaded, MinValue for urls. */
+		FDateTime TimeStamp;
+	};
+
+	struct FTextureEntry
+	{
+		TObjectPtr<UTexture2D> Texture;
+
+		/** Size of the decoded image. */
+		int64 SizeBytes = 0;
+
+		/** Value of AccessCounter when the texture was last used. */
+		uint64 LastAccess = 0;
+	};
+
+	/** Content hash of each loaded path. */
+	TMap<FString, FPathEntry> Paths;
+
+	/** Cached textures by content hash. */
+	TMap<uint64, FTextureEntry> Textures;
+
+	/** Total size of the cached textures. */
+	int64 SizeBytes = 0;
+
+	/** Incremented every time a texture is used, to find the least recently used one. */
+	uint64 AccessCounter = 0;
+
+	/** Loads waiting on a path that is being read or decoded. */
+	TMap<FString, TArray<FOnTextureLoaded>> PendingLoads;
+};
@@ -4,6 +4,7 @@
 
 #include "Backends/CborStructDeserializerBackend.h"
 #include "Backends/CborStructSerializerBackend.h"
+#include "Behaviour/Builtin/Path/RCExternalTextureCache.h"
 #include "Components/MeshComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Controller/RCController.h"
@@ -12,15 +13,10 @@
 #include "Engine/Texture2D.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Engine/World.h"
-#include "HttpManager.h"
-#include "HttpModule.h"
 #include "IRemoteControlModule.h"
 #include "IRemoteControlPropertyHandle.h"
-#include "Interfaces/IHttpResponse.h"
-#include "Kismet/KismetRenderingLibrary.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstance.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "RCVirtualProperty.h"
 #include "RCVirtualPropertyContainer.h"
@@ -36,6 +32,7 @@ void URCSetAssetByPathBehaviour::Initialize()
 {
 	PropertyInContainer->AddProperty(SetAssetByPathBehaviourHelpers::DefaultInput, URCController::StaticClass(), EPropertyBagPropertyType::String);
 	UpdateTargetEntity();
+	PrefetchExternalAssets();
 	
 	Super::Initialize();
 }
@@ -85,7 +82,25 @@ void URCSetAssetByPathBehaviour::PostLoad()
 	}
 	PathStruct.PathArray_DEPRECATED.Empty();
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		// The path is built from the controller value, make sure it is loaded before reading it.
+		if (URCController* Controller = ControllerWeakPtr.Get())
+		{
+			Controller->ConditionalPostLoad();
+		}
+		PrefetchExternalAssets();
+	}
+}
+
+#if WITH_EDITOR
+void URCSetAssetByPathBehaviour::PostEditUndo()
+{
+	Super::PostEditUndo();
+	PrefetchExternalAssets();
 }
+#endif
 
 bool URCSetAssetByPathBehaviour::SetAssetByPath(const FString& AssetPath, const FString& DefaultString)
 {
@@ -127,31 +142,7 @@ bool URCSetAssetByPathBehaviour::SetAssetByPath(const FString& AssetPath, const
 			return FText::FromString(FString("Path Behaviour attempts to set Asset to %s") + *AssetPath + *ControllerString);
 		});
 
-#if WITH_EDITOR
-		FEditPropertyChain PropertyChain;
-		PropertyChain.AddHead(Property);
-		RemoteControlProperty->GetBoundObject()->PreEditChange(PropertyChain);
-#endif
-		if (SetExternalAsset(AssetPath + ControllerString))
-		{
-#if WITH_EDITOR
-			FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet);
-			RemoteControlProperty->GetBoundObject()->PostEditChangeProperty(ChangedEvent);
-#endif
-			
-			return true;
-		}
-
-		FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, [AssetPath, DefaultString]
-		{
-			return FText::FromString(FString("Path Behaviour attempts to set Asset to %s") + *AssetPath + *DefaultString);
-		});
-		if (!DefaultString.IsEmpty() && SetExternalAsset(AssetPath + DefaultString))
-		{
-			return true;
-		}
-
-		return false;
+		return SetExternalAsset(AssetPath + ControllerString, DefaultString.IsEmpty() ? FString() : AssetPath + DefaultString);
 	}
 
 	FSoftObjectPath MainObjectRef(AssetPath + ControllerString);
@@ -227,19 +218,8 @@ bool URCSetAssetByPathBehaviour::SetInternalAsset(UObject* SetterObject)
 		return false;
 	}
 	
-	const TWeakObjectPtr<URemoteControlPreset> PresetPtr = Controller->PresetWeakPtr;
-	
-	TArray<TWeakPtr<FRemoteControlProperty>> ExposedProperties = PresetPtr->GetExposedEntities<FRemoteControlProperty>();
-
-	if (const TWeakPtr<FRemoteControlProperty>* ExposedPropertyPtr = ExposedProperties.FindByPredicate([this](const TWeakPtr<FRemoteControlProperty>& Property){ return Property.Pin()->GetLabel() == TargetEntity->GetLabel(); }))
+	if (const TSharedPtr<FRemoteControlProperty> ExposedProperty = FindTargetProperty(Controller->PresetWeakPtr.Get()))
 	{
-		const TSharedPtr<FRemoteControlProperty> ExposedProperty = (*ExposedPropertyPtr).Pin();
-		if (!ExposedProperty)
-		{
-			ensureMsgf(false, TEXT("Exposed Property is not valid."));
-			return false;
-		}
-		
 		if (AssetClass == UStaticMesh::StaticClass() && SetterObject->IsA(UStaticMesh::StaticClass()))
 		{
 			UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(ExposedProperty->GetBoundObject());
@@ -396,7 +376,17 @@ TWeakPtr<const FRemoteControlEntity> URCSetAssetByPathBehaviour::GetTargetEntity
 	return TargetEntity;
 }
 
-bool URCSetAssetByPathBehaviour::SetExternalAsset(FString InExternalPath)
+TSharedPtr<FRemoteControlProperty> URCSetAssetByPathBehaviour::FindTargetProperty(URemoteControlPreset* InPreset) const
+{
+	if (!InPreset || !TargetEntity)
+	{
+		return nullptr;
+	}
+
+	return InPreset->GetExposedEntity<FRemoteControlProperty>(InPreset->GetExposedEntityId(TargetEntity->GetLabel())).Pin();
+}
+
+bool URCSetAssetByPathBehaviour::SetExternalAsset(const FString& InExternalPath, const FString& InDefaultPath)
 {
 	URCController* Controller = ControllerWeakPtr.Get();
 
@@ -409,48 +399,93 @@ bool URCSetAssetByPathBehaviour::SetExternalAsset(FString InExternalPath)
 	{
 		return false;
 	}
-	
-	URemoteControlPreset* PresetPtr = Controller->PresetWeakPtr.Get();
-	if (!PresetPtr)
+
+	if (!FindTargetProperty(Controller->PresetWeakPtr.Get()))
 	{
+		FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, []
+		{
+			return FText::FromString(TEXT("Path Behaviour Exposed Property not found"));
+		});
 		return false;
 	}
-	
-	TArray<TWeakPtr<FRemoteControlProperty>> ExposedProperties = PresetPtr->GetExposedEntities<FRemoteControlProperty>();
-	const TWeakPtr<FRemoteControlProperty>* ExposedPropertyPtr = ExposedProperties.FindByPredicate([this](const TWeakPtr<FRemoteControlProperty>& Property)
+
+	const TSharedPtr<FRCExternalTextureCache> TextureCache = FRCExternalTextureCache::Get();
+	if (!TextureCache)
 	{
-		if (const TSharedPtr<FRemoteControlProperty> PinnedProperty = Property.Pin())
-		{
-			return PinnedProperty->GetLabel() == TargetEntity->GetLabel();
-		}
-		
 		return false;
-	});
+	}
 
-	const TSharedPtr<FRemoteControlProperty> RemoteControlProperty = ExposedPropertyPtr->Pin();
-	if (!RemoteControlProperty)
+	const uint32 LoadSerial = ++ExternalLoadSerial;
+	const TSharedRef<TOptional<bool>> LoadResult = MakeShared<TOptional<bool>>();
+	TextureCache->Load(InExternalPath, FRCExternalTextureCache::FOnTextureLoaded::CreateWeakLambda(this, [this, LoadSerial, InExternalPath, InDefaultPath, LoadResult](UTexture2D* InTexture)
 	{
-		FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, []
+		*LoadResult = OnExternalTextureLoaded(LoadSerial, InExternalPath, InDefaultPath, InTexture);
+	}));
+
+	// Cached textures are applied before Load returns, so their result is known. Otherwise the load is in flight and only its start can be reported.
+	return LoadResult->Get(true);
+}
+
+bool URCSetAssetByPathBehaviour::OnExternalTextureLoaded(uint32 InLoadSerial, const FString& InExternalPath, const FString& InDefaultPath, UTexture2D* InTexture)
+{
+	// A more recent load was requested while this one was in flight.
+	if (InLoadSerial != ExternalLoadSerial)
+	{
+		return false;
+	}
+
+	if (!InTexture)
+	{
+		FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, [InExternalPath]
 		{
-			return FText::FromString(TEXT("Path Behaviour Exposed Property not found"));
+			return FText::FromString(FString("Path Behaviour Set external Asset failed: ") + *InExternalPath);
 		});
+
+		if (!InDefaultPath.IsEmpty())
+		{
+			FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, [InDefaultPath]
+			{
+				return FText::FromString(FString("Path Behaviour attempts to set Asset to ") + *InDefaultPath);
+			});
+			return SetExternalAsset(InDefaultPath, FString());
+		}
+		return false;
+	}
+
+	const URCController* Controller = ControllerWeakPtr.Get();
+	if (!Controller)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FRemoteControlProperty> RemoteControlProperty = FindTargetProperty(Controller->PresetWeakPtr.Get());
+	FProperty* Property = RemoteControlProperty ? RemoteControlProperty->GetProperty() : nullptr;
+	UObject* BoundObject = RemoteControlProperty ? RemoteControlProperty->GetBoundObject() : nullptr;
+	if (!Property || !BoundObject)
+	{
 		return false;
 	}
 
-	if (!SetTextureFromPath(RemoteControlProperty, InExternalPath))
+#if WITH_EDITOR
+	FEditPropertyChain PropertyChain;
+	PropertyChain.AddHead(Property);
+	BoundObject->PreEditChange(PropertyChain);
+#endif
+	const bool bTextureSet = SetTextureAsset(RemoteControlProperty, InTexture);
+#if WITH_EDITOR
+	FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet);
+	BoundObject->PostEditChangeProperty(ChangedEvent);
+#endif
+
+	if (bTextureSet)
 	{
 		FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, [InExternalPath]
 		{
 			return FText::FromString(FString("Path Behaviour Set external Asset: ") + *InExternalPath);
 		});
-		return true;
 	}
 
-	FRemoteControlLogger::Get().Log(SetAssetByPathBehaviourHelpers::SetAssetByPathBehaviour, []
-	{
-		return FText::FromString(TEXT("Path Behaviour Set external Asset failed"));
-	});
-	return false;
+	return bTextureSet;
 }
 
 bool URCSetAssetByPathBehaviour::SetTextureAsset(TSharedPtr<FRemoteControlProperty> InRemoteControlPropertyPtr, UTexture* InObject)
@@ -520,45 +555,32 @@ void URCSetAssetByPathBehaviour::RefreshPathArray()
 	{
 		PathStruct.AssetPath.AddDefaulted();
 	}
-}
 
-bool URCSetAssetByPathBehaviour::SetTextureFromPath(TSharedPtr<FRemoteControlProperty> RCPropertyToSet, FString& FileName)
-{
-	// Local and Network Drives
-	if (FPaths::FileExists(FileName))
-	{
-		if (UTexture2D* LocalTexturePtr = UKismetRenderingLibrary::ImportFileAsTexture2D(this, FileName))
-		{
-			SetTextureAsset(RCPropertyToSet, LocalTexturePtr);
-			return true;
-		}
-	}
-	
-	// Http Link
-	TSharedRef<class IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &URCSetAssetByPathBehaviour::ReadFileHttpHandler, RCPropertyToSet);
-	HttpRequest->SetURL(FileName);
-	HttpRequest->SetVerb(TEXT("GET"));
-	return HttpRequest->ProcessRequest();
+	PrefetchExternalAssets();
 }
 
-void URCSetAssetByPathBehaviour::ReadFileHttpHandler(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TSharedPtr<FRemoteControlProperty> InRCPropertyToSet)
+void URCSetAssetByPathBehaviour::PrefetchExternalAssets()
 {
-	if (!HttpRequest.IsValid())
+	const TSharedPtr<FRCExternalTextureCache> TextureCache = FRCExternalTextureCache::Get();
+	if (bInternal || PathStruct.PrefetchInputs.IsEmpty() || !TextureCache || !ControllerWeakPtr.IsValid())
 	{
 		return;
 	}
 
-	if (bSucceeded && HttpResponse.IsValid())
+	const FString CurrentPath = GetCurrentPath();
+	for (const FString& PrefetchInput : PathStruct.PrefetchInputs)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("ReadFile request complete, Url=%s Code=%d"), *HttpRequest->GetURL(), HttpResponse->GetResponseCode());
-
-		const TArray<uint8> ResponseBuffer = HttpResponse->GetContent();
-		if (UTexture2D* HttpTexture = UKismetRenderingLibrary::ImportBufferAsTexture2D(this, ResponseBuffer))
-		{
-			SetTextureAsset(InRCPropertyToSet, HttpTexture);
-		}
+		TextureCache->Prefetch(CurrentPath + PrefetchInput);
 	}
 }
 
+void URCSetAssetByPathBehaviour::SetInternal(bool bInInternal)
+{
+	if (bInternal == bInInternal)
+	{
+		return;
+	}
 
+	bInternal = bInInternal;
+	PrefetchExternalAssets();
+}
@@ -7,12 +7,15 @@
 #include "Action/RCActionContainer.h"
 #include "Action/RCFunctionAction.h"
 #include "Action/RCPropertyAction.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Find.h"
 #include "Behaviour/Builtin/RangeMap/RCBehaviourRangeMapNode.h"
 #include "Behaviour/RCBehaviourNode.h"
 #include "Containers/Set.h"
 #include "Controller/RCController.h"
 #include "IRemoteControlPropertyHandle.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Misc/TransactionObjectEvent.h"
 #include "PropertyBag.h"
 #include "RCVirtualProperty.h"
 #include "RCVirtualPropertyContainer.h"
@@ -73,6 +76,20 @@ bool URCRangeMapBehaviour::IsSupportedActionLerpType(TObjectPtr<URCAction> InAct
 	return bIsNumeric || bIsVector || bIsRotator;
 }
 
+bool URCRangeMapBehaviour::UpdateInputRange()
+{
+	const URCVirtualPropertyBase* InputMinProperty = PropertyContainer->GetVirtualProperty(UE::RCRangeMapBehaviour::InputMin);
+	const URCVirtualPropertyBase* InputMaxProperty = PropertyContainer->GetVirtualProperty(UE::RCRangeMapBehaviour::InputMax);
+	if (!InputMinProperty || !InputMaxProperty)
+	{
+		return false;
+	}
+
+	InputMinProperty->GetValueDouble(InputMin);
+	InputMaxProperty->GetValueDouble(InputMax);
+	return true;
+}
+
 void URCRangeMapBehaviour::Refresh()
 {
 	URCController* Controller = ControllerWeakPtr.Get();
@@ -81,13 +98,11 @@ void URCRangeMapBehaviour::Refresh()
 		return;
 	}
 
-	if (!PropertyContainer->GetVirtualProperty(UE::RCRangeMapBehaviour::InputMin) || !PropertyContainer->GetVirtualProperty(UE::RCRangeMapBehaviour::InputMax))
+	// Step 0: Get All required Values, getting the current values set within the DetailPanel setting them up for our header.
+	if (!UpdateInputRange())
 	{
 		return;
 	}
-	// Step 0: Get All required Values, getting the current values set within the DetailPanel setting them up for our header.
-	PropertyContainer->GetVirtualProperty(UE::RCRangeMapBehaviour::InputMin)->GetValueDouble(InputMin);
-	PropertyContainer->GetVirtualProperty(UE::RCRangeMapBehaviour::InputMax)->GetValueDouble(InputMax);
 
 	Controller->GetValueFloat(ControllerFloatValue);
 	
@@ -99,46 +114,294 @@ void URCRangeMapBehaviour::Refresh()
 	}
 }
 
-bool URCRangeMapBehaviour::GetNearestActionByThreshold(TTuple<URCAction*, bool>& OutTuple)
+bool URCRangeMapBehaviour::IsStepTableUpToDate() const
 {
-	// Variables
-	TMap<double, URCAction*> NonLerpActions = GetNonLerpActions();
-	
-	TArray<double> InputActionArray;
-	NonLerpActions.GenerateKeyArray(InputActionArray);
+	return StepTable.NumActions == ActionContainer->GetActions().Num() && StepTable.NumRangeMapInputs == RangeMapActionContainer.Num();
+}
+
+void URCRangeMapBehaviour::InvalidateStepTable()
+{
+	StepTable.NumActions = INDEX_NONE;
+}
 
-	// Step 1: Convert to double for Kismet Operation and Normalize.
-	const double NormalizedControllerValue = UKismetMathLibrary::NormalizeToRange(ControllerFloatValue, InputMin, InputMax);
+void URCRangeMapBehaviour::CompileStepTable()
+{
+	StepTable = FStepTable();
+	StepTable.NumActions = ActionContainer->GetActions().Num();
+	StepTable.NumRangeMapInputs = RangeMapActionContainer.Num();
+
+	TMap<double, URCAction*> NonLerpSteps;
+	TMap<FGuid, TArray<TPair<double, const FRCRangeMapInput*>>> LerpStepsByField;
 
-	// Step 2: Go through each of the Action Input and look for the shortest distance
-	for (int InputIndex = 0; InputIndex < InputActionArray.Num(); InputIndex++)
+	for (URCAction* Action : ActionContainer->GetActions())
 	{
-		const double InputValue = InputActionArray[InputIndex];
-		const double NormalizedInputValue = UKismetMathLibrary::NormalizeToRange(InputValue, InputMin, InputMax);
-		const double ValueDifference = FMath::Abs(NormalizedInputValue - NormalizedControllerValue);
-		
-		if (InputActionArray.Num() > 1 && InputIndex > 0)
+		const FRCRangeMapInput* RangeMapInput = RangeMapActionContainer.Find(Action);
+		double InputValue;
+		if (!RangeMapInput || !RangeMapInput->GetInputValue(InputValue))
 		{
-			const double PrevNormalizedInputValue = UKismetMathLibrary::NormalizeToRange(InputActionArray[InputIndex-1], InputMin, InputMax);
-			const double PrevValueDifference = FMath::Abs(PrevNormalizedInputValue - NormalizedControllerValue);
-			
-			// Break out early in case previous Input had a lesser difference
-			if (PrevValueDifference <= ValueDifference)
+			continue;
+		}
+
+		if (IsSupportedActionLerpType(Action))
+		{
+			if (RangeMapInput->PropertyValue)
 			{
+				LerpStepsByField.FindOrAdd(Action->ExposedFieldId).Emplace(InputValue, RangeMapInput);
+			}
+		}
+		else
+		{
+			// Last action wins when several share a step.
+			NonLerpSteps.Add(InputValue, Action);
+		}
+	}
+
+	NonLerpSteps.KeySort(TLess<double>());
+	StepTable.NonLerpInputs.Reserve(NonLerpSteps.Num());
+	StepTable.NonLerpActions.Reserve(NonLerpSteps.Num());
+	for (const TPair<double, URCAction*>& NonLerpStep : NonLerpSteps)
+	{
+		StepTable.NonLerpInputs.Add(NonLerpStep.Key);
+		StepTable.NonLerpActions.Add(NonLerpStep.Value);
+	}
+
+	const URCController* RCController = ControllerWeakPtr.Get();
+	URemoteControlPreset* Preset = RCController ? RCController->PresetWeakPtr.Get() : nullptr;
+
+	for (TPair<FGuid, TArray<TPair<double, const FRCRangeMapInput*>>>& FieldSteps : LerpStepsByField)
+	{
+		TArray<TPair<double, const FRCRangeMapInput*>>& Steps = FieldSteps.Value;
+		if (Steps.Num() < 2)
+		{
+			// Not enough steps to lerp between.
+			continue;
+		}
+
+		Steps.StableSort([](const TPair<double, const FRCRangeMapInput*>& StepA, const TPair<double, const FRCRangeMapInput*>& StepB)
+		{
+			return StepA.Key < StepB.Key;
+		});
+
+		FLerpTrack Track;
+		Track.FieldId = FieldSteps.Key;
+
+		// The type of the first step drives the lerp.
+		const URCVirtualPropertySelfContainer* FirstValue = Steps[0].Value->PropertyValue;
+		switch (FirstValue->GetValueType())
+		{
+			case EPropertyBagPropertyType::Double:
+				Track.ValueType = ELerpValueType::Double;
+				break;
+			case EPropertyBagPropertyType::Float:
+				Track.ValueType = ELerpValueType::Float;
 				break;
+			case EPropertyBagPropertyType::Struct:
+				if (FirstValue->IsVectorType())
+				{
+					Track.ValueType = ELerpValueType::Vector;
+					break;
+				}
+				if (FirstValue->IsRotatorType())
+				{
+					Track.ValueType = ELerpValueType::Rotator;
+					break;
+				}
+				continue;
+			default:
+				ensureMsgf(false, TEXT("Unsupported Lerp Type."));
+				continue;
+		}
+
+		Track.Inputs.Reserve(Steps.Num());
+		Track.Values.Reserve(Steps.Num());
+		for (const TPair<double, const FRCRangeMapInput*>& Step : Steps)
+		{
+			const URCVirtualPropertySelfContainer* StepValue = Step.Value->PropertyValue;
+			FVector Value = FVector::ZeroVector;
+
+			switch (Track.ValueType)
+			{
+				case ELerpValueType::Double:
+				{
+					StepValue->GetValueDouble(Value.X);
+					break;
+				}
+				case ELerpValueType::Float:
+				{
+					float FloatValue = 0.f;
+					StepValue->GetValueFloat(FloatValue);
+					Value.X = FloatValue;
+					break;
+				}
+				case ELerpValueType::Vector:
+				{
+					StepValue->GetValueVector(Value);
+					break;
+				}
+				case ELerpValueType::Rotator:
+				{
+					FRotator RotatorValue = FRotator::ZeroRotator;
+					StepValue->GetValueRotator(RotatorValue);
+					Value = FVector(RotatorValue.Pitch, RotatorValue.Yaw, RotatorValue.Roll);
+					break;
+				}
+			}
+
+			Track.Inputs.Add(Step.Key);
+			Track.Values.Add(Value);
+		}
+
+		if (Preset)
+		{
+			if (const TSharedPtr<FRemoteControlProperty> RCProperty = Preset->GetExposedEntity<FRemoteControlProperty>(Track.FieldId).Pin())
+			{
+				if (RCProperty->GetProperty())
+				{
+					Track.PropertyHandle = RCProperty->GetPropertyHandle();
+				}
 			}
 		}
-		OutTuple = TTuple<URCAction*, bool>(NonLerpActions[InputValue], ValueDifference <= UE::RCRangeMapBehaviour::Threshold);
+
+		StepTable.LerpTracks.Add(MoveTemp(Track));
 	}
-	
+}
+
+URCAction* URCRangeMapBehaviour::GetNearestActionByThreshold(double InControllerValue) const
+{
+	const TArray<double>& Inputs = StepTable.NonLerpInputs;
+	if (Inputs.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// The nearest step is either the first one at or after the controller value, or the one before it.
+	int32 NearestIndex = FMath::Min(Algo::LowerBound(Inputs, InControllerValue), Inputs.Num() - 1);
+	if (NearestIndex > 0 && FMath::Abs(InControllerValue - Inputs[NearestIndex - 1]) <= FMath::Abs(Inputs[NearestIndex] - InControllerValue))
+	{
+		--NearestIndex;
+	}
+
+	// The threshold applies to normalized values.
+	const double NormalizedControllerValue = UKismetMathLibrary::NormalizeToRange(InControllerValue, InputMin, InputMax);
+	const double NormalizedInputValue = UKismetMathLibrary::NormalizeToRange(Inputs[NearestIndex], InputMin, InputMax);
+	if (FMath::Abs(NormalizedInputValue - NormalizedControllerValue) > UE::RCRangeMapBehaviour::Threshold)
+	{
+		return nullptr;
+	}
+
+	return StepTable.NonLerpActions[NearestIndex].Get();
+}
+
+bool URCRangeMapBehaviour::FindLerpSegment(const FLerpTrack& InTrack, double InControllerValue, int32& OutMinStepIndex, double& OutAlpha)
+{
+	const TArray<double>& Inputs = InTrack.Inputs;
+
+	// Last step at or before the controller value, the last step can only end a segment.
+	OutMinStepIndex = FMath::Min(Algo::UpperBound(Inputs, InControllerValue), Inputs.Num() - 1) - 1;
+	if (OutMinStepIndex < 0 || Inputs[OutMinStepIndex + 1] < InControllerValue)
+	{
+		return false;
+	}
+
+	OutAlpha = UKismetMathLibrary::NormalizeToRange(InControllerValue, Inputs[OutMinStepIndex], Inputs[OutMinStepIndex + 1]);
+	return true;
+}
+
+FVector URCRangeMapBehaviour::LerpTrackValue(const FLerpTrack& InTrack, int32 InMinStepIndex, double InAlpha)
+{
+	const FVector& MinValue = InTrack.Values[InMinStepIndex];
+	const FVector& MaxValue = InTrack.Values[InMinStepIndex + 1];
+
+	if (InTrack.ValueType == ELerpValueType::Rotator)
+	{
+		const FRotator Result = UKismetMathLibrary::RLerp(FRotator(MinValue.X, MinValue.Y, MinValue.Z), FRotator(MaxValue.X, MaxValue.Y, MaxValue.Z), InAlpha, true);
+		return FVector(Result.Pitch, Result.Yaw, Result.Roll);
+	}
+
+	return FMath::Lerp(MinValue, MaxValue, InAlpha);
+}
+
+void URCRangeMapBehaviour::ApplyLerpTrack(const FLerpTrack& InTrack, double InControllerValue)
+{
+	// The handle outlives the exposed field if it was unexposed since the table was compiled.
+	if (!InTrack.PropertyHandle || !InTrack.PropertyHandle->GetRCProperty())
+	{
+		return;
+	}
+
+	int32 MinStepIndex;
+	double Alpha;
+	if (!FindLerpSegment(InTrack, InControllerValue, MinStepIndex, Alpha))
+	{
+		return;
+	}
+
+	const FVector Result = LerpTrackValue(InTrack, MinStepIndex, Alpha);
+	switch (InTrack.ValueType)
+	{
+		case ELerpValueType::Double:
+			InTrack.PropertyHandle->SetValue(Result.X);
+			break;
+		case ELerpValueType::Float:
+			InTrack.PropertyHandle->SetValue(static_cast<float>(Result.X));
+			break;
+		case ELerpValueType::Vector:
+			InTrack.PropertyHandle->SetValue(Result);
+			break;
+		case ELerpValueType::Rotator:
+			InTrack.PropertyHandle->SetValue(FRotator(Result.X, Result.Y, Result.Z));
+			break;
+	}
+}
+
+bool URCRangeMapBehaviour::EvaluateField(const FGuid& InFieldId, TConstArrayView<double> InControllerValues, TArray<TOptional<FVector>>& OutValues)
+{
+	OutValues.Reset();
+
+	if (!UpdateInputRange() || InputMax <= InputMin)
+	{
+		return false;
+	}
+
+	if (!IsStepTableUpToDate())
+	{
+		CompileStepTable();
+	}
+
+	const FLerpTrack* Track = Algo::FindBy(StepTable.LerpTracks, InFieldId, &FLerpTrack::FieldId);
+	if (!Track)
+	{
+		return false;
+	}
+
+	OutValues.Reserve(InControllerValues.Num());
+	for (const double ControllerValue : InControllerValues)
+	{
+		int32 MinStepIndex;
+		double Alpha;
+		if (FindLerpSegment(*Track, FMath::Clamp(ControllerValue, InputMin, InputMax), MinStepIndex, Alpha))
+		{
+			OutValues.Emplace(LerpTrackValue(*Track, MinStepIndex, Alpha));
+		}
+		else
+		{
+			OutValues.AddDefaulted();
+		}
+	}
+
 	return true;
 }
 
 bool FRCRangeMapInput::SetInputValue(double InValue) const
 {
-	if (InputProperty)
+	if (InputProperty && InputProperty->SetValueDouble(InValue))
 	{
-		return InputProperty->SetValueDouble(InValue);
+		// Step inputs are outered to the behaviour they belong to.
+		if (URCRangeMapBehaviour* Behaviour = InputProperty->GetTypedOuter<URCRangeMapBehaviour>())
+		{
+			Behaviour->InvalidateStepTable();
+		}
+		return true;
 	}
 	return false;
 }
@@ -167,10 +430,43 @@ void URCRangeMapBehaviour::NotifyActionValueChanged(URCAction* InChangedAction)
 {
 	if (InChangedAction)
 	{
+		// Step values are baked in the step table.
+		InvalidateStepTable();
 		ExecuteSingleAction(InChangedAction);
 	}
 }
 
+void URCRangeMapBehaviour::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+#if WITH_EDITOR
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FCoreUObjectDelegates::OnObjectTransacted.AddUObject(this, &URCRangeMapBehaviour::OnObjectTransacted);
+	}
+#endif
+}
+
+void URCRangeMapBehaviour::BeginDestroy()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectTransacted.RemoveAll(this);
+#endif
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void URCRangeMapBehaviour::OnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InTransactionEvent)
+{
+	if (InTransactionEvent.GetEventType() == ETransactionObjectEventType::UndoRedo && InObject && (InObject == this || InObject->IsIn(this)))
+	{
+		InvalidateStepTable();
+	}
+}
+#endif
+
 void URCRangeMapBehaviour::ExecuteInternal(const TSet<TObjectPtr<URCAction>>& InActionsToExecute)
 {
 	Refresh();
@@ -201,166 +497,27 @@ void URCRangeMapBehaviour::ExecuteInternal(const TSet<TObjectPtr<URCAction>>& In
 	RCController->GetValueFloat(ControllerFloatValue);
 	ControllerFloatValue = FMath::Clamp(ControllerFloatValue, InputMin, InputMax);
 
-	TTuple<URCAction*, bool> NearestAction;
-	if (GetNearestActionByThreshold(NearestAction) && NearestAction.Value)
+	if (!IsStepTableUpToDate())
 	{
-		// Execute nearest Action in case its under/passes the Threshold in distance.
-		NearestAction.Key->Execute();
+		CompileStepTable();
 	}
 
-	// Apply Lerp if possible
-	TMap<FGuid, TTuple<URCAction*, URCAction*>> LerpActions;
-	TSet<TObjectPtr<URCAction>> RangeMapActionToExecute;
-
-	// Do this only when the action to execute is 1 otherwise pass the entire array
-	if (InActionsToExecute.Num() == 1)
-	{
-		// Get the single action
-		const TObjectPtr<URCAction> ActionToExecute = InActionsToExecute.Array()[0];
-
-		// Get all actions that are based on the same exposed property
-		for (const TObjectPtr<URCAction>& Action : ActionContainer->GetActions())
-		{
-			if (Action->ExposedFieldId == ActionToExecute->ExposedFieldId)
-			{
-				RangeMapActionToExecute.Add(Action);
-			}
-		}
-	}
-	else
+	// Execute nearest Action in case its under/passes the Threshold in distance.
+	if (URCAction* NearestAction = GetNearestActionByThreshold(ControllerFloatValue))
 	{
-		RangeMapActionToExecute = InActionsToExecute;
+		NearestAction->Execute();
 	}
 
-	if (!GetRangeValuePairsForLerp(LerpActions, RangeMapActionToExecute))
-	{
-		return;
-	}
-
-	for (const TTuple<FGuid, TTuple<URCAction*, URCAction*>>& LerpAction : LerpActions)
-	{
-		URemoteControlPreset* Preset = RCController->PresetWeakPtr.Get();
-		if (!Preset)
-		{
-			ensureMsgf(false, TEXT("Preset is invalid or unavailable."));
-			return;
-		}
-		FGuid CurrentFieldId = LerpAction.Key;
-
-		// Get the InputValue given for the FGuid
-		const URCAction* MinActionOfPair = LerpAction.Value.Key;
-		const URCAction* MaxActionOfPair = LerpAction.Value.Value;
-
-		if (!MinActionOfPair || !MaxActionOfPair)
-		{
-			return;
-		}
-
-		const FRCRangeMapInput* MinRangeMapInput = RangeMapActionContainer.Find(MinActionOfPair);
-		const FRCRangeMapInput* MaxRangeMapInput = RangeMapActionContainer.Find(MaxActionOfPair);
-
-		if (!(MinRangeMapInput && MaxRangeMapInput))
-		{
-			ensureMsgf(false, TEXT("%s is an invalid pointer."), MinRangeMapInput ? TEXT("MaxRangeMapInput") : TEXT("MinRangeMapInput"));
-			return;
-		}
-
-		double MinRangeValue, MaxRangeValue;
-		bool bRes1 = MinRangeMapInput->GetInputValue(MinRangeValue);
-		bool bRes2 = MaxRangeMapInput->GetInputValue(MaxRangeValue);
-		if (!(bRes1 && bRes2))
-		{
-			continue; // ideally this should never happen
-		}
-
-		// Denormalize and Map them based on our Min and Max Value
-		const double MappedMinInput = UKismetMathLibrary::Lerp(InputMin, InputMax, UKismetMathLibrary::NormalizeToRange(MinRangeValue, InputMin, InputMax));
-		const double MappedMaxInput = UKismetMathLibrary::Lerp(InputMin, InputMax, UKismetMathLibrary::NormalizeToRange(MaxRangeValue, InputMin, InputMax));
-
-		// Normalize our Controller based on the new MappedMinInput and MappedMaxInput Range.
-		double CustomNormalizedInputValue = UKismetMathLibrary::NormalizeToRange(ControllerFloatValue, MappedMinInput, MappedMaxInput);
+	// Apply Lerp if possible, only on the field of the action when executing a single one.
+	const FGuid* SingleFieldId = InActionsToExecute.Num() == 1 ? &(*InActionsToExecute.CreateConstIterator())->ExposedFieldId : nullptr;
 
-		// Apply value based on type
-		switch(MinRangeMapInput->PropertyValue->GetValueType())
-		{
-			case EPropertyBagPropertyType::Double:
-			{
-				double MinRangeDouble;
-				double MaxRangeDouble;
-
-				MinRangeMapInput->PropertyValue->GetValueDouble(MinRangeDouble);
-				MaxRangeMapInput->PropertyValue->GetValueDouble(MaxRangeDouble);
-
-				const double ResultDouble = UKismetMathLibrary::Lerp(MinRangeDouble, MaxRangeDouble, CustomNormalizedInputValue);
-				if (const TSharedPtr<FRemoteControlProperty> RCProperty = Preset->GetExposedEntity<FRemoteControlProperty>(CurrentFieldId).Pin())
-				{
-					RCProperty->GetPropertyHandle()->SetValue(ResultDouble);
-				}
-				
-				break;
-			}
-			case EPropertyBagPropertyType::Float:
-			{
-				float MinRangeFloat;
-				float MaxRangeFloat;
-
-				MinRangeMapInput->PropertyValue->GetValueFloat(MinRangeFloat);
-				MaxRangeMapInput->PropertyValue->GetValueFloat(MaxRangeFloat);
-
-				const float ResultFloat = UKismetMathLibrary::Lerp(MinRangeFloat, MaxRangeFloat, CustomNormalizedInputValue);
-				if (const TSharedPtr<FRemoteControlProperty> RCProperty = Preset->GetExposedEntity<FRemoteControlProperty>(CurrentFieldId).Pin())
-				{
-					RCProperty->GetPropertyHandle()->SetValue(ResultFloat);
-				}
-				
-				break;
-			}
-			case EPropertyBagPropertyType::Struct:
-			{
-				ApplyLerpOnStruct(MinRangeMapInput, MaxRangeMapInput, CustomNormalizedInputValue, CurrentFieldId);
-				
-				break;
-			}
-			default:
-			// Shouldn't happen.
-			ensureMsgf(false, TEXT("Unsupported Lerp Type."));
-		}
-	}
-}
-
-void URCRangeMapBehaviour::GetLerpActions(TMap<FGuid, TArray<URCAction*>>& OutNumericActionsByField, const TSet<TObjectPtr<URCAction>>& InActionsToExecute)
-{
-	for (URCAction* Action : InActionsToExecute)
+	for (const FLerpTrack& Track : StepTable.LerpTracks)
 	{
-		TArray<URCAction*>& LerpActionArray = OutNumericActionsByField.FindOrAdd(Action->ExposedFieldId);
-		
-		// Step 01: Find Action
-		if (IsSupportedActionLerpType(Action))
+		if (!SingleFieldId || Track.FieldId == *SingleFieldId)
 		{
-			// Step 02: Add Action if it's numerical
-			LerpActionArray.Add(Action);
+			ApplyLerpTrack(Track, ControllerFloatValue);
 		}
 	}
-
-	// Step 03: Sort actions using their InputValue
-	for (TTuple<FGuid, TArray<URCAction*>>& NumericActionTuple : OutNumericActionsByField)
-	{
-		TArray<URCAction*>& ArrayToSort = NumericActionTuple.Value;
-
-		Algo::Sort(ArrayToSort, [this](const URCAction* ActionA, const URCAction* ActionB)
-		{
-			double A, B;
-			bool bRes1 = GetValueForAction(ActionA, A);
-			bool bRes2 = GetValueForAction(ActionB, B);
-
-			if (bRes1 && bRes2)
-			{
-				return A < B;
-			}
-
-			return false;
-		});
-	}
 }
 
 URCAction* URCRangeMapBehaviour::DuplicateAction(URCAction* InAction, URCBehaviour* InBehaviour)
@@ -390,6 +547,7 @@ URCAction* URCRangeMapBehaviour::DuplicateAction(URCAction* InAction, URCBehavio
 			{
 				const FRCRangeMapInput NewData(ActionInputProperty, ActionValueProperty);
 				InBehaviourRangeMap->RangeMapActionContainer.Add(NewAction, NewData);
+				InBehaviourRangeMap->InvalidateStepTable();
 			}
 		}
 	}
@@ -415,102 +573,7 @@ void URCRangeMapBehaviour::OnActionAdded(URCAction* Action, URCVirtualPropertySe
 	FRCRangeMapInput RangeMapInput = FRCRangeMapInput(InputProperty, InPropertyValue);
 
 	RangeMapActionContainer.Add(Action, MoveTemp(RangeMapInput));
-}
-
-bool URCRangeMapBehaviour::GetRangeValuePairsForLerp(TMap<FGuid, TTuple<URCAction*, URCAction*>>& OutPairs, const TSet<TObjectPtr<URCAction>>& InActionsToExecute)
-{
-	const double NormalizedControllerValue = UKismetMathLibrary::NormalizeToRange(ControllerFloatValue, InputMin, InputMax);
-
-	TMap<FGuid, TArray<URCAction*>> LerpActionMap;
-	GetLerpActions(LerpActionMap, InActionsToExecute);
-	
-	for (TTuple<FGuid, TArray<URCAction*>>& NumericActionTuple : LerpActionMap)
-	{
-		if (NumericActionTuple.Value.Num() < 2)
-		{
-			// Skip and continue early if the Array has less Numeric Values needed to actually Lerp
-			continue;
-		}
-
-		// Intermediary calculations of Lerp for in-between Lerp.
-		FRCRangeMapInput* MaxRangeMap = nullptr;
-		FRCRangeMapInput* MinRangeMap = nullptr;
-		URCAction* MaxAction = nullptr;
-		URCAction* MinAction = nullptr;
-		
-		for (URCAction* CurrentAction : NumericActionTuple.Value)
-		{
-			FRCRangeMapInput* RangeMap = RangeMapActionContainer.Find(CurrentAction);
-			if (!RangeMap)
-			{
-				// Shouldn't happen, but skip if it does
-				continue;
-			}
-
-			double Value;
-			bool bRes = RangeMap->GetInputValue(Value);
-			if (!bRes)
-			{
-				continue;
-			}
-
-			const double NormalizedValue = UKismetMathLibrary::NormalizeToRange(Value, InputMin, InputMax);
-
-			// Deal with the nullptr
-			if (NormalizedValue <= NormalizedControllerValue && NumericActionTuple.Value.Last() != CurrentAction)
-			{
-				MinAction = CurrentAction;
-				MinRangeMap = RangeMap;
-				
-				continue;
-			}
-
-			if (NormalizedControllerValue <= NormalizedValue)
-			{
-				MaxAction = CurrentAction;
-				MaxRangeMap = RangeMap;
-
-				if (MinRangeMap)
-				{
-					break;
-				}
-				
-				continue;
-			}
-
-			// Ensure there are no nullptr
-			if (!MinRangeMap || !MaxRangeMap)
-			{
-				return false;
-			}
-		}
-
-		OutPairs.Add(NumericActionTuple.Key, TTuple<URCAction*, URCAction*>(MinAction, MaxAction));
-	}
-	
-	return true;
-}
-
-TMap<double, URCAction*> URCRangeMapBehaviour::GetNonLerpActions()
-{
-	TMap<double, URCAction*> ActionMap;
-	
-	for (URCAction* Action : ActionContainer->GetActions())
-	{
-		if (!IsSupportedActionLerpType(Action))
-		{
-			if (const FRCRangeMapInput* RangeMapInput = RangeMapActionContainer.Find(Action))
-			{
-				double InputValue;
-				if (RangeMapInput->GetInputValue(InputValue))
-				{
-					ActionMap.Add(InputValue, Action);
-				}
-			}
-		}
-	}
-
-	return ActionMap;
+	InvalidateStepTable();
 }
 
 bool URCRangeMapBehaviour::CanHaveActionForField(const TSharedPtr<FRemoteControlField> InRemoteControlField) const
@@ -530,54 +593,6 @@ bool URCRangeMapBehaviour::CanHaveActionForField(const TSharedPtr<FRemoteControl
 	return false;
 }
 
-void URCRangeMapBehaviour::ApplyLerpOnStruct(const FRCRangeMapInput* MinRangeInput, const FRCRangeMapInput* MaxRangeInput, const double& InputAlpha, const FGuid& FieldId)
-{
-	const URCController* RCController = ControllerWeakPtr.Get();
-	if (!RCController)
-	{
-		ensureMsgf(false, TEXT("Remote Controller is invalid or unavailable."));
-		return;
-	}
-	
-	URemoteControlPreset* Preset = RCController->PresetWeakPtr.Get();
-	if (!Preset)
-	{
-		ensureMsgf(false, TEXT("Preset is invalid or unavailable."));
-		return;
-	}
-	
-	// Check whether its a Rotator or FVector based on the MinRangeInput
-	if (MinRangeInput->PropertyValue->IsVectorType())
-	{
-		FVector MinRangeVector;
-		FVector MaxRangeVector;
-
-		MinRangeInput->PropertyValue->GetValueVector(MinRangeVector);
-		MaxRangeInput->PropertyValue->GetValueVector(MaxRangeVector);
-
-		const FVector ResultVector = UKismetMathLibrary::VLerp(MinRangeVector, MaxRangeVector, InputAlpha);
-		if (const TSharedPtr<FRemoteControlProperty> RCProperty = Preset->GetExposedEntity<FRemoteControlProperty>(FieldId).Pin())
-		{
-			RCProperty->GetPropertyHandle()->SetValue(ResultVector);
-		}
-	}
-
-	if (MinRangeInput->PropertyValue->IsRotatorType())
-	{
-		FRotator MinRangeRotator;
-		FRotator MaxRangeRotator;
-
-		MinRangeInput->PropertyValue->GetValueRotator(MinRangeRotator);
-		MaxRangeInput->PropertyValue->GetValueRotator(MaxRangeRotator);
-
-		const FRotator ResultVector = UKismetMathLibrary::RLerp(MinRangeRotator, MaxRangeRotator, InputAlpha, true);
-		if (const TSharedPtr<FRemoteControlProperty> RCProperty = Preset->GetExposedEntity<FRemoteControlProperty>(FieldId).Pin())
-		{
-			RCProperty->GetPropertyHandle()->SetValue(ResultVector);
-		}
-	}
-}
-
 bool URCRangeMapBehaviour::IsActionUnique(const TSharedRef<const FRemoteControlField> InRemoteControlField, const double& InValue, const TSet<TObjectPtr<URCAction>>& InActions)
 {
 	const FGuid FieldId = InRemoteControlField->GetId();
@@ -22,6 +22,26 @@ void URCBehaviour::Execute()
 	ExecuteInternal(ActionContainer->GetActions());
 }
 
+void URCBehaviour::SetIsEnabled(bool bInIsEnabled)
+{
+	bIsEnabled = bInIsEnabled;
+
+	if (URCController* Controller = ControllerWeakPtr.Get())
+	{
+		Controller->InvalidateExecutionPlan();
+	}
+}
+
+void URCBehaviour::SetExecuteDuringPreChange(bool bInExecuteDuringPreChange)
+{
+	bExecuteBehavioursDuringPreChange = bInExecuteDuringPreChange;
+
+	if (URCController* Controller = ControllerWeakPtr.Get())
+	{
+		Controller->InvalidateExecutionPlan();
+	}
+}
+
 void URCBehaviour::ExecuteSingleAction(URCAction* InAction)
 {
 	if (InAction)
@@ -165,6 +185,17 @@ void URCBehaviour::ExecuteInternal(const TSet<TObjectPtr<URCAction>>& InActionsT
 }
 
 #if WITH_EDITOR
+void URCBehaviour::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo can toggle bIsEnabled back.
+	if (URCController* Controller = ControllerWeakPtr.Get())
+	{
+		Controller->InvalidateExecutionPlan();
+	}
+}
+
 const FText& URCBehaviour::GetDisplayName()
 {
 	if (!ensure(BehaviourNodeClass))
@@ -28,6 +28,8 @@ void URCController::PostEditUndo()
 {
 	Super::PostEditUndo();
 
+	InvalidateExecutionPlan();
+
 	OnBehaviourListModified.Broadcast();
 }
 #endif
@@ -43,6 +45,7 @@ URCBehaviour* URCController::AddBehaviour(TSubclassOf<URCBehaviourNode> InBehavi
 	NewBehaviour->Initialize();
 	
 	Behaviours.Add(NewBehaviour);
+	InvalidateExecutionPlan();
 
 	return NewBehaviour;
 }
@@ -80,6 +83,7 @@ URCBehaviour* URCController::CreateBehaviourWithoutCheck(TSubclassOf<URCBehaviou
 
 int32 URCController::RemoveBehaviour(URCBehaviour* InBehaviour)
 {
+	InvalidateExecutionPlan();
 	return Behaviours.Remove(InBehaviour);
 }
 
@@ -96,31 +100,61 @@ int32 URCController::RemoveBehaviour(const FGuid InBehaviourId)
 		}
 	}
 
+	InvalidateExecutionPlan();
 	return RemovedCount;
 }
 
 void URCController::EmptyBehaviours()
 {
 	Behaviours.Empty();
+	InvalidateExecutionPlan();
 }
 
 void URCController::ExecuteBehaviours(const bool bIsPreChange/* = false*/)
 {
-	for (URCBehaviour* Behaviour : Behaviours)
+	// The set of behaviours and their flags can only be modified through functions invalidating the plan.
+	if (ExecutionPlan.bIsInvalidated)
+	{
+		CompileExecutionPlan();
+	}
+
+	// Invalidating the plan while executing doesn't modify the arrays, so they can be iterated safely.
+	const TArray<TWeakObjectPtr<URCBehaviour>>& BehavioursToExecute = bIsPreChange ? ExecutionPlan.PreChangeBehaviours : ExecutionPlan.Behaviours;
+	for (int32 Index = 0; Index < BehavioursToExecute.Num(); ++Index)
 	{
-		if (!Behaviour->bIsEnabled)
+		if (URCBehaviour* Behaviour = BehavioursToExecute[Index].Get())
 		{
-			continue;
+			Behaviour->Execute();
 		}
+	}
+}
+
+void URCController::InvalidateExecutionPlan()
+{
+	ExecutionPlan.bIsInvalidated = true;
+}
 
-		if (bIsPreChange && !Behaviour->bExecuteBehavioursDuringPreChange)
+void URCController::CompileExecutionPlan()
+{
+	ExecutionPlan.Behaviours.Reset();
+	ExecutionPlan.PreChangeBehaviours.Reset();
+
+	for (URCBehaviour* Behaviour : Behaviours)
+	{
+		if (!Behaviour || !Behaviour->IsEnabled())
 		{
 			continue;
 		}
 
-		Behaviour->Execute();
+		ExecutionPlan.Behaviours.Add(Behaviour);
 
+		if (Behaviour->ShouldExecuteDuringPreChange())
+		{
+			ExecutionPlan.PreChangeBehaviours.Add(Behaviour);
+		}
 	}
+
+	ExecutionPlan.bIsInvalidated = false;
 }
 
 void URCController::OnPreChangePropertyValue()
@@ -141,6 +175,7 @@ URCBehaviour* URCController::DuplicateBehaviour(URCController* InController, URC
 	NewBehaviour->ControllerWeakPtr = InController;
 
 	InController->Behaviours.Add(NewBehaviour);
+	InController->InvalidateExecutionPlan();
 
 	return NewBehaviour;
 }
@@ -3,6 +3,7 @@
 #include "Modules/ModuleManager.h"
 
 #include "RemoteControlPreset.h"
+#include "Behaviour/Builtin/Path/RCExternalTextureCache.h"
 #include "Controller/RCControllerContainer.h"
 
 /**
@@ -15,11 +16,13 @@ public:
 	virtual void StartupModule() override
 	{
 		URemoteControlPreset::OnPostInitPropertiesRemoteControlPreset.AddRaw(this, &FRemoteControlLogicModule::OnPostInitPropertiesRemoteControlPreset);
+		FRCExternalTextureCache::Startup();
 	}
 
 	virtual void ShutdownModule() override
 	{
 		URemoteControlPreset::OnPostInitPropertiesRemoteControlPreset.RemoveAll(this);
+		FRCExternalTextureCache::Shutdown();
 	}
 	//~ End IModuleInterface
 
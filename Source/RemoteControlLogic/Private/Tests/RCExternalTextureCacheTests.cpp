@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Behaviour/Builtin/Path/RCExternalTextureCache.h"
+#include "Engine/Texture2D.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRCExternalTextureCacheEvictionTest, "Plugins.RemoteControl.Logic.ExternalTextureCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FRCExternalTextureCacheEvictionTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* CacheSizeVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("RemoteControl.SetAssetByPath.TextureCacheSizeMB"));
+	if (!TestNotNull(TEXT("The texture cache size console variable is registered"), CacheSizeVariable))
+	{
+		return false;
+	}
+
+	const int32 PreviousCacheSizeMB = CacheSizeVariable->GetInt();
+	CacheSizeVariable->Set(1, ECVF_SetByCode);
+
+	constexpr int64 MegaByte = 1024 * 1024;
+	const FString PathA = TEXT("C:/RCExternalTextureCacheTest/A.png");
+	const FString PathB = TEXT("C:/RCExternalTextureCacheTest/B.png");
+	const FString PathC = TEXT("C:/RCExternalTextureCacheTest/C.png");
+	const FString PathD = TEXT("C:/RCExternalTextureCacheTest/D.png");
+	const FDateTime TimeStamp(2024, 1, 1);
+
+	TStrongObjectPtr<UTexture2D> TextureA{ NewObject<UTexture2D>() };
+	TStrongObjectPtr<UTexture2D> TextureB{ NewObject<UTexture2D>() };
+	TStrongObjectPtr<UTexture2D> TextureC{ NewObject<UTexture2D>() };
+	TStrongObjectPtr<UTexture2D> TextureD{ NewObject<UTexture2D>() };
+
+	const TSharedRef<FRCExternalTextureCache> Cache = MakeShared<FRCExternalTextureCache>();
+
+	// 1. Textures fitting in the budget are all kept.
+	Cache->Add(PathA, TimeStamp, 1, TextureA.Get(), MegaByte / 4);
+	Cache->Add(PathB, TimeStamp, 2, TextureB.Get(), MegaByte / 4);
+	Cache->Add(PathC, TimeStamp, 3, TextureC.Get(), MegaByte / 4);
+	TestEqual(TEXT("Cached size"), Cache->SizeBytes, 3 * MegaByte / 4);
+	TestEqual(TEXT("Path A is cached"), Cache->FindByPath(PathA, TimeStamp), TextureA.Get());
+	TestNull(TEXT("A modified file isn't served from the cache"), Cache->FindByPath(PathA, TimeStamp + FTimespan::FromSeconds(1)));
+
+	// 2. Using B then A leaves C as the least recently used texture, it is evicted along with its path.
+	Cache->FindByPath(PathB, TimeStamp);
+	Cache->FindByPath(PathA, TimeStamp);
+	Cache->Add(PathD, TimeStamp, 4, TextureD.Get(), MegaByte / 2);
+	TestNull(TEXT("The least recently used texture is evicted"), Cache->FindByHash(3));
+	TestFalse(TEXT("The path of the evicted texture is forgotten"), Cache->Paths.Contains(PathC));
+	TestEqual(TEXT("Path A is still cached"), Cache->FindByPath(PathA, TimeStamp), TextureA.Get());
+	TestEqual(TEXT("Path B is still cached"), Cache->FindByPath(PathB, TimeStamp), TextureB.Get());
+	TestEqual(TEXT("Path D is cached"), Cache->FindByPath(PathD, TimeStamp), TextureD.Get());
+	TestTrue(TEXT("Cached size stays within the budget"), Cache->SizeBytes <= MegaByte);
+
+	// 3. Another path with the same content shares the cached texture.
+	Cache->AddPath(PathC, TimeStamp, 4);
+	TestEqual(TEXT("Paths with the same content share the texture"), Cache->FindByPath(PathC, TimeStamp), TextureD.Get());
+
+	// 4. A texture larger than the whole budget isn't cached and doesn't evict anything.
+	Cache->Add(PathC, TimeStamp, 5, TextureC.Get(), 2 * MegaByte);
+	TestNull(TEXT("A texture over the budget isn't cached"), Cache->FindByHash(5));
+	TestEqual(TEXT("Nothing is evicted for a texture over the budget"), Cache->Textures.Num(), 3);
+
+	// 5. Lowering the budget evicts on the next addition until the cache fits again.
+	CacheSizeVariable->Set(0, ECVF_SetByCode);
+	Cache->Add(PathC, TimeStamp, 6, TextureC.Get(), 0);
+	TestEqual(TEXT("Everything is evicted once the cache is disabled"), Cache->SizeBytes, (int64)0);
+	TestNull(TEXT("Path A was evicted"), Cache->FindByPath(PathA, TimeStamp));
+
+	CacheSizeVariable->Set(PreviousCacheSizeMB, ECVF_SetByCode);
+	return true;
+}
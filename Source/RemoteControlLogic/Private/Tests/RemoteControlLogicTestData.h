@@ -17,6 +17,9 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RemoteControlTest)
 	int32 TestInt = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RemoteControlTest)
+	float TestFloat = 0.f;
 	
 	UFUNCTION(BlueprintCallable, Category = RemoteControlTest)
 	void TestIntFunction()
@@ -10,14 +10,20 @@
 #include "Action/RCActionContainer.h"
 #include "Action/RCFunctionAction.h"
 #include "Action/RCPropertyAction.h"
+#include "Action/RCPropertyIdAction.h"
 #include "Behaviour/RCBehaviour.h"
 #include "Behaviour/Builtin/Bind/RCBehaviourBind.h"
 #include "Behaviour/Builtin/Bind/RCBehaviourBindNode.h"
 #include "Behaviour/Builtin/Conditional/RCBehaviourConditional.h"
 #include "Behaviour/Builtin/Conditional/RCBehaviourConditionalNode.h"
+#include "Behaviour/Builtin/RangeMap/RCBehaviourRangeMapNode.h"
+#include "Behaviour/Builtin/RangeMap/RCRangeMapBehaviour.h"
 #include "Behaviour/Builtin/RCBehaviourOnValueChangedNode.h"
 #include "Controller/RCController.h"
 #include "Misc/AutomationTest.h"
+#include "RemoteControlPropertyIdRegistry.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
 #include "UObject/StrongObjectPtr.h"
 
 #define PROP_NAME(Class, Name) GET_MEMBER_NAME_CHECKED(Class, Name)
@@ -79,7 +85,7 @@ bool FRemoteControlLogicTest::RunTest(const FString& Parameters)
  
 	// 4.2 Add Other behaviours
 	const URCBehaviour* IntControllerBehaviour = FloatController->AddBehaviour(URCBehaviourOnValueChangedNode::StaticClass());
-	const URCBehaviour* StrControllerBehaviour = StrController->AddBehaviour(URCBehaviourBindNode::StaticClass());
+	URCBehaviour* StrControllerBehaviour = StrController->AddBehaviour(URCBehaviourBindNode::StaticClass());
  
 	// 5 Add actions
 	// 5.1 Add Float Controller Actions
@@ -139,6 +145,99 @@ bool FRemoteControlLogicTest::RunTest(const FString& Parameters)
 	StrController->ExecuteBehaviours();
 	FMemory::Memcpy(&OutColorValue, RCProp1ValuePtr, RCProp1->GetProperty()->GetSize());
 	TestEqual(TEXT("The exposed property should be updated after behaviour"), OutColorValue, StringControllerColorValue);
+
+	// 6.6 Execute again with a new value, reusing the compiled targets of the action
+	constexpr FColor ThirdColorValue(11,12,13,14);
+	TestTrue(TEXT("Should Set Color"), StrControllerBehaviourAction->PropertySelfContainer->SetValueColor(ThirdColorValue));
+	StrController->ExecuteBehaviours();
+	FMemory::Memcpy(&OutColorValue, RCProp1ValuePtr, RCProp1->GetProperty()->GetSize());
+	TestEqual(TEXT("The exposed property should be updated after executing again"), OutColorValue, ThirdColorValue);
+
+	// 6.7 Disabled behaviours are removed from the compiled execution plan
+	StrControllerBehaviour->SetIsEnabled(false);
+	TestTrue(TEXT("Should Set Color"), StrControllerBehaviourAction->PropertySelfContainer->SetValueColor(StringControllerColorValue));
+	StrController->ExecuteBehaviours();
+	FMemory::Memcpy(&OutColorValue, RCProp1ValuePtr, RCProp1->GetProperty()->GetSize());
+	TestEqual(TEXT("The exposed property should not be updated by a disabled behaviour"), OutColorValue, ThirdColorValue);
+
+	StrControllerBehaviour->SetIsEnabled(true);
+	StrController->ExecuteBehaviours();
+	FMemory::Memcpy(&OutColorValue, RCProp1ValuePtr, RCProp1->GetProperty()->GetSize());
+	TestEqual(TEXT("The exposed property should be updated once the behaviour is enabled again"), OutColorValue, StringControllerColorValue);
+
+	// 6.8 Range map steps are compiled into a sorted table, added out of order
+	const TSharedRef<FRemoteControlProperty> RCFloatProp = Preset->ExposeProperty(TestObject.Get(), FRCFieldPathInfo{GET_TEST_PROP(TestFloat)->GetName()}).Pin().ToSharedRef();
+	URCRangeMapBehaviour* RangeMapBehaviour = Cast<URCRangeMapBehaviour>(FloatController1->AddBehaviour(URCBehaviourRangeMapNode::StaticClass()));
+	RangeMapBehaviour->PropertyContainer->GetVirtualProperty(FName(TEXT("InputMin")))->SetValueDouble(0.0);
+	RangeMapBehaviour->PropertyContainer->GetVirtualProperty(FName(TEXT("InputMax")))->SetValueDouble(1.0);
+
+	auto AddRangeMapStep = [this, RangeMapBehaviour, &RCFloatProp](double InStep, float InValue)
+	{
+		URCPropertyAction* StepAction = Cast<URCPropertyAction>(RangeMapBehaviour->AddAction(RCFloatProp));
+		TestTrue(TEXT("Should Set Float"), StepAction->PropertySelfContainer->SetValueFloat(InValue));
+		RangeMapBehaviour->OnActionAdded(StepAction, StepAction->PropertySelfContainer);
+		RangeMapBehaviour->RangeMapActionContainer[StepAction].SetInputValue(InStep);
+		return StepAction;
+	};
+	AddRangeMapStep(1.0, 100.f);
+	AddRangeMapStep(0.0, 0.f);
+	const URCPropertyAction* MiddleStepAction = AddRangeMapStep(0.5, 10.f);
+
+	TestTrue(TEXT("Should Set Float"), FloatController1->SetValueFloat(0.75f));
+	FloatController1->ExecuteBehaviours();
+	TestEqual(TEXT("The exposed property should be lerped between the surrounding steps"), TestObject->TestFloat, 55.f);
+
+	// 6.9 Range map evaluates a set of controller values in bulk
+	TArray<TOptional<FVector>> EvaluatedValues;
+	TestTrue(TEXT("Should evaluate the range map field"), RangeMapBehaviour->EvaluateField(RCFloatProp->GetId(), { 0.25, 0.75 }, EvaluatedValues));
+	TestTrue(TEXT("Should evaluate every controller value"), EvaluatedValues.Num() == 2 && EvaluatedValues[0].IsSet() && EvaluatedValues[1].IsSet());
+	TestEqual(TEXT("The first evaluated value should be lerped"), EvaluatedValues[0].Get(FVector::ZeroVector).X, 5.0);
+	TestEqual(TEXT("The second evaluated value should be lerped"), EvaluatedValues[1].Get(FVector::ZeroVector).X, 55.0);
+
+	// 6.10 Editing a step recompiles the table
+	RangeMapBehaviour->RangeMapActionContainer[MiddleStepAction].SetInputValue(0.25);
+	TestTrue(TEXT("Should evaluate the range map field"), RangeMapBehaviour->EvaluateField(RCFloatProp->GetId(), { 0.75 }, EvaluatedValues));
+	TestEqual(TEXT("The evaluated value should use the edited step"), EvaluatedValues[0].Get(FVector::ZeroVector).X, 70.0, UE_KINDA_SMALL_NUMBER);
+
+	// 6.11 Conditions are compiled into lookups, Else only executes when the conditions preceding it failed
+	URCBehaviourConditional* IntConditionalBehaviour = Cast<URCBehaviourConditional>(IntController->AddBehaviour(URCBehaviourConditionalNode::StaticClass()));
+	auto AddCondition = [this, IntConditionalBehaviour, &RCFloatProp](ERCBehaviourConditionType InConditionType, int32 InComparandValue, float InActionValue)
+	{
+		URCVirtualPropertySelfContainer* ConditionComparand = NewObject<URCVirtualPropertySelfContainer>(IntConditionalBehaviour);
+		ConditionComparand->AddProperty(FName(TEXT("Comparand")), EPropertyBagPropertyType::Int32);
+		ConditionComparand->SetValueInt32(InComparandValue);
+
+		URCPropertyAction* ConditionAction = Cast<URCPropertyAction>(IntConditionalBehaviour->AddConditionalAction(RCFloatProp, InConditionType, ConditionComparand));
+		TestTrue(TEXT("Should Set Float"), ConditionAction->PropertySelfContainer->SetValueFloat(InActionValue));
+		IntConditionalBehaviour->OnActionAdded(ConditionAction, InConditionType, ConditionComparand);
+		return ConditionAction;
+	};
+	AddCondition(ERCBehaviourConditionType::IsGreaterThanOrEqualTo, 10, 10.f);
+	URCPropertyAction* EqualAction = AddCondition(ERCBehaviourConditionType::IsEqual, 3, 3.f);
+	URCVirtualPropertySelfContainer* EqualComparand = IntConditionalBehaviour->Conditions[EqualAction].Comparand;
+	AddCondition(ERCBehaviourConditionType::Else, 0, -1.f);
+
+	TestTrue(TEXT("Should Set Int"), IntController->SetValueInt32(3));
+	IntController->ExecuteBehaviours();
+	TestEqual(TEXT("The equality condition should pass and skip Else"), TestObject->TestFloat, 3.f);
+
+	TestTrue(TEXT("Should Set Int"), IntController->SetValueInt32(5));
+	IntController->ExecuteBehaviours();
+	TestEqual(TEXT("Else should execute when no condition passes"), TestObject->TestFloat, -1.f);
+
+	TestTrue(TEXT("Should Set Int"), EqualComparand->SetValueInt32(5));
+	IntController->ExecuteBehaviours();
+	TestEqual(TEXT("The edited comparand should be used"), TestObject->TestFloat, 3.f);
+
+	IntConditionalBehaviour->SetConditionType(EqualAction, ERCBehaviourConditionType::IsLesserThan);
+	IntController->ExecuteBehaviours();
+	TestEqual(TEXT("The edited condition type should be used"), TestObject->TestFloat, -1.f);
+
+	// 6.12 Bind compatibility is looked up from the compiled conversion tables
+	TestTrue(TEXT("Int controllers should bind to float properties"), URCBehaviourBind::CanHaveActionForField(IntController, RCFloatProp, false));
+	TestFalse(TEXT("String controllers should only bind to float properties as numeric inputs"), URCBehaviourBind::CanHaveActionForField(StrController, RCFloatProp, false));
+	TestTrue(TEXT("String controllers should bind to float properties as numeric inputs"), URCBehaviourBind::CanHaveActionForField(StrController, RCFloatProp, true));
+	TestFalse(TEXT("Vector controllers should not bind to color properties"), URCBehaviourBind::CanHaveActionForField(VectorStructController, RCProp1, true));
 	
 	// 7. Remove Actions
 	int32 ActionNum = FloatControllerBehaviour->GetNumActions();
@@ -154,12 +253,12 @@ bool FRemoteControlLogicTest::RunTest(const FString& Parameters)
 	TestEqual(TEXT("After empty actions the count should be = 0"), StrControllerBehaviour->GetNumActions(), 0);
  
 	// 8. Remove Behaviour by ID and by Pointer
-	const int32 BehaviourNum = FloatController->Behaviours.Num();
+	const int32 BehaviourNum = FloatController->GetBehaviours().Num();
 	FloatController->RemoveBehaviour(FloatControllerBehaviour);
 	FloatController->RemoveBehaviour(IntControllerBehaviour->Id);
-	TestEqual(TEXT("After empty 2 behaviours the count should be =-2"), FloatController->Behaviours.Num(), BehaviourNum - 2);
+	TestEqual(TEXT("After empty 2 behaviours the count should be =-2"), FloatController->GetBehaviours().Num(), BehaviourNum - 2);
 	FloatController->EmptyBehaviours();
-	TestEqual(TEXT("After empty actions the count should be = 0"), FloatController->Behaviours.Num(), 0);
+	TestEqual(TEXT("After empty actions the count should be = 0"), FloatController->GetBehaviours().Num(), 0);
  
 	// 9. Remove Controllers
 	const int32 NumPropertiesBeforeRemove = Preset->GetNumControllers();
@@ -177,4 +276,99 @@ bool FRemoteControlLogicTest::RunTest(const FString& Parameters)
 	TestEqual(TEXT("After empty controllers could should be equal 0"), Preset->GetNumControllers(), 0);
  
 	return true;
-} 
\ No newline at end of file
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRemoteControlPropertyIdTest, "Plugins.RemoteControl.Logic.PropertyId", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FRemoteControlPropertyIdTest::RunTest(const FString& Parameters)
+{
+	const FName SpeedPropertyId = TEXT("Speed");
+
+	// 1. Expose a property of two objects with the same PropertyId
+	TStrongObjectPtr<URemoteControlPreset> Preset{ NewObject<URemoteControlPreset>() };
+	TStrongObjectPtr<URemoteControlLogicTestData> FirstTestObject{ NewObject<URemoteControlLogicTestData>() };
+	TStrongObjectPtr<URemoteControlLogicTestData> SecondTestObject{ NewObject<URemoteControlLogicTestData>() };
+	URemoteControlPropertyIdRegistry* PropertyIdRegistry = Preset->GetPropertyIdRegistry();
+
+	const TSharedRef<FRemoteControlProperty> FirstRCProp = Preset->ExposeProperty(FirstTestObject.Get(), FRCFieldPathInfo{GET_TEST_PROP(TestFloat)->GetName()}).Pin().ToSharedRef();
+	const TSharedRef<FRemoteControlProperty> SecondRCProp = Preset->ExposeProperty(SecondTestObject.Get(), FRCFieldPathInfo{GET_TEST_PROP(TestFloat)->GetName()}).Pin().ToSharedRef();
+
+	auto SetPropertyId = [&Preset](const TSharedRef<FRemoteControlProperty>& InRCProp, FName InPropertyId)
+	{
+		InRCProp->PropertyId = InPropertyId;
+		Preset->UpdateIdentifiedField(InRCProp);
+	};
+	SetPropertyId(FirstRCProp, SpeedPropertyId);
+	SetPropertyId(SecondRCProp, SpeedPropertyId);
+
+	// 2. Add a PropertyId action
+	URCController* FloatController = Cast<URCController>(Preset->AddController(URCController::StaticClass(), EPropertyBagPropertyType::Float, nullptr, TEXT("FloatController")));
+	URCBehaviour* Behaviour = FloatController->AddBehaviour(URCBehaviourOnValueChangedNode::StaticClass());
+	URCPropertyIdAction* PropertyIdAction = Cast<URCPropertyIdAction>(Behaviour->ActionContainer->AddAction(SpeedPropertyId));
+	if (!TestNotNull(TEXT("Should add a PropertyId action"), PropertyIdAction) || !TestEqual(TEXT("The action should have a container for the PropertyId"), PropertyIdAction->PropertySelfContainer.Num(), 1))
+	{
+		return false;
+	}
+
+	const FPropertyIdContainerKey ContainerKey = PropertyIdAction->PropertySelfContainer.CreateConstIterator()->Key;
+	URCVirtualPropertySelfContainer* Container = PropertyIdAction->PropertySelfContainer.CreateConstIterator()->Value;
+
+	auto ExecuteWithValue = [this, PropertyIdAction, Container](double InValue)
+	{
+		TestTrue(TEXT("Should Set Double"), Container->SetValueDouble(InValue));
+		PropertyIdAction->Execute();
+	};
+
+	// 3. Chain reaction after add
+	ExecuteWithValue(5.0);
+	TestEqual(TEXT("The chain reaction should reach the first field"), FirstTestObject->TestFloat, 5.f);
+	TestEqual(TEXT("The chain reaction should reach the second field"), SecondTestObject->TestFloat, 5.f);
+
+	// 4. Chain reaction after update
+	SetPropertyId(SecondRCProp, TEXT("Other"));
+	ExecuteWithValue(7.0);
+	TestEqual(TEXT("The chain reaction should reach the field keeping the PropertyId"), FirstTestObject->TestFloat, 7.f);
+	TestEqual(TEXT("The chain reaction should skip the field whose PropertyId changed"), SecondTestObject->TestFloat, 5.f);
+
+	SetPropertyId(SecondRCProp, SpeedPropertyId);
+	ExecuteWithValue(8.0);
+	TestEqual(TEXT("The chain reaction should reach the field given the PropertyId again"), SecondTestObject->TestFloat, 8.f);
+
+	// 5. Chain reaction after remap
+	const FGuid FirstIdBeforeRemap = FirstRCProp->GetId();
+	Preset->RenewEntityIds();
+	TestNotEqual(TEXT("Renewing the ids should remap the entities"), FirstRCProp->GetId(), FirstIdBeforeRemap);
+	TestTrue(TEXT("The registry should hold the remapped ids"), PropertyIdRegistry->GetEntityIdsForPropertyId(SpeedPropertyId).Includes({ FirstRCProp->GetId(), SecondRCProp->GetId() }));
+	ExecuteWithValue(9.0);
+	TestEqual(TEXT("The chain reaction should reach the first remapped field"), FirstTestObject->TestFloat, 9.f);
+	TestEqual(TEXT("The chain reaction should reach the second remapped field"), SecondTestObject->TestFloat, 9.f);
+
+	// 6. Chain reaction after remove
+	TArray<uint8> PropertyIdRegistryState;
+	{
+		FObjectWriter PropertyIdRegistryWriter(PropertyIdRegistry, PropertyIdRegistryState);
+	}
+
+	PropertyIdRegistry->RemoveIdentifiedField(FirstRCProp->GetId());
+	ExecuteWithValue(10.0);
+	TestEqual(TEXT("The chain reaction should skip the removed field"), FirstTestObject->TestFloat, 9.f);
+	TestEqual(TEXT("The chain reaction should reach the remaining field"), SecondTestObject->TestFloat, 10.f);
+
+	// 7. Chain reaction after undo, the serialized registry is restored then the index is rebuilt
+#if WITH_EDITOR
+	{
+		FObjectReader PropertyIdRegistryReader(PropertyIdRegistry, PropertyIdRegistryState);
+	}
+	PropertyIdRegistry->PostEditUndo();
+	ExecuteWithValue(11.0);
+	TestEqual(TEXT("The chain reaction should reach the restored field"), FirstTestObject->TestFloat, 11.f);
+	TestEqual(TEXT("The chain reaction should still reach the other field"), SecondTestObject->TestFloat, 11.f);
+#endif
+
+	// 8. Container types are resolved again when the property bag is rebuilt, even if the new property reuses the address of the old one
+	TestEqual(TEXT("The container types should match the property"), PropertyIdAction->GetContainerTypes(ContainerKey, Container).SuperType, NAME_DoubleProperty);
+	Container->Reset();
+	Container->AddProperty(FName(TEXT("Speed")), EPropertyBagPropertyType::Int32);
+	TestEqual(TEXT("The container types should match the rebuilt property"), PropertyIdAction->GetContainerTypes(ContainerKey, Container).SuperType, NAME_IntProperty);
+
+	return true;
+}
@@ -20,9 +20,17 @@ public:
 
 	//~ Begin URCAction interface
 	virtual void Execute() const override;
+	virtual void UpdateEntityIds(const TMap<FGuid, FGuid>& InEntityIdMap) override;
 	//~ End URCAction interface
 
+	/** Resolves the index of the array element targeted by the exposed property from its field name, so executions don't parse it. */
+	void ResolveArrayElementIndex(const FRemoteControlProperty& InRemoteControlProperty) const;
+
 	/** The Controller that drives us */
 	UPROPERTY()
 	TObjectPtr<URCController> Controller;
+
+private:
+	/** Index of the array element targeted by the exposed property, resolved on creation or on the first execution of loaded actions. */
+	mutable TOptional<int32> ArrayElementIndex;
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "RCAction.h"
+#include "IRemoteControlModule.h"
 #include "RCPropertyAction.generated.h"
 
 struct FRemoteControlProperty;
@@ -37,4 +38,30 @@ public:
 	TObjectPtr<URCVirtualPropertySelfContainer> PropertySelfContainer = nullptr;
 
 	TSharedPtr<FRemoteControlProperty> GetRemoteControlProperty() const;
+
+private:
+	/** Get the write targets for the bound objects of the exposed property, compiling them again if the property or its bindings changed. */
+	const TArray<FRCObjectReference>& GetCompiledTargets(const TSharedPtr<FRemoteControlProperty>& InRemoteControlProperty) const;
+
+	/** Write targets resolved for the bound objects of the exposed property. */
+	struct FCompiledTargets
+	{
+		/** Exposed property the targets were resolved for. */
+		TWeakPtr<FRemoteControlProperty> Property;
+
+		/** Hash of the property path the targets were resolved for. */
+		uint32 PathHash = 0;
+
+		/** Bound objects the targets were resolved for. */
+		TArray<TWeakObjectPtr<UObject>> BoundObjects;
+
+		/** One resolved reference per bound object. */
+		TArray<FRCObjectReference> References;
+
+		/** Whether the references can be reused, paths going through container elements point into memory that can be reallocated. */
+		bool bCanReuseReferences = false;
+	};
+
+	/** Targets of the last execution, reused while the property and its bindings don't change. */
+	mutable FCompiledTargets CompiledTargets;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Action/RCAction.h"
+#include "PropertyBag.h"
 #include "RemoteControlFieldPath.h"
 #include "RCPropertyIdAction.generated.h"
 
@@ -77,6 +78,8 @@ public:
 
 	void OnEntityUnexposed(URemoteControlPreset* InPreset, const FGuid& InGuid);
 
+	void OnEntitiesUnexposed(URemoteControlPreset* InPreset, const TArray<FGuid>& InGuids);
+
 public:
 	/** Holds the field identifier associated with this. */
 	UPROPERTY()
@@ -94,6 +97,32 @@ public:
 	UPROPERTY()
 	TMap<FGuid, TObjectPtr<URCVirtualPropertySelfContainer>> RealPropertySelfContainer;
 
+private:
+	/** Types of a property container, resolved through the PropertyId handler of its property. */
+	struct FContainerTypes
+	{
+		/** Property the types were resolved for. */
+		const FProperty* Property = nullptr;
+
+		/** Property bag owning the property. A rebuilt bag can reuse the address of a freed property, so the bag is checked as well. */
+		TWeakObjectPtr<const UPropertyBag> PropertyBag;
+
+		/** Whether a PropertyId handler supports the property. */
+		bool bHasHandler = false;
+
+		FName SuperType;
+
+		FName SubType;
+	};
+
+	/** Returns the types of a property container, resolving them again if its property or property bag changed. */
+	const FContainerTypes& GetContainerTypes(const FPropertyIdContainerKey& InKey, URCVirtualPropertySelfContainer* InContainer) const;
+
 private:
 	static TSet<FName> AllowedStructNameToCopy;
+
+	/** Types of each property container, so executions don't query the PropertyId handlers. */
+	mutable TMap<FPropertyIdContainerKey, FContainerTypes> CachedContainerTypes;
+
+	friend class FRemoteControlPropertyIdTest;
 };
@@ -7,8 +7,10 @@
 
 #include "RCBehaviourConditional.generated.h"
 
-class URCVirtualPropertySelfContainer;
 class URCAction;
+class URCController;
+class URCVirtualPropertyBase;
+class URCVirtualPropertySelfContainer;
 
 /**
  * Condition Typess
@@ -72,6 +74,12 @@ public:
 	virtual void NotifyActionValueChanged(URCAction* InChangedAction) override;
 	//~ End URCBehaviour interface
 
+#if WITH_EDITOR
+	//~ Begin UObject interface
+	virtual void PostEditUndo() override;
+	//~ End UObject interface
+#endif
+
 	/** ~ OnActionAdded ~
 	* Invoked after a new condition action has just been created.
 	* Used to link the newly created action with its condition data */
@@ -86,6 +94,12 @@ public:
 	/** User-friendly text representation of a condition enum. Used to display comparator info in the Actions table */
 	FText GetConditionTypeAsText(ERCBehaviourConditionType ConditionType) const;
 
+	/** Sets the condition type of an action, discarding the compiled conditions. */
+	void SetConditionType(URCAction* InAction, const ERCBehaviourConditionType InConditionType);
+
+	/** Discards the compiled conditions, they are rebuilt on the next execution. Comparands invalidate them when their value is set. */
+	void InvalidateConditions();
+
 protected:
 	//~ Begin URCBehaviour interface
 	/** Execute all the action if not provided a valid Action otherwise will only execute the given action */
@@ -101,4 +115,91 @@ public:
 	/** Virtual property used to build the Comparand - i.e. the property with which the Controller will be compared for a given condition*/
 	UPROPERTY()
 	TObjectPtr<URCVirtualPropertySelfContainer> Comparand;
+
+private:
+	/** Value of a controller or comparand as compared by the compiled conditions. Numbers are widened to double, names are stored as strings. */
+	struct FConditionValue
+	{
+		double Number = 0.0;
+		FString String;
+
+		bool operator==(const FConditionValue& Other) const
+		{
+			return Number == Other.Number && String == Other.String;
+		}
+
+		friend uint32 GetTypeHash(const FConditionValue& InValue)
+		{
+			return HashCombine(GetTypeHash(InValue.Number), GetTypeHash(InValue.String));
+		}
+	};
+
+	/** Ordered condition, sorted by comparand. */
+	struct FOrderedCondition
+	{
+		double Comparand = 0.0;
+		int32 ConditionIndex = INDEX_NONE;
+	};
+
+	/** Conditions compiled into lookup structures so executing doesn't compare the controller against every comparand. */
+	struct FCompiledConditions
+	{
+		/** Conditioned actions, in execution order. */
+		TArray<TWeakObjectPtr<URCAction>> Actions;
+
+		/** Condition type of each action. */
+		TArray<ERCBehaviourConditionType> ConditionTypes;
+
+		/** Comparand of each action. */
+		TArray<TWeakObjectPtr<URCVirtualPropertySelfContainer>> Comparands;
+
+		/** Equality block of each condition, INDEX_NONE if it isn't an equality condition. A block is a run of consecutive equality conditions. */
+		TArray<int32> EqualityBlocks;
+
+		/** Number of equality blocks. */
+		int32 NumEqualityBlocks = 0;
+
+		/** Equality conditions, by comparand. */
+		TMap<FConditionValue, TArray<int32>> EqualityConditions;
+
+		/** Ordered conditions, sorted by comparand. */
+		TArray<FOrderedCondition> GreaterThanConditions;
+		TArray<FOrderedCondition> GreaterThanOrEqualToConditions;
+		TArray<FOrderedCondition> LesserThanConditions;
+		TArray<FOrderedCondition> LesserThanOrEqualToConditions;
+
+		/** Conditions whose type can't be compiled, compared through the virtual property comparators. */
+		TArray<int32> UncompiledConditions;
+
+		/** Else conditions and the last condition preceding them that isn't an Else, INDEX_NONE if there is none. */
+		TArray<TPair<int32, int32>> ElseConditions;
+
+		/** Controller property the conditions were compiled for. */
+		const FProperty* ControllerProperty = nullptr;
+
+		/** Number of actions and conditions the conditions were compiled from, INDEX_NONE when they are out of date. */
+		int32 NumActions = INDEX_NONE;
+		int32 NumConditions = INDEX_NONE;
+	};
+
+	/** Compiled conditions of this behaviour. */
+	FCompiledConditions CompiledConditions;
+
+	/** Conditions passing and results per condition and equality block, reused across executions. */
+	TArray<int32> PassingConditions;
+	TBitArray<> ConditionPasses;
+	TBitArray<> EqualityBlockPasses;
+
+private:
+	/** Builds the compiled conditions from the current actions and conditions. */
+	void CompileConditions(const URCController* InController);
+
+	/** Fills OutPassingConditions with the indices of the compiled conditions that pass for the current controller value, in execution order. */
+	void EvaluateCompiledConditions(const URCController* InController, TArray<int32>& OutPassingConditions);
+
+	/** Reads the value of a virtual property as compared by the compiled conditions. Returns false if its type can't be compiled. */
+	static bool GetConditionValue(const URCVirtualPropertyBase* InVirtualProperty, FConditionValue& OutValue);
+
+	/** Reads the value of a virtual property as compared by the compiled ordered conditions. Returns false if its type can't be compiled. */
+	static bool GetOrderedConditionValue(const URCVirtualPropertyBase* InVirtualProperty, double& OutValue);
 };
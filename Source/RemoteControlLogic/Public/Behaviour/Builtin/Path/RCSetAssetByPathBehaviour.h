@@ -12,6 +12,7 @@
 class URCVirtualPropertyContainerBase;
 class URCUserDefinedStruct;
 class UTexture;
+class UTexture2D;
 
 namespace SetAssetByPathBehaviourHelpers
 {
@@ -91,6 +92,10 @@ struct FRCSetAssetPath
 	UPROPERTY(EditAnywhere, Category="Path")
 	TArray<FRCAssetPathElement> AssetPath;
 
+	/** Controller values whose external textures are loaded ahead of their use, so switching to them doesn't wait on a load. */
+	UPROPERTY(EditAnywhere, Category="Path")
+	TArray<FString> PrefetchInputs;
+
 	/** An Array of Strings holding the Path of an Asset, seperated in several String. Will concatenated back together later. */
 	UE_DEPRECATED(5.4, "This property is deprecated please use AssetPathArray instead")
 	UPROPERTY()
@@ -113,6 +118,9 @@ public:
 	//~ End URCBehaviour interface
 
 	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditUndo() override;
+#endif
 
 	/** Given an Input Path, sets the Target Exposed Property to the Asset. */
 	bool SetAssetByPath(const FString& AssetPath, const FString& DefaultString);
@@ -132,8 +140,17 @@ public:
 	/** Auxiliary Function to apply to update the Target Texture */
 	void UpdateTargetEntity();
 
-	/** Called whenever a change has occured in the Slate */
+	/** Called whenever a change has occured in the Slate, prefetches the external assets of the new path. */
 	void RefreshPathArray();
+
+	/** Loads the textures of the external paths built from PathStruct.PrefetchInputs ahead of their use. */
+	void PrefetchExternalAssets();
+
+	/** Returns whether the path given is an internal or external one. */
+	bool IsInternal() const { return bInternal; }
+
+	/** Sets whether the path given is an internal or external one, prefetching the external assets when switching to external. */
+	void SetInternal(bool bInInternal);
 	
 public:
 	/** Pointer to property container */
@@ -148,31 +165,38 @@ public:
 	UPROPERTY()
 	FRCSetAssetPath PathStruct;
 
+private:
 	/** Bool used to help tell if the path given is an internal or external one. */
 	UPROPERTY()
 	bool bInternal = true;
 
-private:
 	/** Targeted Property Id */
 	UPROPERTY()
 	FGuid TargetEntityId;
 
 	/** Internal Targeted Property, used for any of the setter operations */
 	TSharedPtr<const FRemoteControlEntity> TargetEntity;
+
+	/** Incremented for each external load, only the latest one is applied once loaded. */
+	uint32 ExternalLoadSerial = 0;
 	
 private:
 	/** Auxiliary Function which sets the given SetterObject Asset onto the Exposed Asset with the given PropertyString name. */
 	bool SetInternalAsset(UObject* SetterObject);
 
-	/** Given an External Path towards a external location, loads the asset associated and places it onto an object */
-	bool SetExternalAsset(FString InExternalPath);
+	/** Returns the exposed property matching the label of the Target Entity. */
+	TSharedPtr<FRemoteControlProperty> FindTargetProperty(URemoteControlPreset* InPreset) const;
 
-	/** Auxiliary Function to apply a Texture onto a given Property */
-	bool SetTextureAsset(TSharedPtr<FRemoteControlProperty> InRemoteControlPropertyPtr, UTexture* InObject);
+	/**
+	 * Given an External Path towards a external location, loads the asset associated asynchronously and places it onto an object once loaded.
+	 * The Default Path is loaded instead if the External Path can't be.
+	 * @return Whether the texture was set when it was already cached. Otherwise whether the load could be started, its outcome is only logged.
+	 */
+	bool SetExternalAsset(const FString& InExternalPath, const FString& InDefaultPath);
 
-	/** Auxiliary Function to apply a Texture onto a given Property */
-	bool SetTextureFromPath(TSharedPtr<FRemoteControlProperty> TexturePtr, FString& FileName);
+	/** Called once the texture of an external load is loaded, nullptr if it couldn't be. Returns whether a texture was set. */
+	bool OnExternalTextureLoaded(uint32 InLoadSerial, const FString& InExternalPath, const FString& InDefaultPath, UTexture2D* InTexture);
 
-	/** Http Request Process Handler */
-	void ReadFileHttpHandler(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TSharedPtr<FRemoteControlProperty> InRCPropertyToSet);
+	/** Auxiliary Function to apply a Texture onto a given Property */
+	bool SetTextureAsset(TSharedPtr<FRemoteControlProperty> InRemoteControlPropertyPtr, UTexture* InObject);
 };
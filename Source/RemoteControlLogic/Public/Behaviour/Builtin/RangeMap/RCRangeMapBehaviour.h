@@ -6,6 +6,7 @@
 #include "RCVirtualProperty.h"
 #include "RCRangeMapBehaviour.generated.h"
 
+class IRemoteControlPropertyHandle;
 class URCAction;
 class URCVirtualPropertyContainerBase;
 
@@ -31,7 +32,7 @@ struct REMOTECONTROLLOGIC_API FRCRangeMapInput
 	/** Returns the Step value from the virtual property, safely*/
 	bool GetInputValue(double& OutValue) const;
 
-	/** Set the Step value for the virtual property, return true if successful */
+	/** Set the Step value for the virtual property, return true if successful. The behaviour owning the step rebuilds its step table on its next execution. */
 	bool SetInputValue(double InValue) const;
 };
 
@@ -65,6 +66,11 @@ public:
 	virtual void NotifyActionValueChanged(URCAction* InChangedAction) override;
 	//~ End URCBehaviour interface
 
+	//~ Begin UObject interface
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+	//~ End UObject interface
+
 	/** Refresh function being called whenever either the Controller or the Properties of the Behaviour Details Panel change */
 	void Refresh();
 	
@@ -80,6 +86,13 @@ public:
 	/** Returns the Step value associated with a given Action*/
 	bool GetValueForAction(const URCAction* InAction, double& OutValue);
 
+	/**
+	 * Evaluates the values the steps of an exposed field lerp to for each of the given controller values, without applying them.
+	 * Values are laid out as FVectors: numbers in X, rotators as Pitch, Yaw and Roll. Controller values that don't fall between two steps yield an unset value.
+	 * @return false if the field has no steps that can be lerped or the input range is invalid.
+	 */
+	bool EvaluateField(const FGuid& InFieldId, TConstArrayView<double> InControllerValues, TArray<TOptional<FVector>>& OutValues);
+
 protected:
 	//~ Begin URCBehaviour interface
 	/** Execute all the action if not provided a valid Action otherwise will only execute the given action */
@@ -95,25 +108,89 @@ private:
 
 	/** Controller Value of Type Float, which is used for the purpose of readability. */
 	float ControllerFloatValue;
-	
+
+	/** Type of the values lerped by a step track. */
+	enum class ELerpValueType : uint8
+	{
+		Double,
+		Float,
+		Vector,
+		Rotator
+	};
+
+	/** Steps of an exposed field whose values can be lerped. */
+	struct FLerpTrack
+	{
+		/** Id of the exposed field written by this track. */
+		FGuid FieldId;
+
+		/** Type of the values of the steps. */
+		ELerpValueType ValueType = ELerpValueType::Double;
+
+		/** Step inputs, sorted in ascending order. */
+		TArray<double> Inputs;
+
+		/** Step values matching Inputs. Numbers are stored in X, rotators as Pitch, Yaw and Roll. */
+		TArray<FVector> Values;
+
+		/** Handle used to write the lerped value to the exposed field. */
+		TSharedPtr<IRemoteControlPropertyHandle> PropertyHandle;
+	};
+
+	/** Actions compiled into sorted steps, rebuilt when the actions or their steps change. */
+	struct FStepTable
+	{
+		/** Step inputs of the actions that can't be lerped, sorted in ascending order. */
+		TArray<double> NonLerpInputs;
+
+		/** Actions that can't be lerped, matching NonLerpInputs. */
+		TArray<TWeakObjectPtr<URCAction>> NonLerpActions;
+
+		/** One track per exposed field that has at least two steps that can be lerped. */
+		TArray<FLerpTrack> LerpTracks;
+
+		/** Number of actions and range map inputs the table was compiled from, INDEX_NONE when the table is out of date. */
+		int32 NumActions = INDEX_NONE;
+		int32 NumRangeMapInputs = INDEX_NONE;
+	};
+
+	/** Compiled steps of this behaviour. */
+	FStepTable StepTable;
+
 private:
+	friend struct FRCRangeMapInput;
+
 	/** Boolean Function to help differentiate Custom Actions */
 	bool IsSupportedActionLerpType(TObjectPtr<URCAction> InAction) const;
 
-	/** Return the nearest Action and whether or not the distance between is less than the threshold.  */
-	bool GetNearestActionByThreshold(TTuple<URCAction*, bool>& OutTuple);
+	/** Reads the input range from the property container. Returns false if it isn't available. */
+	bool UpdateInputRange();
 
-	/** Returns a Map of Numeric Actions, mapped by a double value, bound to a given FieldId */
-	void GetLerpActions(TMap<FGuid, TArray<URCAction*>>& OutNumericActionsByField, const TSet<TObjectPtr<URCAction>>& InActionsToExecute);
-	
-	/** Gives out all pairs per Unique Exposed Field, which are applicable for Lerp. */
-	bool GetRangeValuePairsForLerp(TMap<FGuid, TTuple<URCAction*, URCAction*>>& OutPairs, const TSet<TObjectPtr<URCAction>>& InActionsToExecute);
+	/** Returns whether the step table matches the current actions. Edits of the steps invalidate the table instead of being checked for. */
+	bool IsStepTableUpToDate() const;
+
+	/** Discards the compiled step table, it is rebuilt on the next execution. */
+	void InvalidateStepTable();
+
+#if WITH_EDITOR
+	/** Discards the step table when undo/redo restores this behaviour or one of its actions or steps. */
+	void OnObjectTransacted(UObject* InObject, const class FTransactionObjectEvent& InTransactionEvent);
+#endif
+
+	/** Builds the step table from the current actions, steps and input range. */
+	void CompileStepTable();
+
+	/** Returns the nearest Action that can't be lerped if the distance between it and the controller value is less than the threshold. */
+	URCAction* GetNearestActionByThreshold(double InControllerValue) const;
+
+	/** Finds the steps of a track surrounding a controller value. Returns false if the value doesn't fall between two steps. */
+	static bool FindLerpSegment(const FLerpTrack& InTrack, double InControllerValue, int32& OutMinStepIndex, double& OutAlpha);
 
-	/** Gives out all Actions which do not fall under as being able to Lerp. Used for Executing them based on Threshold and Distance */
-	TMap<double, URCAction*> GetNonLerpActions();
+	/** Lerps the values of a track between a step and the next one. */
+	static FVector LerpTrackValue(const FLerpTrack& InTrack, int32 InMinStepIndex, double InAlpha);
 
-	/** Auxiliary Function used to calculate and apply the Lerp on Structs, like FVectors or FRotators. */
-	void ApplyLerpOnStruct(const FRCRangeMapInput* MinRangeInput, const FRCRangeMapInput* MaxRangeInput, const double& InputAlpha, const FGuid& FieldId);
+	/** Writes the value a track lerps to for the controller value to its exposed field. */
+	static void ApplyLerpTrack(const FLerpTrack& InTrack, double InControllerValue);
 
 	/** Returns whether or not an Action created with a given RemoteControlField can be considered unique. */
 	bool IsActionUnique(const TSharedRef<const FRemoteControlField> InRemoteControlField, const double& InValue, const TSet<TObjectPtr<URCAction>>& InActions);
@@ -42,6 +42,18 @@ public:
 	/** Execute the behaviour */
 	void Execute();
 
+	/** Whether this behaviour is executed when its controller changes. */
+	bool IsEnabled() const { return bIsEnabled; }
+
+	/** Enable or disable this behaviour, disabled behaviours aren't executed by their controller. */
+	void SetIsEnabled(bool bInIsEnabled);
+
+	/** Whether this behaviour is executed during the pre-change notifications of its controller. */
+	bool ShouldExecuteDuringPreChange() const { return bExecuteBehavioursDuringPreChange; }
+
+	/** Set whether this behaviour is executed during the pre-change notifications of its controller. */
+	void SetExecuteDuringPreChange(bool bInExecuteDuringPreChange);
+
 	/** Add a Logic action as an identity action. */
 	virtual URCAction* AddAction();
 
@@ -78,6 +90,10 @@ public:
 	void SetOverrideBehaviourBlueprintClass(UBlueprint* InBlueprint);
 
 #if WITH_EDITOR
+	//~ Begin UObject interface
+	virtual void PostEditUndo() override;
+	//~ End UObject interface
+
 	/** Get Display Name for this Behaviour */
 	const FText& GetDisplayName();
 
@@ -129,6 +145,13 @@ public:
 	UPROPERTY()
 	TWeakObjectPtr<URCController> ControllerWeakPtr;
 
+protected:
+	/** Indicates whether we want a behavour to trigger during live scrubbing of values.
+	* For example, for a light intensity value controlled via Bind behavour we want the bound properties to update live even while the float widget is being scrubbed by the user.
+	* Only set directly on construction, use SetExecuteDuringPreChange afterwards so the controller notices the change. */
+	UPROPERTY()
+	bool bExecuteBehavioursDuringPreChange = false;
+
 private:
 	/** Cached behaviour node class */
 	TSubclassOf<UObject> CachedBehaviourNodeClass;
@@ -137,14 +160,8 @@ private:
 	UPROPERTY(Instanced)
 	TObjectPtr<URCBehaviourNode> CachedBehaviourNode;
 
-public:
 	/** Whether this Behaviour is currently enabled. 
 	* If disabled, it will be not evaluated when the associated Controller changes */
 	UPROPERTY()
 	bool bIsEnabled = true;
-
-	/** Indicates whether we want a behavour to trigger during live scrubbing of values.
-	* For example, for a light intensity value controlled via Bind behavour we want the bound properties to update live even while the float widget is being scrubbed by the user. */
-	UPROPERTY()
-	bool bExecuteBehavioursDuringPreChange = false;
 };
@@ -50,6 +50,9 @@ public:
 	/** Execute all behaviours for this controller. */
 	virtual void ExecuteBehaviours(const bool bIsPreChange = false);
 
+	/** Mark the compiled execution plan as out of date, it is compiled again on the next execution. */
+	void InvalidateExecutionPlan();
+
 	/** Pre-change notification for Controllers. Triggered while the user is scrubbing a float or vector slider in the UI*/
 	virtual void OnPreChangePropertyValue() override;
 
@@ -62,8 +65,30 @@ public:
 	/** Delegate that notifies changes to the list of behaviours*/
 	FOnBehaviourListModified OnBehaviourListModified;
 
-public:
+	/** Set of the behaviours, modified through AddBehaviour, RemoveBehaviour, EmptyBehaviours and DuplicateBehaviour. */
+	const TSet<TObjectPtr<URCBehaviour>>& GetBehaviours() const { return Behaviours; }
+
+private:
+	/** Compile the execution plan from the set of behaviours. */
+	void CompileExecutionPlan();
+
 	/** Set of the behaviours */
 	UPROPERTY()
 	TSet<TObjectPtr<URCBehaviour>> Behaviours;
+
+	/** Behaviours to execute when the controller changes, filtered from the set of behaviours so executing doesn't need to check them. */
+	struct FExecutionPlan
+	{
+		/** Enabled behaviours. */
+		TArray<TWeakObjectPtr<URCBehaviour>> Behaviours;
+
+		/** Enabled behaviours that execute during pre-change notifications. */
+		TArray<TWeakObjectPtr<URCBehaviour>> PreChangeBehaviours;
+
+		/** Whether the plan was invalidated since it was compiled. */
+		bool bIsInvalidated = true;
+	};
+
+	/** Compiled execution plan, rebuilt when the behaviours change. */
+	FExecutionPlan ExecutionPlan;
 };
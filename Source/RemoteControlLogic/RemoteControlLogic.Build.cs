@@ -20,6 +20,8 @@ public class RemoteControlLogic : ModuleRules
 				"Cbor",
 				"Engine",
 				"HTTP",
+				"ImageCore",
+				"ImageWrapper",
 				"RemoteControl",
 				"Serialization",
 				"StructUtils"
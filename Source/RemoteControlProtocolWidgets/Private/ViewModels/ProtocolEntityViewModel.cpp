@@ -180,6 +180,7 @@ FProtocolEntityViewModel::~FProtocolEntityViewModel()
 void FProtocolEntityViewModel::Initialize()
 {
 	Preset->OnEntityUnexposed().AddSP(this, &FProtocolEntityViewModel::OnEntityUnexposed);
+	Preset->OnEntitiesUnexposed().AddSP(this, &FProtocolEntityViewModel::OnEntitiesUnexposed);
 
 	Bindings.Empty(Bindings.Num());
 	if (const TSharedPtr<FRemoteControlProperty> RCProperty = Preset->GetExposedEntity<FRemoteControlProperty>(PropertyId).Pin())
@@ -217,6 +218,14 @@ void FProtocolEntityViewModel::OnEntityUnexposed(URemoteControlPreset* InPreset,
 	}
 }
 
+void FProtocolEntityViewModel::OnEntitiesUnexposed(URemoteControlPreset* InPreset, const TArray<FGuid>& InEntityIds)
+{
+	if (InEntityIds.Contains(GetId()))
+	{
+		OnEntityUnexposed(InPreset, GetId());
+	}
+}
+
 // @note: This should closely match RemoteControlProtocolBinding.h
 // InProtocolName can be NAME_All which only checks output type support
 bool FProtocolEntityViewModel::CanAddBinding(const FName& InProtocolName, FText& OutMessage)
@@ -93,6 +93,9 @@ protected:
 	/** Respond when entity is unexposed */
 	void OnEntityUnexposed(URemoteControlPreset* InPreset, const FGuid& InEntityId);
 
+	/** Respond when entities are unexposed in bulk */
+	void OnEntitiesUnexposed(URemoteControlPreset* InPreset, const TArray<FGuid>& InEntityIds);
+
 	//~ Begin FEditorUndoClient Interface
 	virtual void PostUndo(bool bSuccess) override;
 	virtual void PostRedo(bool bSuccess) override { PostUndo(bSuccess); }
@@ -231,6 +231,12 @@ void FRCActionConditionalModel::OnExitingEditingMode()
 
 				const FText ConditionComparandText = CreateConditionComparandText(Behaviour, Condition);
 
+				// The comparand value was edited in place by its widget.
+				if (Condition->Comparand)
+				{
+					Condition->Comparand->NotifyValueChanged();
+				}
+
 				UpdateSelectedConditionalActionModel(Condition, ConditionComparandText);
 			}
 		}
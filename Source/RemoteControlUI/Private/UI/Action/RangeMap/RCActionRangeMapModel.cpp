@@ -196,6 +196,9 @@ void FRCActionRangeMapModel::OnExitingEditingMode() const
 				double Value;
 				if(RangeInput->GetInputValue(Value))
 				{
+					// The widget edits the step property directly, set it through the input so the behaviour picks up the new step.
+					RangeInput->SetInputValue(Value);
+
 					const FText StepAsText = FText::FromString(FString::SanitizeFloat(Value));
 
 					UpdateSelectedRangeMapActionModel(Value, StepAsText);
@@ -54,6 +54,10 @@ FRCSetAssetByPathBehaviourModel::FRCSetAssetByPathBehaviourModel(URCSetAssetByPa
 			{
 				// Just refresh the preview without reconstructing the widget if we just set values
 				RefreshPreview();
+				if (URCSetAssetByPathBehaviour* Behaviour = SetAssetByPathBehaviourWeakPtr.Get())
+				{
+					Behaviour->PrefetchExternalAssets();
+				}
 			}
 			else
 			{
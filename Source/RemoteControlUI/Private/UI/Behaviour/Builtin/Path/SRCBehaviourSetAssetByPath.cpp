@@ -71,12 +71,12 @@ void SRCBehaviourSetAssetByPath::Construct(const FArguments& InArgs, TSharedRef<
 		.Text(FText::FromString(FString("Internal")))
 		.ButtonColorAndOpacity_Lambda([PathBehaviour]()
 		{
-			FSlateColor Color = PathBehaviour->bInternal ? FAppStyle::Get().GetSlateColor("Colors.Highlight") : FAppStyle::Get().GetSlateColor("Colors.AccentWhite");
+			FSlateColor Color = PathBehaviour->IsInternal() ? FAppStyle::Get().GetSlateColor("Colors.Highlight") : FAppStyle::Get().GetSlateColor("Colors.AccentWhite");
 			return Color;
 		})
 		.OnPressed_Lambda([PathBehaviour]()
 		{
-			PathBehaviour->bInternal = true;
+			PathBehaviour->SetInternal(true);
 		})
 	];
 	
@@ -91,12 +91,12 @@ void SRCBehaviourSetAssetByPath::Construct(const FArguments& InArgs, TSharedRef<
 		.Text(FText::FromString(FString("External")))
 		.ButtonColorAndOpacity_Lambda([PathBehaviour]()
 		{
-			FSlateColor Color = PathBehaviour->bInternal ? FAppStyle::Get().GetSlateColor("Colors.AccentWhite") : FAppStyle::Get().GetSlateColor("Colors.Highlight");
+			FSlateColor Color = PathBehaviour->IsInternal() ? FAppStyle::Get().GetSlateColor("Colors.AccentWhite") : FAppStyle::Get().GetSlateColor("Colors.Highlight");
 			return Color;
 		})
 		.OnPressed_Lambda([PathBehaviour]()
 		{
-			PathBehaviour->bInternal = false;
+			PathBehaviour->SetInternal(false);
 		})
 	];
 	
@@ -32,7 +32,7 @@ FRCBehaviourModel::FRCBehaviourModel(URCBehaviour* InBehaviour
 			.Text(BehaviourDisplayName)
 			.TextStyle(&RCPanelStyle->HeaderTextStyle);
 
-		RefreshIsBehaviourEnabled(BehaviourWeakPtr->bIsEnabled);
+		RefreshIsBehaviourEnabled(BehaviourWeakPtr->IsEnabled());
 	}
 }
 
@@ -120,7 +120,7 @@ bool FRCBehaviourModel::IsBehaviourEnabled() const
 {
 	if (URCBehaviour* Behaviour = BehaviourWeakPtr.Get())
 	{
-		return Behaviour->bIsEnabled;
+		return Behaviour->IsEnabled();
 	}
 
 	return false;
@@ -130,7 +130,7 @@ void FRCBehaviourModel::SetIsBehaviourEnabled(const bool bIsEnabled)
 {
 	if (URCBehaviour* Behaviour = BehaviourWeakPtr.Get())
 	{
-		Behaviour->bIsEnabled = bIsEnabled;
+		Behaviour->SetIsEnabled(bIsEnabled);
 
 		RefreshIsBehaviourEnabled(bIsEnabled);
 	}
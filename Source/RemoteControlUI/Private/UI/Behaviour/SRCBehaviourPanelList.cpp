@@ -198,7 +198,7 @@ void SRCBehaviourPanelList::Reset()
 	{
 		if (URCController* Controller = Cast<URCController>(ControllerItem->GetVirtualProperty()))
 		{
-			for (URCBehaviour* Behaviour : Controller->Behaviours)
+			for (URCBehaviour* Behaviour : Controller->GetBehaviours())
 			{
 				AddBehaviourToList(Behaviour);
 			}
@@ -985,7 +985,7 @@ void SRCControllerPanelList::CreateBindBehaviourAndAssignTo(URCController* Contr
 		}
 	}
 
-	for (const URCBehaviour* Behaviour : Controller->Behaviours)
+	for (const URCBehaviour* Behaviour : Controller->GetBehaviours())
 	{
 		if (Behaviour && Behaviour->IsA(URCBehaviourBind::StaticClass()))
 		{
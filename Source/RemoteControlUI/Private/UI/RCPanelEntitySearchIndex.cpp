@@ -0,0 +1,164 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RCPanelEntitySearchIndex.h"
+
+#include "Algo/BinarySearch.h"
+#include "GameFramework/Actor.h"
+#include "RemoteControlEntity.h"
+#include "RemoteControlField.h"
+
+void FRCPanelEntitySearchIndex::Add(const FRemoteControlEntity& InEntity)
+{
+	FEntry& Entry = Entries.FindOrAdd(InEntity.GetId());
+	RemoveBoundActors(InEntity.GetId(), Entry);
+	Entry.Label = InEntity.GetLabel().ToString().ToLower();
+	Entry.Tokens.Reset();
+	Entry.Actors.Reset();
+
+	for (const UObject* BoundObject : InEntity.GetBoundObjects())
+	{
+		if (BoundObject)
+		{
+			Entry.Tokens.AddUnique(BoundObject->GetName().ToLower());
+
+			if (const AActor* Actor = Cast<AActor>(BoundObject))
+			{
+				Entry.Tokens.AddUnique(Actor->GetActorLabel().ToLower());
+				Entry.Actors.AddUnique(FObjectKey(Actor));
+			}
+		}
+	}
+
+	if (InEntity.GetStruct()->IsChildOf(FRemoteControlField::StaticStruct()))
+	{
+		const FRemoteControlField& Field = static_cast<const FRemoteControlField&>(InEntity);
+		for (int32 SegmentIndex = 0; SegmentIndex < Field.FieldPathInfo.GetSegmentCount(); ++SegmentIndex)
+		{
+			Entry.Tokens.AddUnique(Field.FieldPathInfo.GetFieldSegment(SegmentIndex).Name.ToString().ToLower());
+		}
+	}
+
+	for (const FObjectKey& Actor : Entry.Actors)
+	{
+		EntitiesByActor.Add(Actor, InEntity.GetId());
+	}
+
+	bSortedTokensDirty = true;
+	InvalidateSearch();
+}
+
+void FRCPanelEntitySearchIndex::Remove(const FGuid& InEntityId)
+{
+	FEntry Entry;
+	if (Entries.RemoveAndCopyValue(InEntityId, Entry))
+	{
+		RemoveBoundActors(InEntityId, Entry);
+		bSortedTokensDirty = true;
+		InvalidateSearch();
+	}
+}
+
+void FRCPanelEntitySearchIndex::Reset()
+{
+	Entries.Reset();
+	EntitiesByActor.Reset();
+	SortedTokens.Reset();
+	bSortedTokensDirty = false;
+	InvalidateSearch();
+}
+
+const TSet<FGuid>& FRCPanelEntitySearchIndex::Search(const FString& InSearchText)
+{
+	const FString LowerSearchText = InSearchText.ToLower();
+
+	// Every entity matching the new text matched the text it extends, so only these need to be tested again.
+	if (bLastSearchValid && !LastSearchText.IsEmpty() && LowerSearchText.StartsWith(LastSearchText, ESearchCase::CaseSensitive))
+	{
+		for (TSet<FGuid>::TIterator It = LastMatches.CreateIterator(); It; ++It)
+		{
+			const FEntry* Entry = Entries.Find(*It);
+			if (!Entry || !Matches(*Entry, LowerSearchText))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+	else
+	{
+		LastMatches.Reset();
+
+		for (const TPair<FGuid, FEntry>& Pair : Entries)
+		{
+			if (Pair.Value.Label.Contains(LowerSearchText, ESearchCase::CaseSensitive))
+			{
+				LastMatches.Add(Pair.Key);
+			}
+		}
+
+		UpdateSortedTokens();
+
+		const int32 FirstIndex = Algo::LowerBoundBy(SortedTokens, LowerSearchText
+			, [](const TPair<FString, FGuid>& Token) -> const FString& { return Token.Key; }
+			, [](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+		for (int32 Index = FirstIndex; Index < SortedTokens.Num() && SortedTokens[Index].Key.StartsWith(LowerSearchText, ESearchCase::CaseSensitive); ++Index)
+		{
+			LastMatches.Add(SortedTokens[Index].Value);
+		}
+	}
+
+	LastSearchText = LowerSearchText;
+	bLastSearchValid = true;
+
+	return LastMatches;
+}
+
+void FRCPanelEntitySearchIndex::GetEntitiesBoundToActor(const AActor* InActor, TArray<FGuid>& OutEntityIds) const
+{
+	EntitiesByActor.MultiFind(FObjectKey(InActor), OutEntityIds);
+}
+
+bool FRCPanelEntitySearchIndex::Matches(const FEntry& InEntry, const FString& InLowerSearchText)
+{
+	if (InEntry.Label.Contains(InLowerSearchText, ESearchCase::CaseSensitive))
+	{
+		return true;
+	}
+
+	return InEntry.Tokens.ContainsByPredicate([&InLowerSearchText](const FString& Token) { return Token.StartsWith(InLowerSearchText, ESearchCase::CaseSensitive); });
+}
+
+void FRCPanelEntitySearchIndex::RemoveBoundActors(const FGuid& InEntityId, const FEntry& InEntry)
+{
+	for (const FObjectKey& Actor : InEntry.Actors)
+	{
+		EntitiesByActor.RemoveSingle(Actor, InEntityId);
+	}
+}
+
+void FRCPanelEntitySearchIndex::UpdateSortedTokens()
+{
+	if (!bSortedTokensDirty)
+	{
+		return;
+	}
+
+	SortedTokens.Reset();
+	for (const TPair<FGuid, FEntry>& Pair : Entries)
+	{
+		for (const FString& Token : Pair.Value.Tokens)
+		{
+			SortedTokens.Emplace(Token, Pair.Key);
+		}
+	}
+
+	// Compare case sensitively since tokens are already lower case, which also keeps the order consistent with StartsWith.
+	SortedTokens.Sort([](const TPair<FString, FGuid>& A, const TPair<FString, FGuid>& B) { return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0; });
+	bSortedTokensDirty = false;
+}
+
+void FRCPanelEntitySearchIndex::InvalidateSearch()
+{
+	LastSearchText.Reset();
+	LastMatches.Reset();
+	bLastSearchValid = false;
+}
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+struct FRemoteControlEntity;
+
+/**
+ * Search index of the entities exposed on a preset, used to filter the exposed entities list while the user types.
+ * Entities are indexed by their label, the names of the objects they are bound to and the segments of their field path.
+ * Labels match any substring like the list always did, owner names and field path segments match on their prefix.
+ */
+class FRCPanelEntitySearchIndex
+{
+public:
+	/** Index an entity, replacing what was indexed for it before. */
+	void Add(const FRemoteControlEntity& InEntity);
+
+	/** Remove an entity from the index. */
+	void Remove(const FGuid& InEntityId);
+
+	/** Remove every entity from the index. */
+	void Reset();
+
+	/** Get the entities bound to an actor, whose label is indexed and must be indexed again when the actor is renamed. */
+	void GetEntitiesBoundToActor(const AActor* InActor, TArray<FGuid>& OutEntityIds) const;
+
+	/**
+	 * Find the entities matching a search text, case insensitively.
+	 * When the search text extends the previous one, only the previous matches are tested again.
+	 */
+	const TSet<FGuid>& Search(const FString& InSearchText);
+
+private:
+	struct FEntry
+	{
+		/** Lower case label. */
+		FString Label;
+		/** Lower case names of the bound objects and segments of the field path. */
+		TArray<FString> Tokens;
+		/** Bound actors whose label is part of the tokens. */
+		TArray<FObjectKey> Actors;
+	};
+
+	/** Remove an entry from the entities of its bound actors. */
+	void RemoveBoundActors(const FGuid& InEntityId, const FEntry& InEntry);
+
+	/** Whether an entry matches a lower case search text. */
+	static bool Matches(const FEntry& InEntry, const FString& InLowerSearchText);
+
+	/** Sort the tokens of every entry, so the tokens starting with a search text form a contiguous range. */
+	void UpdateSortedTokens();
+
+	/** Forget the previous search, called whenever the index changes. */
+	void InvalidateSearch();
+
+private:
+	TMap<FGuid, FEntry> Entries;
+
+	/** Entities by the actors they are bound to. */
+	TMultiMap<FObjectKey, FGuid> EntitiesByActor;
+
+	/** Tokens of every entry and the entity they belong to, sorted by token. */
+	TArray<TPair<FString, FGuid>> SortedTokens;
+	bool bSortedTokensDirty = false;
+
+	/** Lower case text of the previous search and the entities it matched. */
+	FString LastSearchText;
+	TSet<FGuid> LastMatches;
+	bool bLastSearchValid = false;
+};
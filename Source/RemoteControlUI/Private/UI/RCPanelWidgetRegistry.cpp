@@ -4,14 +4,25 @@
 
 #include "Engine/BlueprintGeneratedClass.h"
 #include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
 #include "IDetailTreeNode.h"
 #include "IPropertyRowGenerator.h"
 #include "Modules/ModuleManager.h"
 #include "PropertyHandle.h"
 #include "UObject/StructOnScope.h"
 
+static TAutoConsoleVariable<int32> CVarRemoteControlUIMaxRowGenerators(
+	TEXT("RemoteControl.UI.MaxRowGenerators"),
+	128,
+	TEXT("Maximum number of property row generators kept alive by a remote control panel. ")
+	TEXT("Generators whose rows are out of view are evicted, least recently used first, once this number is exceeded. 0 disables the limit.")
+);
+
 namespace WidgetRegistryUtils
 {
+	/** Number of evicted generators kept around to be reused for objects of the same class. */
+	constexpr int32 MaxIdleGenerators = 16;
+
 	bool FindPropertyHandleRecursive(const TSharedPtr<IPropertyHandle>& PropertyHandle, const FString& PropertyNameOrPath, ERCFindNodeMethod FindMethod)
 	{
 		if (PropertyHandle && PropertyHandle->IsValidHandle())
@@ -105,19 +116,22 @@ FRCPanelWidgetRegistry::~FRCPanelWidgetRegistry()
 	}
 
 	ObjectToRowGenerator.Reset();
+	IdleGenerators.Reset();
 }
 
 TSharedPtr<IDetailTreeNode> FRCPanelWidgetRegistry::GetObjectTreeNode(UObject* InObject, const FString& InField, ERCFindNodeMethod InFindMethod)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FRCPanelWidgetRegistry::GetObjectTreeNode);
 
-	const TPair<TWeakObjectPtr<UObject>, FString> CacheKey{InObject, InField};
-	if (TWeakPtr<IDetailTreeNode>* Node = TreeNodeCache.Find(CacheKey))
+	TMap<FString, TWeakPtr<IDetailTreeNode>>* ObjectTreeNodes = TreeNodeCache.Find(InObject);
+	if (TWeakPtr<IDetailTreeNode>* Node = ObjectTreeNodes ? ObjectTreeNodes->Find(InField) : nullptr)
 	{
 		if (Node->IsValid() && Node->Pin()->CreatePropertyHandle() && Node->Pin()->CreatePropertyHandle()->GetNumOuterObjects() != 0)
 		{
 			if (TSharedPtr<IPropertyRowGenerator>* FoundGenerator = ObjectToRowGenerator.Find({ InObject }))
 			{
+				TouchGenerator(InObject);
+
 				// Since we are returning cached node from the second time refresh onwards
 				// It is important that we refresh the corresponding row to keep the consistency.
 				FoundGenerator->Get()->OnRowsRefreshed().Broadcast();
@@ -127,7 +141,7 @@ TSharedPtr<IDetailTreeNode> FRCPanelWidgetRegistry::GetObjectTreeNode(UObject* I
 		}
 		else
 		{
-			TreeNodeCache.Remove(CacheKey);
+			ObjectTreeNodes->Remove(InField);
 		}
 	}
 
@@ -137,31 +151,39 @@ TSharedPtr<IDetailTreeNode> FRCPanelWidgetRegistry::GetObjectTreeNode(UObject* I
 		if (Handler.IsExceptionFunc(InObject, InField, InFindMethod))
 		{
 			TSharedPtr<IDetailTreeNode> Node = Handler.FinderFunction(InObject, InField, InFindMethod);
-			TreeNodeCache.Add(CacheKey, Node);
+			TreeNodeCache.FindOrAdd(InObject).Add(InField, Node);
 			return Node;
 		}
 	}
 		
-	TSharedPtr<IPropertyRowGenerator> Generator;
-	TWeakObjectPtr<UObject> WeakObject = InObject;
-	
-	if (TSharedPtr<IPropertyRowGenerator>* FoundGenerator = ObjectToRowGenerator.Find(WeakObject))
-	{
-		Generator = *FoundGenerator;
-	}
-	else
-	{
-		Generator = CreateGenerator(InObject);
-		ObjectToRowGenerator.Add(WeakObject, Generator);
-	}
+	TSharedPtr<IPropertyRowGenerator> Generator = FindOrCreateGenerator(InObject);
 	
 	TSharedPtr<IDetailTreeNode> Node = WidgetRegistryUtils::FindNode(Generator->GetRootTreeNodes(), InField, InFindMethod);
 	// Cache the node to avoid having to do the recursive find again.
-	TreeNodeCache.Add(CacheKey, Node);
+	TreeNodeCache.FindOrAdd(InObject).Add(InField, Node);
 	
 	return Node;
 }
 
+TSharedPtr<IPropertyRowGenerator> FRCPanelWidgetRegistry::GetObjectGenerator(UObject* InObject) const
+{
+	if (const TSharedPtr<IPropertyRowGenerator>* Generator = ObjectToRowGenerator.Find({ InObject }))
+	{
+		return *Generator;
+	}
+
+	// nDisplay nodes are generated from their owner actor, see FindNDisplayTreeNode.
+	if (InObject)
+	{
+		if (const TSharedPtr<IPropertyRowGenerator>* GeneratorFromParent = ObjectToRowGenerator.Find({ InObject->GetTypedOuter<AActor>() }))
+		{
+			return *GeneratorFromParent;
+		}
+	}
+
+	return nullptr;
+}
+
 TSharedPtr<IDetailTreeNode> FRCPanelWidgetRegistry::GetStructTreeNode(const TSharedPtr<FStructOnScope>& InStruct, const FString& InField, ERCFindNodeMethod InFindMethod)
 {
 	TSharedPtr<IPropertyRowGenerator> Generator;
@@ -222,6 +244,10 @@ void FRCPanelWidgetRegistry::Clear()
 	}
 
 	ObjectToRowGenerator.Empty();
+	GeneratorUsage.Empty();
+	GeneratorUsageNodes.Empty();
+	IdleGenerators.Empty();
+	NumIdleGenerators = 0;
 	StructToRowGenerator.Empty();
 	TreeNodeCache.Empty();
 }
@@ -264,18 +290,7 @@ TSharedPtr<IDetailTreeNode> FRCPanelWidgetRegistry::FindNDisplayTreeNode(UObject
 	//Run the generation using the owner actor instead of the subobject
 	InObject = Actor;
 
-	TSharedPtr<IPropertyRowGenerator> Generator;
-	TWeakObjectPtr<UObject> WeakObject = InObject;
-
-	if (TSharedPtr<IPropertyRowGenerator>* FoundGenerator = ObjectToRowGenerator.Find(WeakObject))
-	{
-		Generator = *FoundGenerator;
-	}
-	else
-	{
-		Generator = CreateGenerator(InObject);
-		ObjectToRowGenerator.Add(WeakObject, Generator);
-	}
+	TSharedPtr<IPropertyRowGenerator> Generator = FindOrCreateGenerator(InObject);
 
 	return WidgetRegistryUtils::FindNode(Generator->GetRootTreeNodes(), InField, InFindMethod);
 }
@@ -299,13 +314,30 @@ TSharedPtr<IPropertyRowGenerator> FRCPanelWidgetRegistry::CreateGenerator(UObjec
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FRCPanelWidgetRegistry::CreateGenerator);
 
-	// Since we must keep many PRG objects alive in order to access the handle data, validating the nodes each tick is very taxing.
-	// We can override the validation with a lambda since the validation function in PRG is not necessary for our implementation
-	auto ValidationLambda = ([](const FRootPropertyNodeList& PropertyNodeList) { return true; });
-	FPropertyRowGeneratorArgs Args;
-	TSharedPtr<IPropertyRowGenerator> Generator = FModuleManager::GetModuleChecked<FPropertyEditorModule>("PropertyEditor").CreatePropertyRowGenerator(Args);
-	Generator->SetObjects({ InObject });
-	Generator->SetCustomValidatePropertyNodesFunction(FOnValidatePropertyRowGeneratorNodes::CreateLambda(MoveTemp(ValidationLambda)));
+	TSharedPtr<IPropertyRowGenerator> Generator;
+
+	// Generators only bind to the objects they are given, an idle one of the same class just has to be pointed at the new object.
+	if (TArray<TSharedPtr<IPropertyRowGenerator>>* ClassIdleGenerators = IdleGenerators.Find(InObject->GetClass()))
+	{
+		Generator = ClassIdleGenerators->Pop(EAllowShrinking::No);
+		if (ClassIdleGenerators->IsEmpty())
+		{
+			IdleGenerators.Remove(InObject->GetClass());
+		}
+		--NumIdleGenerators;
+
+		Generator->SetObjects({ InObject });
+	}
+	else
+	{
+		// Since we must keep many PRG objects alive in order to access the handle data, validating the nodes each tick is very taxing.
+		// We can override the validation with a lambda since the validation function in PRG is not necessary for our implementation
+		auto ValidationLambda = ([](const FRootPropertyNodeList& PropertyNodeList) { return true; });
+		FPropertyRowGeneratorArgs Args;
+		Generator = FModuleManager::GetModuleChecked<FPropertyEditorModule>("PropertyEditor").CreatePropertyRowGenerator(Args);
+		Generator->SetObjects({ InObject });
+		Generator->SetCustomValidatePropertyNodesFunction(FOnValidatePropertyRowGeneratorNodes::CreateLambda(MoveTemp(ValidationLambda)));
+	}
 
 	Generator->OnRowsRefreshed().AddLambda([WeakGenerator = TWeakPtr<IPropertyRowGenerator>(Generator), WeakThis = TWeakPtr<FRCPanelWidgetRegistry>(AsShared())]
 		{
@@ -324,3 +356,102 @@ TSharedPtr<IPropertyRowGenerator> FRCPanelWidgetRegistry::CreateGenerator(UObjec
 	return Generator;
 }
 
+TSharedPtr<IPropertyRowGenerator> FRCPanelWidgetRegistry::FindOrCreateGenerator(UObject* InObject)
+{
+	TSharedPtr<IPropertyRowGenerator> Generator;
+	TWeakObjectPtr<UObject> WeakObject = InObject;
+
+	if (TSharedPtr<IPropertyRowGenerator>* FoundGenerator = ObjectToRowGenerator.Find(WeakObject))
+	{
+		Generator = *FoundGenerator;
+	}
+	else
+	{
+		EvictGenerators();
+
+		Generator = CreateGenerator(InObject);
+		ObjectToRowGenerator.Add(WeakObject, Generator);
+	}
+
+	TouchGenerator(WeakObject);
+
+	return Generator;
+}
+
+void FRCPanelWidgetRegistry::TouchGenerator(const TWeakObjectPtr<UObject>& InObject)
+{
+	if (TDoubleLinkedList<TWeakObjectPtr<UObject>>::TDoubleLinkedListNode** UsageNode = GeneratorUsageNodes.Find(InObject))
+	{
+		GeneratorUsage.RemoveNode(*UsageNode, false);
+		GeneratorUsage.AddHead(*UsageNode);
+	}
+	else
+	{
+		GeneratorUsage.AddHead(InObject);
+		GeneratorUsageNodes.Add(InObject, GeneratorUsage.GetHead());
+	}
+}
+
+void FRCPanelWidgetRegistry::EvictGenerators()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FRCPanelWidgetRegistry::EvictGenerators);
+
+	const int32 MaxGenerators = CVarRemoteControlUIMaxRowGenerators.GetValueOnGameThread();
+	if (MaxGenerators <= 0)
+	{
+		return;
+	}
+
+	// Make room for the generator about to be created.
+	while (ObjectToRowGenerator.Num() >= MaxGenerators)
+	{
+		// Walk from the least recently used generator. Generators held by a widget are in view, they are moved to the front so following evictions skip them.
+		TDoubleLinkedList<TWeakObjectPtr<UObject>>::TDoubleLinkedListNode* EvictedNode = nullptr;
+		for (int32 NumVisited = GeneratorUsage.Num(); NumVisited > 0; --NumVisited)
+		{
+			TDoubleLinkedList<TWeakObjectPtr<UObject>>::TDoubleLinkedListNode* UsageNode = GeneratorUsage.GetTail();
+
+			// Generators of deleted objects are always evicted, otherwise only the ones no widget is holding on to.
+			const TSharedPtr<IPropertyRowGenerator>* UsedGenerator = ObjectToRowGenerator.Find(UsageNode->GetValue());
+			if (!UsageNode->GetValue().IsValid() || !UsedGenerator || UsedGenerator->GetSharedReferenceCount() <= 1)
+			{
+				EvictedNode = UsageNode;
+				break;
+			}
+
+			GeneratorUsage.RemoveNode(UsageNode, false);
+			GeneratorUsage.AddHead(UsageNode);
+		}
+
+		// Every generator is used by a widget in view.
+		if (!EvictedNode)
+		{
+			break;
+		}
+
+		const TWeakObjectPtr<UObject> EvictedObject = EvictedNode->GetValue();
+		GeneratorUsageNodes.Remove(EvictedObject);
+		GeneratorUsage.RemoveNode(EvictedNode);
+
+		TSharedPtr<IPropertyRowGenerator> Generator;
+		ObjectToRowGenerator.RemoveAndCopyValue(EvictedObject, Generator);
+		TreeNodeCache.Remove(EvictedObject);
+
+		if (!Generator)
+		{
+			continue;
+		}
+
+		// Idle generators don't notify the panel, CreateGenerator binds them again once they are reused.
+		Generator->OnRowsRefreshed().Clear();
+
+		UObject* Object = EvictedObject.Get();
+		if (Object && NumIdleGenerators < WidgetRegistryUtils::MaxIdleGenerators)
+		{
+			// Release the property nodes of the evicted object while the generator waits to be reused.
+			Generator->SetObjects({});
+			IdleGenerators.FindOrAdd(Object->GetClass()).Add(MoveTemp(Generator));
+			++NumIdleGenerators;
+		}
+	}
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/List.h"
 #include "Templates/SharedPointer.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
@@ -43,6 +44,12 @@ public:
 	 */
 	TSharedPtr<IDetailTreeNode> GetObjectTreeNode(UObject* InObject, const FString& InField, ERCFindNodeMethod InFindMethod);
 
+	/**
+	 * Get the row generator that generated the detail tree nodes of an object.
+	 * Widgets built from these nodes should hold on to it, the registry only evicts the generators no widget holds.
+	 */
+	TSharedPtr<IPropertyRowGenerator> GetObjectGenerator(UObject* InObject) const;
+
 	/**
 	 * Get a detail tree node for a given struct and field.
 	 * @param InStruct the struct used to generate the detail row.
@@ -80,16 +87,30 @@ private:
 	bool IsNDisplayObject(UObject* InObject, const FString& InField = FString(), ERCFindNodeMethod InFindMethod = ERCFindNodeMethod::Path);
 	TSharedPtr<IDetailTreeNode> FindNDisplayTreeNode(UObject* InObject, const FString& InField, ERCFindNodeMethod InFindMethod);
 	void OnRowsRefreshed(TSharedPtr<IPropertyRowGenerator> Generator);
-	/** Create a property row generator */
+	/** Create a property row generator, reusing an idle generator of the object's class if there is one. */
 	TSharedPtr<IPropertyRowGenerator> CreateGenerator(UObject* InObject);
+	/** Find the generator of an object or create one, marking it as the most recently used. */
+	TSharedPtr<IPropertyRowGenerator> FindOrCreateGenerator(UObject* InObject);
+	/** Mark the generator of an object as the most recently used. */
+	void TouchGenerator(const TWeakObjectPtr<UObject>& InObject);
+	/** Evict the least recently used generators no widget holds until RemoteControl.UI.MaxRowGenerators is respected. */
+	void EvictGenerators();
 
 private:
 	/** Map of objects to row generator, used to have one row generator per object. */
 	TMap<TWeakObjectPtr<UObject>, TSharedPtr<IPropertyRowGenerator>> ObjectToRowGenerator;
 	/** Map of struct on scope to row generator, used to have one row generator per struct ptr. */
 	TMap<TSharedPtr<FStructOnScope>, TSharedPtr<IPropertyRowGenerator>> StructToRowGenerator;
-	/** Cache of Object&Field to tree nodes. */
-	TMap<TPair<TWeakObjectPtr<UObject>, FString>, TWeakPtr<IDetailTreeNode>> TreeNodeCache;
+	/** Objects that have a generator, from the most to the least recently used. */
+	TDoubleLinkedList<TWeakObjectPtr<UObject>> GeneratorUsage;
+	/** Node of each object in GeneratorUsage, so using a generator moves it to the front without a search. */
+	TMap<TWeakObjectPtr<UObject>, TDoubleLinkedList<TWeakObjectPtr<UObject>>::TDoubleLinkedListNode*> GeneratorUsageNodes;
+	/** Evicted generators waiting to be reused for another object of the same class. */
+	TMap<TWeakObjectPtr<UClass>, TArray<TSharedPtr<IPropertyRowGenerator>>> IdleGenerators;
+	/** Number of generators in IdleGenerators. */
+	int32 NumIdleGenerators = 0;
+	/** Cache of tree nodes, by object then field, so the nodes of an evicted object are dropped at once. */
+	TMap<TWeakObjectPtr<UObject>, TMap<FString, TWeakPtr<IDetailTreeNode>>> TreeNodeCache;
 	/** List of tree node finder handlers for certain type */
 	TArray<FRCTreeNodeFinderHandler> SpecialTreeNodeHandlers;
 	/** Called when a generator gets refreshed. (ie. forcefully refreshed by a customization) */
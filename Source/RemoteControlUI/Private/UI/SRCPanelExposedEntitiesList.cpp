@@ -15,6 +15,7 @@
 #include "IRemoteControlProtocolModule.h"
 #include "IRemoteControlProtocolWidgetsModule.h"
 #include "Misc/Attribute.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/Guid.h"
 #include "Misc/MessageDialog.h"
 #include "PropertyPath.h"
@@ -104,6 +105,11 @@ public:
 		FSuperRowType::Construct(SuperArgs, OwnerTableView);
 	}
 
+	TSharedPtr<SRCPanelTreeNode> GetEntity() const
+	{
+		return Entity;
+	}
+
 	TSharedRef<SWidget> GenerateWidgetForColumn(const FName& InColumnName) override
 	{
 		const FName& ActiveProtocolName = ActiveProtocol.Get(NAME_None);
@@ -349,6 +355,7 @@ void SRCPanelExposedEntitiesList::Construct(const FArguments& InArgs, URemoteCon
 	SAssignNew(FieldsListView, STreeView<TSharedPtr<SRCPanelTreeNode>>)
 		.ItemHeight(24.f)
 		.OnGenerateRow(this, &SRCPanelExposedEntitiesList::OnGenerateRow)
+		.OnRowReleased(this, &SRCPanelExposedEntitiesList::OnRowReleased)
 		.OnSelectionChanged(this, &SRCPanelExposedEntitiesList::OnSelectionChanged)
 		.SelectionMode(ESelectionMode::Multi)
 		.TreeItemsSource(&FieldEntities)
@@ -764,15 +771,63 @@ FText SRCPanelExposedEntitiesList::HandleEntityListHeaderLabel() const
 
 void SRCPanelExposedEntitiesList::ExposedEntitiesNodesRefresh()
 {
-	if (bNodesRefreshRequested)
+	if (NodesPendingRefresh.IsEmpty())
+	{
+		return;
+	}
+
+	// Only the rows in view are refreshed here, the others stay marked until OnGenerateRow refreshes them as they scroll in.
+	for (const TSharedPtr<SRCPanelTreeNode>& Node : FieldsListView->GetDisplayedItems())
 	{
-		for (const TPair <FGuid, TSharedPtr<SRCPanelTreeNode>>& Node : FieldWidgetMap)
+		if (Node && NodesPendingRefresh.Remove(Node->GetRCId()) > 0)
 		{
-			Node.Value->Refresh();
+			Node->Refresh();
 		}
+	}
+}
+
+void SRCPanelExposedEntitiesList::UpdatePropertyToEntities()
+{
+	if (!bPropertyToEntitiesDirty || !Preset)
+	{
+		return;
+	}
 
-		bNodesRefreshRequested = false;
+	TRACE_CPUPROFILER_EVENT_SCOPE(SRCPanelExposedEntitiesList::UpdatePropertyToEntities);
+
+	PropertyToEntities.Reset();
+	UnresolvedPropertyEntities.Reset();
+	EntityBindingClasses.Reset();
+
+	for (TWeakPtr<FRemoteControlEntity> WeakEntity : Preset->GetExposedEntities())
+	{
+		if (const TSharedPtr<FRemoteControlEntity> Entity = WeakEntity.Pin())
+		{
+			EntityBindingClasses.Emplace(Entity->GetSupportedBindingClass(), Entity->GetId());
+		}
 	}
+
+	for (TWeakPtr<FRemoteControlProperty> WeakProp : Preset->GetExposedEntities<FRemoteControlProperty>())
+	{
+		if (TSharedPtr<FRemoteControlProperty> RCProp = WeakProp.Pin())
+		{
+			if (!RCProp->FieldPathInfo.IsResolved())
+			{
+				UnresolvedPropertyEntities.Add(RCProp->GetId());
+				continue;
+			}
+
+			for (int32 SegmentIndex = 0; SegmentIndex < RCProp->FieldPathInfo.GetSegmentCount(); SegmentIndex++)
+			{
+				if (const FProperty* ResolvedField = RCProp->FieldPathInfo.GetFieldSegment(SegmentIndex).ResolvedData.Field)
+				{
+					PropertyToEntities.FindOrAdd(ResolvedField).AddUnique(RCProp->GetId());
+				}
+			}
+		}
+	}
+
+	bPropertyToEntitiesDirty = false;
 }
 
 void SRCPanelExposedEntitiesList::OnPropertyIdRenamed(const FName InNewId, TSharedPtr<SRCPanelTreeNode> InNode)
@@ -817,6 +872,7 @@ void SRCPanelExposedEntitiesList::OnLabelModified(const FName InOldName, const F
 			ExposedField.Pin()->Rename(InNewName);
 			const FName NewName = ExposedField.Pin()->GetLabel();
 			EntityNode->SetName(NewName);
+			SearchIndex.Add(*ExposedField.Pin());
 			Preset->OnFieldRenamed().Broadcast(Preset.Get(), OldLabel, NewName);
 		}
 	}
@@ -865,11 +921,23 @@ void SRCPanelExposedEntitiesList::OnObjectPropertyChange(UObject* InObject, FPro
 
 		if (Preset)
 		{
+			UpdatePropertyToEntities();
+
+			TSet<FGuid> AffectedProperties;
+			AffectedProperties.Append(UnresolvedPropertyEntities);
+			for (const FProperty* ChangedProperty : { InChangeEvent.MemberProperty, InChangeEvent.Property })
+			{
+				if (const TArray<FGuid>* EntityIds = ChangedProperty ? PropertyToEntities.Find(ChangedProperty) : nullptr)
+				{
+					AffectedProperties.Append(*EntityIds);
+				}
+			}
+
 			// If the modified property is a parent of an exposed property, re-enable the edit condition.
 			// This is useful in case we re-add an array element which contains a nested property that is exposed.
-			for (TWeakPtr<FRemoteControlProperty> WeakProp : Preset->GetExposedEntities<FRemoteControlProperty>())
+			for (const FGuid& PropertyId : AffectedProperties)
 			{
-				if (TSharedPtr<FRemoteControlProperty> RCProp = WeakProp.Pin())
+				if (TSharedPtr<FRemoteControlProperty> RCProp = Preset->GetExposedEntity<FRemoteControlProperty>(PropertyId).Pin())
 				{
 					if (RCProp->FieldPathInfo.IsResolved() && InObject && InObject->GetClass()->IsChildOf(RCProp->GetSupportedBindingClass()))
 					{
@@ -895,7 +963,28 @@ void SRCPanelExposedEntitiesList::OnObjectPropertyChange(UObject* InObject, FPro
 
 		if (bShouldRefreshNodes)
 		{
-			bNodesRefreshRequested = true;
+			// Changing an actor can also change its components, ie. an array of instanced components, so every widget is refreshed then.
+			if (InObject && Preset && !InObject->IsA<AActor>())
+			{
+				// Only the widgets of the entities that can be bound to the refreshed object are affected.
+				const AActor* OuterActor = InObject->GetTypedOuter<AActor>();
+				for (const TPair<TWeakObjectPtr<UClass>, FGuid>& EntityBindingClass : EntityBindingClasses)
+				{
+					if (const UClass* BindingClass = EntityBindingClass.Key.Get())
+					{
+						if (InObject->GetClass()->IsChildOf(BindingClass) || (OuterActor && OuterActor->GetClass()->IsChildOf(BindingClass)))
+						{
+							NodesPendingRefresh.Add(EntityBindingClass.Value);
+						}
+					}
+				}
+			}
+			else
+			{
+				TArray<FGuid> EntityIds;
+				FieldWidgetMap.GenerateKeyArray(EntityIds);
+				NodesPendingRefresh.Append(EntityIds);
+			}
 		}
 	}
 
@@ -923,19 +1012,18 @@ void SRCPanelExposedEntitiesList::TryRefreshingSearch(const FText& InSearchText,
 
 	*SearchedText = InSearchText;
 
+	const TSet<FGuid>& MatchingEntities = SearchIndex.Search(InSearchText.ToString());
+	const TSharedPtr<SRCPanelTreeNode> SelectedGroup = GetSelectedGroup();
+
 	for (TWeakPtr<FRemoteControlEntity> WeakEntity : Preset->GetExposedEntities())
 	{
 		if (const TSharedPtr<FRemoteControlEntity> Entity = WeakEntity.Pin())
 		{
-			if (TSharedPtr<SRCPanelTreeNode> SelectedGroup = GetSelectedGroup())
+			if (SelectedGroup && MatchingEntities.Contains(Entity->GetId()))
 			{
 				if (FRemoteControlPresetGroup* EntityGroup = Preset->Layout.FindGroupFromField(Entity->GetId()))
 				{
-					const FString& EntityLabel = Entity->GetLabel().ToString();
-
-					if (EntityLabel.Contains(*InSearchText.ToString()) &&
-						(SelectedGroup->GetRCId() == EntityGroup->Id ||
-							Preset->Layout.IsDefaultGroup(SelectedGroup->GetRCId())))
+					if (SelectedGroup->GetRCId() == EntityGroup->Id || Preset->Layout.IsDefaultGroup(SelectedGroup->GetRCId()))
 					{
 						if (TSharedPtr<SRCPanelTreeNode>* FoundNode = FieldWidgetMap.Find(Entity->GetId()))
 						{
@@ -964,6 +1052,9 @@ void SRCPanelExposedEntitiesList::GenerateListWidgets()
 
 	TArray<FGuid> OrderMap = Preset->Layout.GetDefaultGroupOrder();
 	FieldWidgetMap.Reset();
+	NodesPendingRefresh.Reset();
+	SearchIndex.Reset();
+	bPropertyToEntitiesDirty = true;
 
 	for (TWeakPtr<FRemoteControlEntity> WeakEntity : Preset->GetExposedEntities())
 	{
@@ -977,6 +1068,7 @@ void SRCPanelExposedEntitiesList::GenerateListWidgets()
 			Args.bIsInLiveMode = bIsInLiveMode;
 
 			FieldWidgetMap.Add(Entity->GetId(), FRemoteControlUIModule::Get().GenerateEntityWidget(Args));
+			SearchIndex.Add(*Entity);
 		}
 	}
 
@@ -1098,6 +1190,24 @@ TSharedRef<ITableRow> SRCPanelExposedEntitiesList::OnGenerateRow(TSharedPtr<SRCP
 		Node->OnPropertyIdRenamed().BindSP(this, &SRCPanelExposedEntitiesList::OnPropertyIdRenamed, Node);
 		Node->OnLabelModified().BindSP(this, &SRCPanelExposedEntitiesList::OnLabelModified);
 
+		if (NodesPendingRefresh.Remove(Node->GetRCId()) > 0)
+		{
+			Node->Refresh();
+		}
+
+		if (Node->GetRCType() == SRCPanelTreeNode::Field)
+		{
+			const TSharedPtr<SRCPanelExposedField> ExposedField = StaticCastSharedPtr<SRCPanelExposedField>(Node);
+			const bool bHadChildren = ExposedField->HasChildren();
+			ExposedField->ConstructPendingPropertyWidget();
+
+			// The children of a field are only known once its property widget is constructed.
+			if (!bHadChildren && ExposedField->HasChildren())
+			{
+				FieldsListView->RequestTreeRefresh();
+			}
+		}
+
 		return SNew(SEntityRow, OwnerTable)
 			.OnDragDetected(FOnDragDetected::CreateSP(this, &SRCPanelExposedEntitiesList::OnNodeDragDetected, Node))
 			.OnDragEnter_Lambda([Node](const FDragDropEvent& Event) { if (Node && Node->GetRCType() == SRCPanelTreeNode::Field) StaticCastSharedPtr<SRCPanelExposedField>(Node)->SetIsHovered(true); })
@@ -1110,6 +1220,20 @@ TSharedRef<ITableRow> SRCPanelExposedEntitiesList::OnGenerateRow(TSharedPtr<SRCP
 	}
 }
 
+void SRCPanelExposedEntitiesList::OnRowReleased(const TSharedRef<ITableRow>& InRow)
+{
+	if (InRow->AsWidget()->GetType() != TEXT("SEntityRow"))
+	{
+		return;
+	}
+
+	const TSharedPtr<SRCPanelTreeNode> Node = StaticCastSharedRef<SEntityRow>(InRow->AsWidget())->GetEntity();
+	if (Node && Node->GetRCType() == SRCPanelTreeNode::Field)
+	{
+		StaticCastSharedPtr<SRCPanelExposedField>(Node)->ReleasePropertyWidget();
+	}
+}
+
 void SRCPanelExposedEntitiesList::OnGetNodeChildren(TSharedPtr<SRCPanelTreeNode> Node, TArray<TSharedPtr<SRCPanelTreeNode>>& OutNodes)
 {
 	if (Node.IsValid())
@@ -1268,6 +1392,12 @@ void SRCPanelExposedEntitiesList::OnDeleteGroup(const FGuid& GroupId)
 
 void SRCPanelExposedEntitiesList::OnEntityRebind(const FGuid& InEntityGuid)
 {
+	if (const TSharedPtr<FRemoteControlEntity> RCEntity = Preset->GetExposedEntity(InEntityGuid).Pin())
+	{
+		SearchIndex.Add(*RCEntity);
+	}
+	bPropertyToEntitiesDirty = true;
+
 	const TSharedPtr<SRCPanelTreeNode>* FoundNode = FieldEntities.FindByPredicate([InEntityGuid] (const TSharedPtr<SRCPanelTreeNode>& InNode) { return InNode->GetRCId() == InEntityGuid; } );
 	if (FoundNode && FoundNode->IsValid())
 	{
@@ -1308,13 +1438,57 @@ void SRCPanelExposedEntitiesList::SelectActorsInlevel(const TArray<UObject*>& Ob
 void SRCPanelExposedEntitiesList::RegisterEvents()
 {
 	OnPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &SRCPanelExposedEntitiesList::OnObjectPropertyChange);
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddSP(this, &SRCPanelExposedEntitiesList::OnObjectsReplaced);
+	OnActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddSP(this, &SRCPanelExposedEntitiesList::OnActorLabelChanged);
+
+	if (GEditor)
+	{
+		OnBlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddSP(this, &SRCPanelExposedEntitiesList::OnBlueprintCompiled);
+	}
 
 	OnProtocolBindingAddedOrRemovedHandle = IRemoteControlProtocolWidgetsModule::Get().OnProtocolBindingAddedOrRemoved().AddSP(this, &SRCPanelExposedEntitiesList::OnProtocolBindingAddedOrRemoved);
 }
 
+void SRCPanelExposedEntitiesList::OnObjectsReplaced(const TMap<UObject*, UObject*>& InReplacementMap)
+{
+	bPropertyToEntitiesDirty = true;
+}
+
+void SRCPanelExposedEntitiesList::OnBlueprintCompiled()
+{
+	bPropertyToEntitiesDirty = true;
+}
+
+void SRCPanelExposedEntitiesList::OnActorLabelChanged(AActor* InActor)
+{
+	TArray<FGuid> EntityIds;
+	SearchIndex.GetEntitiesBoundToActor(InActor, EntityIds);
+	if (EntityIds.IsEmpty() || !Preset)
+	{
+		return;
+	}
+
+	for (const FGuid& EntityId : EntityIds)
+	{
+		if (const TSharedPtr<FRemoteControlEntity> Entity = Preset->GetExposedEntity(EntityId).Pin())
+		{
+			SearchIndex.Add(*Entity);
+		}
+	}
+
+	RequestSearchOrFilter();
+}
+
 void SRCPanelExposedEntitiesList::UnregisterEvents()
 {
 	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+	FCoreDelegates::OnActorLabelChanged.Remove(OnActorLabelChangedHandle);
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(OnBlueprintCompiledHandle);
+	}
 
 	IRemoteControlProtocolWidgetsModule::Get().OnProtocolBindingAddedOrRemoved().Remove(OnProtocolBindingAddedOrRemovedHandle);
 }
@@ -1659,6 +1833,12 @@ void SRCPanelExposedEntitiesList::OnEntityAdded(const FGuid& InEntityId)
 	Args.bIsInLiveMode = bIsInLiveMode;
 	Args.Entity = Preset->GetExposedEntity(InEntityId).Pin();
 
+	if (Args.Entity)
+	{
+		SearchIndex.Add(*Args.Entity);
+	}
+	bPropertyToEntitiesDirty = true;
+
 	ExposeEntity(FRemoteControlUIModule::Get().GenerateEntityWidget(Args));
 }
 
@@ -1682,6 +1862,9 @@ void SRCPanelExposedEntitiesList::OnEntityRemoved(const FGuid& InGroupId, const
 	}
 
 	FieldWidgetMap.Remove(InEntityId);
+	NodesPendingRefresh.Remove(InEntityId);
+	SearchIndex.Remove(InEntityId);
+	bPropertyToEntitiesDirty = true;
 	
 	GenerateListWidgets(*Preset->Layout.GetGroup(InGroupId));
 }
@@ -1823,6 +2006,15 @@ void SRCPanelExposedEntitiesList::OnFieldOrderChanged(const FGuid& GroupId, cons
 
 void SRCPanelExposedEntitiesList::OnEntitiesUpdated(URemoteControlPreset*, const TSet<FGuid>& UpdatedEntities)
 {
+	for (const FGuid& UpdatedEntityId : UpdatedEntities)
+	{
+		if (const TSharedPtr<FRemoteControlEntity> RCEntity = Preset->GetExposedEntity(UpdatedEntityId).Pin())
+		{
+			SearchIndex.Add(*RCEntity);
+		}
+	}
+	bPropertyToEntitiesDirty = true;
+
 	GEditor->GetTimerManager()->SetTimerForNextTick(FTimerDelegate::CreateLambda([WeakListPtr = TWeakPtr<SRCPanelExposedEntitiesList>(StaticCastSharedRef<SRCPanelExposedEntitiesList>(AsShared()))]()
 	{
 		if (TSharedPtr<SRCPanelExposedEntitiesList> ListPtr = WeakListPtr.Pin())
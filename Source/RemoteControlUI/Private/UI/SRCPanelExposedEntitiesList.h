@@ -4,6 +4,7 @@
 
 #include "IRemoteControlUIModule.h"
 #include "Misc/TextFilter.h"
+#include "RCPanelEntitySearchIndex.h"
 #include "RemoteControlPreset.h"
 #include "SRCPanelExposedEntitiesGroup.h"
 #include "SRCPanelTreeNode.h"
@@ -138,6 +139,12 @@ private:
 	FText HandleEntityListHeaderLabel() const;
 	/** Handles object property changes, used to update arrays correctly.  */
 	void OnObjectPropertyChange(UObject* InObject, FPropertyChangedEvent& InChangeEvent);
+	/** Handles objects being reinstanced, the properties they were exposed through may have been replaced. */
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& InReplacementMap);
+	/** Handles blueprints being compiled, the properties of their classes are regenerated. */
+	void OnBlueprintCompiled();
+	/** Handles actors being renamed, their label is indexed for the search. */
+	void OnActorLabelChanged(AActor* InActor);
 	/** Create exposed entity widgets. */
 	void GenerateListWidgets();
 	/** Create exposed entity widgets. */
@@ -146,6 +153,8 @@ private:
 	void RefreshGroups();
 	/** Generate row widgets for groups and exposed entities. */
 	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<SRCPanelTreeNode> Node, const TSharedRef<STableViewBase>& OwnerTable);
+	/** Release the property widget of a field once its row goes out of view. */
+	void OnRowReleased(const TSharedRef<ITableRow>& InRow);
 	/** Handle getting a node's children. */
 	void OnGetNodeChildren(TSharedPtr<SRCPanelTreeNode> Node, TArray<TSharedPtr<SRCPanelTreeNode>>& OutNodes);
 	/** Handle selection changes. */
@@ -251,10 +260,13 @@ private:
 	void ProcessRefresh();
 
 	/**
-	 * If necessary, will perform a refresh of the exposed entities nodes widgets.
+	 * Refresh the widgets of the exposed entities in view that are pending a refresh.
 	 */
 	void ExposedEntitiesNodesRefresh();
 
+	/** Rebuild the index of the exposed properties by the properties of their field path, if it is out of date. */
+	void UpdatePropertyToEntities();
+
 	/** Executed when a property Id is changed, will set all selected node(s) property id to the new one */
 	void OnPropertyIdRenamed(const FName InNewId, TSharedPtr<SRCPanelTreeNode> InNode);
 
@@ -293,6 +305,12 @@ private:
 	TStrongObjectPtr<URemoteControlPreset> Preset;
 	/** Handle to the delegate called when an object property change is detected. */
 	FDelegateHandle OnPropertyChangedHandle;
+	/** Handle to the delegate called when objects are reinstanced. */
+	FDelegateHandle OnObjectsReplacedHandle;
+	/** Handle to the delegate called when a blueprint is compiled. */
+	FDelegateHandle OnBlueprintCompiledHandle;
+	/** Handle to the delegate called when an actor label changes. */
+	FDelegateHandle OnActorLabelChangedHandle;
 	/** Handle to the delegate called when a binding is added or removed. */
 	FDelegateHandle OnProtocolBindingAddedOrRemovedHandle;
 	/** Delegate called on selected group change. */
@@ -337,6 +355,18 @@ private:
 	bool bRefreshRequested = false;
 	bool bRefreshEntitiesGroups = false;
 
-	/** When true, widgets of the Exposed Entities List will be refreshed on Tick */
-	bool bNodesRefreshRequested = false;
+	/** Widgets of the Exposed Entities List to refresh on Tick, the ones out of view are refreshed once their row is generated. */
+	TSet<FGuid> NodesPendingRefresh;
+
+	/** Index of the exposed entities searched by TryRefreshingSearch. */
+	FRCPanelEntitySearchIndex SearchIndex;
+
+	/** Exposed properties by the properties of their field path, used to find the ones affected by a property change. */
+	TMap<const FProperty*, TArray<FGuid>> PropertyToEntities;
+	/** Exposed properties whose field path wasn't resolved when PropertyToEntities was built. */
+	TArray<FGuid> UnresolvedPropertyEntities;
+	/** Exposed entities by the class they can be bound to, used to find the widgets affected by an object refresh. */
+	TArray<TPair<TWeakObjectPtr<UClass>, FGuid>> EntityBindingClasses;
+	/** When true, PropertyToEntities and EntityBindingClasses are rebuilt on their next use. */
+	bool bPropertyToEntitiesDirty = true;
 };
\ No newline at end of file
@@ -150,7 +150,8 @@ void SRCPanelExposedField::Construct(const FArguments& InArgs, TWeakPtr<FRemoteC
 
 		if (FieldPtr->FieldType == EExposedFieldType::Property)
 		{
-			ConstructPropertyWidget();
+			// Generating the detail rows of a property is expensive, only do it once the field scrolls into view.
+			bPropertyWidgetPending = true;
 		}
 		else
 		{
@@ -361,7 +362,11 @@ void SRCPanelExposedField::Refresh()
 
 		if (Field->FieldType == EExposedFieldType::Property)
 		{
-			ConstructPropertyWidget();
+			// A pending widget is constructed up to date once its row gets generated.
+			if (!bPropertyWidgetPending)
+			{
+				ConstructPropertyWidget();
+			}
 		}
 		else if (Field->FieldType == EExposedFieldType::Function)
 		{
@@ -372,6 +377,9 @@ void SRCPanelExposedField::Refresh()
 
 TSharedRef<SWidget> SRCPanelExposedField::GetWidget(const FName ForColumnName, const FName InActiveProtocol)
 {
+	// Rows get their column widgets from here when they are generated.
+	ConstructPendingPropertyWidget();
+
 	if (HasProtocolExtension())
 	{
 		if (ForColumnName == RemoteControlPresetColumns::Mask)
@@ -419,6 +427,8 @@ TSharedRef<SWidget> SRCPanelExposedField::ConstructWidget()
 
 				if (TSharedPtr<IDetailTreeNode> Node = Registry->GetObjectTreeNode(Object, Field->FieldPathInfo.ToPathPropertyString(), ERCFindNodeMethod::Path))
 				{
+					RowGenerator = Registry->GetObjectGenerator(Object);
+
 					TSharedPtr<SWidget> ValueWidget = SNullWidget::NullWidget;
 					TSharedPtr<SWidget> EditConditionWidget = SNullWidget::NullWidget;
 					TSharedPtr<IPropertyHandle> PropertyHandle;
@@ -648,6 +658,29 @@ void SRCPanelExposedField::ConstructPropertyWidget()
 	ChildSlot.AttachWidget(ConstructWidget());
 }
 
+void SRCPanelExposedField::ConstructPendingPropertyWidget()
+{
+	if (bPropertyWidgetPending)
+	{
+		bPropertyWidgetPending = false;
+		ConstructPropertyWidget();
+	}
+}
+
+void SRCPanelExposedField::ReleasePropertyWidget()
+{
+	if (bPropertyWidgetPending || bIsHovered || ChildWidgets.Num() > 0 || GetFieldType() != EExposedFieldType::Property)
+	{
+		return;
+	}
+
+	ChildSlot.AttachWidget(SNullWidget::NullWidget);
+	MakeNodeWidgets(FMakeNodeWidgetArgs());
+	ResetButtonWidget = SNullWidget::NullWidget;
+	RowGenerator.Reset();
+	bPropertyWidgetPending = true;
+}
+
 void SRCPanelExposedField::ConstructFunctionWidget()
 {
 	TSharedPtr<SRCPanelExposedField> ExposedFieldWidget;
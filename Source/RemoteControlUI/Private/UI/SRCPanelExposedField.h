@@ -18,6 +18,7 @@ class FRCPanelWidgetRegistry;
 struct FRemoteControlField;
 struct FGuid;
 class IDetailTreeNode;
+class IPropertyRowGenerator;
 class SInlineEditableTextBlock;
 struct SRCPanelFieldChildNode;
 class URemoteControlPreset;
@@ -76,6 +77,15 @@ struct SRCPanelExposedField : public SRCPanelExposedEntity
 	/** Get the owner name of this field */
 	FName GetOwnerName() const;
 
+	/** Construct the property widget if it was deferred until the field's row gets generated. */
+	void ConstructPendingPropertyWidget();
+
+	/**
+	 * Release the property widget once the field's row is out of view, so the registry can evict its row generator.
+	 * The widget is constructed again the next time the row is generated. Fields with child rows are kept as is.
+	 */
+	void ReleasePropertyWidget();
+
 protected:
 	/** Returns populated args to display this widget. */
 	virtual FMakeNodeWidgetArgs CreateEntityWidgetInternal(TSharedPtr<SWidget> ValueWidget, TSharedPtr<SWidget> ResetWidget = SNullWidget::NullWidget, const FText& OptionalWarningMessage = FText::GetEmpty(), TSharedRef<SWidget> EditConditionWidget = SNullWidget::NullWidget) override;
@@ -114,6 +124,10 @@ private:
 	TArray<TSharedPtr<SRCPanelFieldChildNode>> ChildWidgets;
 	/** Holds the panel's cached widgets. */
 	TWeakPtr<FRCPanelWidgetRegistry> WidgetRegistry;
+	/** Row generator of the property widget, held so the registry doesn't evict it while the widget is in use. */
+	TSharedPtr<IPropertyRowGenerator> RowGenerator;
+	/** Whether the property widget is only constructed once the field's row gets generated. */
+	bool bPropertyWidgetPending = false;
 	/** Holds the zeroed Default Value of the ExposedField */
 	TUniquePtr<uint8[]> DefaultValue;
 	/** Holds the shared reference of reset button for this field. */
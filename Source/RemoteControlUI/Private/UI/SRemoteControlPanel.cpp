@@ -1457,6 +1457,8 @@ void SRemoteControlPanel::RegisterEvents()
 
 	Preset->OnEntityExposed().AddSP(this, &SRemoteControlPanel::OnEntityExposed);
 	Preset->OnEntityUnexposed().AddSP(this, &SRemoteControlPanel::OnEntityUnexposed);
+	Preset->OnEntitiesExposed().AddSP(this, &SRemoteControlPanel::OnEntitiesExposedOrUnexposed);
+	Preset->OnEntitiesUnexposed().AddSP(this, &SRemoteControlPanel::OnEntitiesExposedOrUnexposed);
 
 	UMaterial::OnMaterialCompilationFinished().AddSP(this, &SRemoteControlPanel::OnMaterialCompiled);
 }
@@ -1465,6 +1467,8 @@ void SRemoteControlPanel::UnregisterEvents()
 {
 	Preset->OnEntityExposed().RemoveAll(this);
 	Preset->OnEntityUnexposed().RemoveAll(this);
+	Preset->OnEntitiesExposed().RemoveAll(this);
+	Preset->OnEntitiesUnexposed().RemoveAll(this);
 
 	if (GEngine)
 	{
@@ -1906,6 +1910,11 @@ void SRemoteControlPanel::OnEntityUnexposed(URemoteControlPreset* InPreset, cons
 	CachedExposedPropertyArgs.Empty();
 }
 
+void SRemoteControlPanel::OnEntitiesExposedOrUnexposed(URemoteControlPreset* InPreset, const TArray<FGuid>& InEntityIds)
+{
+	CachedExposedPropertyArgs.Empty();
+}
+
 FReply SRemoteControlPanel::OnClickSettingsButton()
 {
 	FModuleManager::LoadModuleChecked<ISettingsModule>("Settings").ShowViewer("Project", "Plugins", "Remote Control");
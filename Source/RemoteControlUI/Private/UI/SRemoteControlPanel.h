@@ -253,6 +253,7 @@ private:
 	//~ Handlers called in order to clear the exposed property cache.
 	void OnEntityExposed(URemoteControlPreset* InPreset, const FGuid& InEntityId);
 	void OnEntityUnexposed(URemoteControlPreset* InPreset, const FGuid& InEntityId);
+	void OnEntitiesExposedOrUnexposed(URemoteControlPreset* InPreset, const TArray<FGuid>& InEntityIds);
 
 	/** Toggles the logging part of UI */
 	void OnLogCheckboxToggle(ECheckBoxState State);
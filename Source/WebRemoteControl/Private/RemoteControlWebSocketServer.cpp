@@ -13,6 +13,7 @@
 #include "SocketSubsystem.h"
 #include "Sockets.h"
 #include "WebRemoteControlInternalUtils.h"
+#include "WebRemoteControlMetrics.h"
 #include "WebSocketNetworkingDelegates.h"
 
 #define LOCTEXT_NAMESPACE "RCWebSocketServer"
@@ -66,6 +67,10 @@ namespace RemoteControlWebSocketServer
 			{
 				Message.Header.FindOrAdd(WebRemoteControlInternalUtils::ForwardedIPHeader) = { Request.ForwardedFor };
 			}
+			if (!Request.SessionToken.IsEmpty())
+			{
+				Message.Header.FindOrAdd(WebRemoteControlInternalUtils::SessionTokenHeader) = { Request.SessionToken };
+			}
 			Message.MessageName = MoveTemp(Request.MessageName);
 			ParsedMessage = MoveTemp(Message);
 		}
@@ -185,6 +190,8 @@ FRCWebSocketServer::~FRCWebSocketServer()
 
 void FRCWebSocketServer::Broadcast(const TArray<uint8>& InUTF8Payload)
 {
+	FWebRemoteControlMetrics::Get().EventFanOut.Record(Connections.Num());
+
 	for (FWebSocketConnection& Connection : Connections)
 	{
 		SendOnConnection(Connection, InUTF8Payload);
@@ -205,6 +212,11 @@ bool FRCWebSocketServer::IsRunning() const
 	return !!Server;
 }
 
+bool FRCWebSocketServer::IsConnected(const FGuid& ClientId) const
+{
+	return Connections.ContainsByPredicate([&ClientId](const FWebSocketConnection& Connection) { return Connection.Id == ClientId; });
+}
+
 void FRCWebSocketServer::SetClientCompressionMode(const FGuid& ClientId, ERCWebSocketCompressionMode Mode)
 {
 	for (FWebSocketConnection& Connection : Connections)
@@ -221,6 +233,7 @@ void FRCWebSocketServer::SetClientCompressionMode(const FGuid& ClientId, ERCWebS
 
 bool FRCWebSocketServer::Tick(float DeltaTime)
 {
+	FRCMetricsScopedTimer TickTimer(FWebRemoteControlMetrics::Get().WebSocketServerTickTime);
 	Server->Tick();
 	return true;
 }
@@ -360,6 +373,15 @@ void FRCWebSocketServer::SendOnConnection(FWebSocketConnection& Connection, cons
 				InUTF8Payload.GetData(), InUTF8Payload.Num()
 			);
 
+			FWebRemoteControlMetrics& Metrics = FWebRemoteControlMetrics::Get();
+			const int32 SentSize = bCompressOk && CompressedSize < InUTF8Payload.Num() ? CompressedSize : InUTF8Payload.Num();
+			Metrics.UncompressedBytes.fetch_add(InUTF8Payload.Num(), std::memory_order_relaxed);
+			Metrics.CompressedBytes.fetch_add(SentSize, std::memory_order_relaxed);
+			if (InUTF8Payload.Num() > 0)
+			{
+				Metrics.CompressionRatio.Record(static_cast<uint64>(SentSize) * 1000 / InUTF8Payload.Num());
+			}
+
 			if (bCompressOk && CompressedSize < InUTF8Payload.Num())
 			{
 				Connection.Socket->Send(CompressedPayload.GetData(), CompressedSize, /*PrependSize=*/false);
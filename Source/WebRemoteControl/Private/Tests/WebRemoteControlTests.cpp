@@ -0,0 +1,233 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/SecureHash.h"
+#include "RemoteControlSettings.h"
+#include "RemoteControlWebsocketRoute.h"
+#include "WebRemoteControl.h"
+#include "WebRemoteControlBufferPool.h"
+#include "WebRemoteControlInternalUtils.h"
+#include "WebRemoteControlMetrics.h"
+
+namespace WebRemoteControlTest
+{
+	/** Restores the access settings modified by a test. */
+	struct FScopedClientAccessSettings
+	{
+		FScopedClientAccessSettings()
+		{
+			const URemoteControlSettings* Settings = GetDefault<URemoteControlSettings>();
+			bRestrictServerAccess = Settings->bRestrictServerAccess;
+			bEnforcePassphraseForRemoteClients = Settings->bEnforcePassphraseForRemoteClients;
+			Passphrases = Settings->Passphrases;
+		}
+
+		~FScopedClientAccessSettings()
+		{
+			URemoteControlSettings* Settings = GetMutableDefault<URemoteControlSettings>();
+			Settings->bRestrictServerAccess = bRestrictServerAccess;
+			Settings->bEnforcePassphraseForRemoteClients = bEnforcePassphraseForRemoteClients;
+			Settings->Passphrases = MoveTemp(Passphrases);
+		}
+
+		bool bRestrictServerAccess = false;
+		bool bEnforcePassphraseForRemoteClients = false;
+		TArray<FRCPassphrase> Passphrases;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWebRemoteControlSessionTokenWebSocketTest, "Plugins.RemoteControl.WebRemoteControl.SessionTokenWebSocket", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FWebRemoteControlSessionTokenWebSocketTest::RunTest(const FString& Parameters)
+{
+	FWebRemoteControlModule& WebRemoteControl = FWebRemoteControlModule::Get();
+	if (!WebRemoteControl.WebSocketRouter)
+	{
+		AddInfo(TEXT("Web remote control is disabled, skipping the test."));
+		return true;
+	}
+
+	WebRemoteControlTest::FScopedClientAccessSettings ScopedSettings;
+
+	URemoteControlSettings* Settings = GetMutableDefault<URemoteControlSettings>();
+	Settings->bRestrictServerAccess = true;
+	Settings->bEnforcePassphraseForRemoteClients = true;
+	FRCPassphrase Passphrase;
+	Passphrase.Identifier = TEXT("SessionTokenTest");
+	Passphrase.Passphrase = FMD5::HashAnsiString(TEXT("SessionTokenTestPassphrase"));
+	Settings->Passphrases = { Passphrase };
+
+	int32 NumDispatched = 0;
+	const FRemoteControlWebsocketRoute Route{ TEXT("Session token test route."), TEXT("test.sessiontoken"), FWebSocketMessageDelegate::CreateLambda([&NumDispatched](const FRemoteControlWebSocketMessage&) { NumDispatched++; }) };
+	WebRemoteControl.RegisterWebsocketRoute(Route);
+
+	// Messages of a connection that was never opened on the server, its replies are dropped.
+	const FGuid ClientId = FGuid::NewGuid();
+	auto Dispatch = [&WebRemoteControl, &ClientId, &Route](TMap<FString, TArray<FString>> Header)
+	{
+		FRemoteControlWebSocketMessage Message;
+		Message.MessageName = Route.MessageName;
+		Message.ClientId = ClientId;
+		Message.Header = MoveTemp(Header);
+		WebRemoteControl.WebSocketRouter->AttemptDispatch(Message);
+	};
+
+	int32 LifetimeSeconds = 0;
+	const FString SessionToken = WebRemoteControlInternalUtils::CreateSessionToken(LifetimeSeconds);
+	TestFalse(TEXT("A session token was created."), SessionToken.IsEmpty());
+
+	AddExpectedError(WebRemoteControlInternalUtils::InvalidPassphraseError, EAutomationExpectedErrorFlags::Contains, 2);
+
+	// A wrong passphrase along with a valid token is accepted because of the token, which must be tracked for the connection.
+	Dispatch({ { WebRemoteControlInternalUtils::PassphraseHeader, { TEXT("NotThePassphrase") } }, { WebRemoteControlInternalUtils::SessionTokenHeader, { SessionToken } } });
+	TestEqual(TEXT("A message with a valid session token is dispatched."), NumDispatched, 1);
+
+	Dispatch({});
+	TestEqual(TEXT("Messages of an authenticated connection are dispatched without credentials."), NumDispatched, 2);
+
+	WebRemoteControlInternalUtils::RevokeSessionToken(SessionToken);
+
+	Dispatch({});
+	TestEqual(TEXT("Messages of a connection whose session token was revoked are denied."), NumDispatched, 2);
+
+	Dispatch({ { WebRemoteControlInternalUtils::PassphraseHeader, { TEXT("NotThePassphrase") } }, { WebRemoteControlInternalUtils::SessionTokenHeader, { SessionToken } } });
+	TestEqual(TEXT("A revoked session token doesn't authenticate the connection again."), NumDispatched, 2);
+
+	Dispatch({ { WebRemoteControlInternalUtils::PassphraseHeader, { Passphrase.Passphrase } } });
+	TestEqual(TEXT("The connection can authenticate again with its passphrase."), NumDispatched, 3);
+
+	WebRemoteControl.UnregisterWebsocketRoute(Route);
+	WebRemoteControl.OnWebSocketConnectionClosed(ClientId);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWebRemoteControlBufferPoolTest, "Plugins.RemoteControl.WebRemoteControl.BufferPool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FWebRemoteControlBufferPoolTest::RunTest(const FString& Parameters)
+{
+	// Pools are per thread, run on a new thread so the test starts from an empty pool.
+	Async(EAsyncExecution::Thread, [this]()
+	{
+		FWebRemoteControlMetrics& Metrics = FWebRemoteControlMetrics::Get();
+		const auto GetMetric = [](const std::atomic<uint64>& InMetric) { return static_cast<int64>(InMetric.load(std::memory_order_relaxed)); };
+
+		const int64 InitialMisses = GetMetric(Metrics.PooledBufferMisses);
+		const int64 InitialHits = GetMetric(Metrics.PooledBufferHits);
+		const int64 InitialBytesInUse = GetMetric(Metrics.PooledBufferBytesInUse);
+		const int64 InitialIdleBytes = GetMetric(Metrics.PooledBufferIdleBytes);
+
+		// 1. Buffers are allocated with the capacity of their size class, and accounted as in use until released.
+		TArray<uint8> Buffer = FWebRemoteControlBufferPool::Acquire(1000);
+		const int32 SmallCapacity = Buffer.Max();
+		TestTrue(TEXT("Capacity is rounded up to the size class"), SmallCapacity >= 1024 && SmallCapacity < 2048);
+		TestEqual(TEXT("Acquiring from an empty pool is a miss"), GetMetric(Metrics.PooledBufferMisses) - InitialMisses, (int64)1);
+		TestEqual(TEXT("Acquired bytes are in use"), GetMetric(Metrics.PooledBufferBytesInUse) - InitialBytesInUse, (int64)SmallCapacity);
+		TestTrue(TEXT("Peak covers the bytes in use"), GetMetric(Metrics.PooledBufferPeakBytes) >= GetMetric(Metrics.PooledBufferBytesInUse));
+
+		Buffer.AddZeroed(100);
+		FWebRemoteControlBufferPool::Release(MoveTemp(Buffer), SmallCapacity);
+		TestEqual(TEXT("Released bytes are no longer in use"), GetMetric(Metrics.PooledBufferBytesInUse), InitialBytesInUse);
+		TestEqual(TEXT("Released bytes are idle"), GetMetric(Metrics.PooledBufferIdleBytes) - InitialIdleBytes, (int64)SmallCapacity);
+
+		// 2. Smaller requests reuse a free buffer of a larger size class, emptied.
+		Buffer = FWebRemoteControlBufferPool::Acquire(300);
+		TestEqual(TEXT("The free buffer is reused"), GetMetric(Metrics.PooledBufferHits) - InitialHits, (int64)1);
+		TestEqual(TEXT("The reused buffer keeps its capacity"), Buffer.Max(), SmallCapacity);
+		TestEqual(TEXT("The reused buffer is empty"), Buffer.Num(), 0);
+		TestEqual(TEXT("Reused bytes are no longer idle"), GetMetric(Metrics.PooledBufferIdleBytes), InitialIdleBytes);
+		FWebRemoteControlBufferPool::Release(MoveTemp(Buffer), SmallCapacity);
+
+		// 3. Larger requests don't take a smaller buffer.
+		{
+			const int64 MissesBefore = GetMetric(Metrics.PooledBufferMisses);
+			Buffer = FWebRemoteControlBufferPool::Acquire(2000);
+			const int32 AcquiredCapacity = Buffer.Max();
+			TestTrue(TEXT("A larger request gets a larger buffer"), AcquiredCapacity >= 2048);
+			TestEqual(TEXT("A larger request allocates its own buffer"), GetMetric(Metrics.PooledBufferMisses) - MissesBefore, (int64)1);
+			FWebRemoteControlBufferPool::Release(MoveTemp(Buffer), AcquiredCapacity);
+		}
+
+		// 4. Each size class keeps a bounded number of free buffers. The size class is above the ones used so far so requests can't fall back to them.
+		{
+			constexpr int32 MediumCapacity = 64 * 1024;
+			TArray<TArray<uint8>> Buffers;
+			for (int32 Index = 0; Index < FWebRemoteControlBufferPool::MaxFreeBuffersPerSizeClass + 2; ++Index)
+			{
+				Buffers.Add(FWebRemoteControlBufferPool::Acquire(MediumCapacity));
+			}
+
+			for (TArray<uint8>& PooledBuffer : Buffers)
+			{
+				const int32 AcquiredCapacity = PooledBuffer.Max();
+				FWebRemoteControlBufferPool::Release(MoveTemp(PooledBuffer), AcquiredCapacity);
+			}
+
+			const int64 HitsBefore = GetMetric(Metrics.PooledBufferHits);
+			Buffers.Reset();
+			for (int32 Index = 0; Index < FWebRemoteControlBufferPool::MaxFreeBuffersPerSizeClass + 1; ++Index)
+			{
+				Buffers.Add(FWebRemoteControlBufferPool::Acquire(MediumCapacity));
+			}
+			TestEqual(TEXT("Only the free buffers kept by the size class are reused"), GetMetric(Metrics.PooledBufferHits) - HitsBefore, (int64)FWebRemoteControlBufferPool::MaxFreeBuffersPerSizeClass);
+
+			for (TArray<uint8>& PooledBuffer : Buffers)
+			{
+				const int32 AcquiredCapacity = PooledBuffer.Max();
+				FWebRemoteControlBufferPool::Release(MoveTemp(PooledBuffer), AcquiredCapacity);
+			}
+		}
+
+		// 5. The free buffers of a thread never exceed the idle byte cap.
+		{
+			constexpr int32 LargeCapacity = 4 * 1024 * 1024;
+			const int32 NumLargeBuffers = static_cast<int32>(FWebRemoteControlBufferPool::MaxIdleBytesPerThread / LargeCapacity) + 1;
+
+			TArray<TArray<uint8>> Buffers;
+			for (int32 Index = 0; Index < NumLargeBuffers; ++Index)
+			{
+				Buffers.Add(FWebRemoteControlBufferPool::Acquire(LargeCapacity));
+			}
+
+			const int64 IdleBytesBefore = GetMetric(Metrics.PooledBufferIdleBytes);
+			int64 ReleasedBytes = 0;
+			for (TArray<uint8>& PooledBuffer : Buffers)
+			{
+				const int32 AcquiredCapacity = PooledBuffer.Max();
+				ReleasedBytes += AcquiredCapacity;
+				FWebRemoteControlBufferPool::Release(MoveTemp(PooledBuffer), AcquiredCapacity);
+			}
+
+			TestTrue(TEXT("Buffers released past the idle byte cap are freed"), GetMetric(Metrics.PooledBufferIdleBytes) - IdleBytesBefore < ReleasedBytes);
+			TestTrue(TEXT("Idle bytes stay within the cap"), GetMetric(Metrics.PooledBufferIdleBytes) - InitialIdleBytes <= FWebRemoteControlBufferPool::MaxIdleBytesPerThread);
+		}
+
+		// 6. Buffers larger than the largest size class aren't pooled.
+		{
+			const int64 IdleBytesBefore = GetMetric(Metrics.PooledBufferIdleBytes);
+			const int32 HugeCapacity = 2 << FWebRemoteControlBufferPool::MaxSizeClassBits;
+			Buffer = FWebRemoteControlBufferPool::Acquire(HugeCapacity);
+			const int32 AcquiredCapacity = Buffer.Max();
+			TestTrue(TEXT("Huge buffers still have the requested capacity"), AcquiredCapacity >= HugeCapacity);
+			FWebRemoteControlBufferPool::Release(MoveTemp(Buffer), AcquiredCapacity);
+			TestEqual(TEXT("Huge buffers are freed on release"), GetMetric(Metrics.PooledBufferIdleBytes), IdleBytesBefore);
+		}
+
+		// 7. Size hints acquire buffers large enough for the last payload of their call site.
+		{
+			FWebRemoteControlBufferSizeHint SizeHint;
+			{
+				FWebRemoteControlPooledBuffer PooledBuffer(SizeHint);
+				PooledBuffer.Get().AddZeroed(3000);
+			}
+			TestEqual(TEXT("The size hint records the payload size"), SizeHint.LastSize.load(), 3000);
+
+			FWebRemoteControlPooledBuffer PooledBuffer(SizeHint);
+			TestTrue(TEXT("The next buffer fits the last payload"), PooledBuffer.Get().Max() >= 3000);
+		}
+
+		TestEqual(TEXT("Every acquired byte was released"), GetMetric(Metrics.PooledBufferBytesInUse), InitialBytesInUse);
+	}).Wait();
+
+	return true;
+}
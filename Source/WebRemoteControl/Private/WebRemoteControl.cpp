@@ -14,8 +14,10 @@
 #include "RemoteControlSettings.h"
 #include "RemoteControlPreset.h"
 #include "RemoteControlWebsocketRoute.h"
+#include "WebRemoteControlBufferPool.h"
 #include "WebRemoteControlInternalUtils.h"
-#include "WebRemoteControlExternalLogger.h"
+#include "WebRemoteControlMetrics.h"
+#include "WebRemoteControlRequestLog.h"
 #include "WebRemoteControlUtils.h"
 #include "WebSocketMessageHandler.h"
 
@@ -59,6 +61,8 @@
 // Miscelleanous
 #include "Blueprint/BlueprintSupport.h"
 #include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "Misc/StringBuilder.h"
 #include "Misc/WildcardString.h"
 #include "UObject/UnrealType.h"
 #include "Templates/UnrealTemplate.h"
@@ -218,6 +222,28 @@ namespace WebRemoteControl
 
 		return IRemoteControlModule::Get().ResolvePreset(*PresetNameOrId);
 	}
+
+	void GetPresetAsync(const FString& PresetNameOrId, FOnPresetResolved OnResolved)
+	{
+		FGuid Id;
+		if (FGuid::ParseExact(PresetNameOrId, EGuidFormats::Digits, Id))
+		{
+			IRemoteControlModule::Get().ResolvePresetAsync(Id, FOnPresetResolved::CreateLambda([PresetNameOrId, OnResolved](URemoteControlPreset* ResolvedPreset)
+			{
+				if (ResolvedPreset)
+				{
+					OnResolved.ExecuteIfBound(ResolvedPreset);
+				}
+				else
+				{
+					IRemoteControlModule::Get().ResolvePresetAsync(*PresetNameOrId, OnResolved);
+				}
+			}));
+			return;
+		}
+
+		IRemoteControlModule::Get().ResolvePresetAsync(*PresetNameOrId, MoveTemp(OnResolved));
+	}
 	
 	bool IsWebControlEnabledInEditor()
 	{
@@ -231,11 +257,12 @@ namespace WebRemoteControl
 		return bIsEditor || FParse::Param(FCommandLine::Get(), TEXT("RCWebControlEnable"));
 	}
 
-	void DoNativeClassBlueprintFilter(const FSearchAssetRequest& SearchAssetRequest, TArray<FAssetData>& OutFilteredAssets)
+	/** Resolve the native parent classes requested by a search's blueprint filter. */
+	TSet<UClass*> GetNativeClassBlueprintFilterClasses(const FSearchAssetRequest& SearchAssetRequest)
 	{
+		TSet<UClass*> NativeClasses;
 		if (SearchAssetRequest.Filter.EnableBlueprintNativeClassFiltering && SearchAssetRequest.Filter.NativeParentClasses.Num() > 0)
 		{
-			TSet<UClass*> NativeClasses;
 			NativeClasses.Reserve(SearchAssetRequest.Filter.NativeParentClasses.Num());
 			for (FName NativeClassName : SearchAssetRequest.Filter.NativeParentClasses)
 			{
@@ -244,29 +271,46 @@ namespace WebRemoteControl
 					NativeClasses.Add(Class);
 				}
 			}
+		}
+		return NativeClasses;
+	}
 
-			for (auto It = OutFilteredAssets.CreateIterator(); It; ++It)
+	/** Whether an asset passes the blueprint native class filter of a search. */
+	bool PassesNativeClassBlueprintFilter(const FSearchAssetRequest& SearchAssetRequest, const TSet<UClass*>& NativeClasses, const FAssetData& AssetData)
+	{
+		if (!SearchAssetRequest.Filter.EnableBlueprintNativeClassFiltering || SearchAssetRequest.Filter.NativeParentClasses.Num() == 0)
+		{
+			return true;
+		}
+
+		const FString NativeParentClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
+		const FSoftClassPath ClassPath(NativeParentClassPath);
+		UClass* NativeParentClass = ClassPath.ResolveClass();
+		if (!NativeParentClass)
+		{
+			return false;
+		}
+
+		for (UClass* ClassFilter : NativeClasses)
+		{
+			if (!NativeParentClass->IsChildOf(ClassFilter))
 			{
-				const FAssetData& AssetData = *It;
-				const FString NativeParentClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
-				const FSoftClassPath ClassPath(NativeParentClassPath);
-				UClass* NativeParentClass = ClassPath.ResolveClass();
-				if (NativeParentClass)
-				{
-					for (UClass* ClassFilter : NativeClasses)
-					{
-						if (!NativeParentClass->IsChildOf(ClassFilter))
-						{
-							It.RemoveCurrent();
-						}
-					}
-				}
-				else
-				{
-					It.RemoveCurrent();
-				}
+				return false;
 			}
 		}
+		return true;
+	}
+
+	void DoNativeClassBlueprintFilter(const FSearchAssetRequest& SearchAssetRequest, TArray<FAssetData>& OutFilteredAssets)
+	{
+		if (SearchAssetRequest.Filter.EnableBlueprintNativeClassFiltering && SearchAssetRequest.Filter.NativeParentClasses.Num() > 0)
+		{
+			const TSet<UClass*> NativeClasses = GetNativeClassBlueprintFilterClasses(SearchAssetRequest);
+			OutFilteredAssets.RemoveAll([&SearchAssetRequest, &NativeClasses](const FAssetData& AssetData)
+			{
+				return !PassesNativeClassBlueprintFilter(SearchAssetRequest, NativeClasses, AssetData);
+			});
+		}
 	}
 
 	/**
@@ -353,7 +397,12 @@ void FWebRemoteControlModule::StartupModule()
 	WebSocketServerPort = GetDefault<URemoteControlSettings>()->RemoteControlWebSocketServerPort;
 	WebsocketServerBindAddress = GetDefault<URemoteControlSettings>()->RemoteControlWebsocketServerBindAddress;
 
-	WebSocketHandler = MakeUnique<FWebSocketMessageHandler>(&WebSocketServer, ActingClientId);
+	WebSocketHandler = MakeShared<FWebSocketMessageHandler>(&WebSocketServer, ActingClientId);
+
+	if (!RequestLog)
+	{
+		RequestLog = MakeUnique<FWebRemoteControlRequestLog>();
+	}
 
 	RegisterConsoleCommands();
 	RegisterRoutes();
@@ -393,6 +442,9 @@ void FWebRemoteControlModule::ShutdownModule()
 	StopHttpServer();
 	StopWebSocketServer();
 	UnregisterConsoleCommands();
+	AssetSearchIndex.Reset();
+	ActorSearchIndex.Reset();
+	RequestLog.Reset();
 
 #if WITH_EDITOR
 	UnregisterSettings();
@@ -461,7 +513,7 @@ void FWebRemoteControlModule::RegisterWebsocketRoute(const FRemoteControlWebsock
 
 	if (WebSocketRouter)
 	{
-		WebSocketRouter->BindRoute(Route.MessageName, Route.Delegate);
+		WebSocketRouter->BindRoute(Route.MessageName, MakeMeasuredWebSocketDelegate(Route));
 	}
 }
 
@@ -553,7 +605,7 @@ void FWebRemoteControlModule::StartWebSocketServer()
 
 		for (FRemoteControlWebsocketRoute& Route : RegisteredWebSocketRoutes)
 		{
-			WebSocketRouter->BindRoute(Route.MessageName, Route.Delegate);
+			WebSocketRouter->BindRoute(Route.MessageName, MakeMeasuredWebSocketDelegate(Route));
 		}
 	}
 }
@@ -566,18 +618,108 @@ void FWebRemoteControlModule::StopWebSocketServer()
 
 void FWebRemoteControlModule::SetExternalRemoteWebSocketLoggerConnection(TSharedPtr<INetworkingWebSocket> WebSocketLoggerConnection)
 {
-	ExternalLogger.Reset();
-	
-	if (WebSocketLoggerConnection.IsValid())
+	if (!RequestLog)
 	{
-		ExternalLogger = MakeUnique<FWebRemoteControlExternalLogger>(WebSocketLoggerConnection);
+		RequestLog = MakeUnique<FWebRemoteControlRequestLog>();
 	}
+
+	RequestLog->SetWebSocketConnection(MoveTemp(WebSocketLoggerConnection));
 }
 
 void FWebRemoteControlModule::StartRoute(const FRemoteControlRoute& Route)
 {
+	FHttpRequestHandler Handler = Route.Handler;
+
+	// Routes referencing a preset wait for it to be streamed in instead of loading it synchronously on the game thread.
+	if (Route.Path.GetPath().Contains(TEXT(":preset")))
+	{
+		Handler = FHttpRequestHandler::CreateLambda([this, RouteHandler = Route.Handler](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+		{
+			return HandleDeferredPresetRoute(Request, OnComplete, RouteHandler);
+		});
+	}
+
+	// Measure the whole handling of the request, including the time spent waiting for deferred responses.
+	const FString RouteName = FString::Printf(TEXT("%s %s"), *RemotePayloadSerializer::GetHttpVerbName(Route.Verb).ToString(), *Route.Path.GetPath());
+	FWebRemoteControlMetrics::FRouteMetrics* RouteMetrics = &FWebRemoteControlMetrics::Get().FindOrAddHttpRoute(RouteName);
+	Handler = FHttpRequestHandler::CreateLambda([RouteMetrics, RouteHandler = MoveTemp(Handler)](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const int32 RequestSize = Request.Body.Num();
+
+		return RouteHandler.Execute(Request, [RouteMetrics, StartCycles, RequestSize, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+		{
+			RouteMetrics->Requests.fetch_add(1, std::memory_order_relaxed);
+			RouteMetrics->Latency.Record(static_cast<uint64>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0));
+			RouteMetrics->RequestSize.Record(RequestSize);
+			if (Response)
+			{
+				RouteMetrics->ResponseSize.Record(Response->Body.Num());
+				if (static_cast<int32>(Response->Code) >= 400)
+				{
+					RouteMetrics->Errors.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+
+			OnComplete(MoveTemp(Response));
+		});
+	});
+
 	// The handler is wrapped in a lambda since HttpRouter::BindRoute only accepts TFunctions
-	ActiveRouteHandles.Add(GetTypeHash(Route), HttpRouter->BindRoute(Route.Path, Route.Verb, Route.Handler));
+	ActiveRouteHandles.Add(GetTypeHash(Route), HttpRouter->BindRoute(Route.Path, Route.Verb, Handler));
+}
+
+FWebSocketMessageDelegate FWebRemoteControlModule::MakeMeasuredWebSocketDelegate(const FRemoteControlWebsocketRoute& Route)
+{
+	FWebRemoteControlMetrics::FRouteMetrics* RouteMetrics = &FWebRemoteControlMetrics::Get().FindOrAddWebSocketRoute(Route.MessageName);
+	return FWebSocketMessageDelegate::CreateLambda([RouteMetrics, RouteDelegate = Route.Delegate](const FRemoteControlWebSocketMessage& Message)
+	{
+		RouteMetrics->Requests.fetch_add(1, std::memory_order_relaxed);
+		RouteMetrics->RequestSize.Record(Message.RequestPayload.Num());
+
+		FRCMetricsScopedTimer LatencyTimer(RouteMetrics->Latency);
+		RouteDelegate.ExecuteIfBound(Message);
+	});
+}
+
+bool FWebRemoteControlModule::HandleDeferredPresetRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete, FHttpRequestHandler Handler)
+{
+	const FString* PresetNameOrId = Request.PathParams.Find(TEXT("preset"));
+	if (!PresetNameOrId || bIsInvokingWrappedRequest)
+	{
+		return Handler.Execute(Request, OnComplete);
+	}
+
+	struct FDeferredDispatch
+	{
+		/** Whether the preset was resolved before GetPresetAsync returned, ie. it was already loaded. */
+		bool bResolvedSynchronously = false;
+
+		/** Copy of the request, only made once a load is pending since the request is only alive for the duration of this call. */
+		TUniquePtr<FHttpServerRequest> Request;
+	};
+
+	// The handler resolves the preset again, which no longer requires a load. It also takes care of reporting missing presets.
+	TSharedRef<FDeferredDispatch> DeferredDispatch = MakeShared<FDeferredDispatch>();
+	WebRemoteControl::GetPresetAsync(*PresetNameOrId, FOnPresetResolved::CreateLambda([Handler, DeferredDispatch, OnComplete](URemoteControlPreset*)
+	{
+		if (DeferredDispatch->Request)
+		{
+			Handler.ExecuteIfBound(*DeferredDispatch->Request, OnComplete);
+		}
+		else
+		{
+			DeferredDispatch->bResolvedSynchronously = true;
+		}
+	}));
+
+	if (DeferredDispatch->bResolvedSynchronously)
+	{
+		return Handler.Execute(Request, OnComplete);
+	}
+
+	DeferredDispatch->Request = MakeUnique<FHttpServerRequest>(Request);
+	return true;
 }
 
 void FWebRemoteControlModule::RegisterRoutes()
@@ -655,6 +797,27 @@ void FWebRemoteControlModule::RegisterRoutes()
 		FHttpRequestHandler::CreateRaw(this, &FWebRemoteControlModule::HandlePassphraseRoute)
 		});
 
+	RegisterRoute({
+		TEXT("Get the server's performance metrics in the Prometheus text format."),
+		FHttpPath(TEXT("/remote/metrics")),
+		EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateRaw(this, &FWebRemoteControlModule::HandleMetricsRoute)
+		});
+
+	RegisterRoute({
+		TEXT("Create a session token that can be sent instead of the passphrase until it expires."),
+		FHttpPath(TEXT("/remote/session")),
+		EHttpServerRequestVerbs::VERB_PUT,
+		FHttpRequestHandler::CreateRaw(this, &FWebRemoteControlModule::HandleCreateSessionRoute)
+		});
+
+	RegisterRoute({
+		TEXT("Revoke the session token sent with the request."),
+		FHttpPath(TEXT("/remote/session")),
+		EHttpServerRequestVerbs::VERB_DELETE,
+		FHttpRequestHandler::CreateRaw(this, &FWebRemoteControlModule::HandleDeleteSessionRoute)
+		});
+
 	// Preset API
 	RegisterRoute({
 		TEXT("Get a remote control preset's content."),
@@ -741,6 +904,13 @@ void FWebRemoteControlModule::RegisterRoutes()
 		FHttpRequestHandler::CreateRaw(this, &FWebRemoteControlModule::HandleSearchAssetRoute)
 		});
 
+	RegisterRoute({
+		TEXT("Search for actors in the current world"),
+		FHttpPath(TEXT("/remote/search/actor")),
+		EHttpServerRequestVerbs::VERB_PUT,
+		FHttpRequestHandler::CreateRaw(this, &FWebRemoteControlModule::HandleSearchActorRoute)
+		});
+
 	// Metadata
 	RegisterRoute({
 		TEXT("Get a preset's metadata"),
@@ -871,6 +1041,72 @@ void FWebRemoteControlModule::RegisterConsoleCommands()
 		TEXT("Stop the WebSocket remote control web server"),
 		FConsoleCommandDelegate::CreateRaw(this, &FWebRemoteControlModule::StopWebSocketServer)
 		));
+
+	ConsoleCommands.Add(MakeUnique<FAutoConsoleCommand>(
+		TEXT("WebControl.Metrics.Dump"),
+		TEXT("Print the Web Remote Control performance metrics to the log."),
+		FConsoleCommandDelegate::CreateRaw(this, &FWebRemoteControlModule::DumpMetrics)
+		));
+
+	ConsoleCommands.Add(MakeUnique<FAutoConsoleCommand>(
+		TEXT("WebControl.Metrics.Reset"),
+		TEXT("Discard the recorded Web Remote Control performance metrics."),
+		FConsoleCommandDelegate::CreateLambda([]() { FWebRemoteControlMetrics::Get().Reset(); })
+		));
+
+	ConsoleCommands.Add(MakeUnique<FAutoConsoleCommand>(
+		TEXT("WebControl.RequestLog.StartFile"),
+		TEXT("Write the request log to a file, starting with the requests still held in memory. Usage: WebControl.RequestLog.StartFile [Filename]"),
+		FConsoleCommandWithArgsDelegate::CreateRaw(this, &FWebRemoteControlModule::StartRequestLogFile)
+		));
+
+	ConsoleCommands.Add(MakeUnique<FAutoConsoleCommand>(
+		TEXT("WebControl.RequestLog.StopFile"),
+		TEXT("Stop writing the request log to a file."),
+		FConsoleCommandDelegate::CreateRaw(this, &FWebRemoteControlModule::StopRequestLogFile)
+		));
+}
+
+void FWebRemoteControlModule::DumpMetrics()
+{
+	TStringBuilder<4096> MetricsText;
+	FWebRemoteControlMetrics::Get().WritePrometheus(MetricsText);
+
+	TArray<FString> Lines;
+	FString(MetricsText.ToView()).ParseIntoArrayLines(Lines);
+	for (const FString& Line : Lines)
+	{
+		if (!Line.StartsWith(TEXT("#")))
+		{
+			UE_LOG(LogRemoteControl, Display, TEXT("%s"), *Line);
+		}
+	}
+}
+
+void FWebRemoteControlModule::StartRequestLogFile(const TArray<FString>& Args)
+{
+	if (!RequestLog)
+	{
+		return;
+	}
+
+	const FString Filename = Args.Num() ? Args[0] : FPaths::ProjectLogDir() / FString::Printf(TEXT("WebRemoteControlRequests-%s.rcrl"), *FDateTime::Now().ToString());
+	if (RequestLog->StartFile(Filename))
+	{
+		UE_LOG(LogRemoteControl, Display, TEXT("Writing the Web Remote Control request log to %s"), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogRemoteControl, Error, TEXT("Could not open %s to write the Web Remote Control request log."), *Filename);
+	}
+}
+
+void FWebRemoteControlModule::StopRequestLogFile()
+{
+	if (RequestLog)
+	{
+		RequestLog->StopFile();
+	}
 }
 
 void FWebRemoteControlModule::UnregisterConsoleCommands()
@@ -978,15 +1214,15 @@ bool FWebRemoteControlModule::HandleObjectCallRoute(const FHttpServerRequest& Re
 
 	IRemoteControlModule::Get().InvokeCall(Call);
 
-	TArray<uint8> WorkingBuffer;
-	WorkingBuffer.Empty();
-	if (!RemotePayloadSerializer::SerializeCall(Call, WorkingBuffer, true))
+	static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+	FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+	if (!RemotePayloadSerializer::SerializeCall(Call, WorkingBuffer.Get(), true))
 	{
 		Response->Code = EHttpServerResponseCodes::ServerError;
 	}
 	else
 	{
-		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Response->Body);
+		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Response->Body);
 		Response->Code = EHttpServerResponseCodes::Ok;
 	}
 
@@ -1009,13 +1245,14 @@ bool FWebRemoteControlModule::HandleObjectPropertyRoute(const FHttpServerRequest
 	{
 	case ERCAccess::READ_ACCESS:
 	{
-		TArray<uint8> WorkingBuffer;
-		FMemoryWriter Writer(WorkingBuffer);
+		static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+		FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+		FMemoryWriter Writer(WorkingBuffer.Get());
 		FRCJsonStructSerializerBackend SerializerBackend(Writer);
 		if (IRemoteControlModule::Get().GetObjectProperties(ObjectRef, SerializerBackend))
 		{
 			Response->Code = EHttpServerResponseCodes::Ok;
-			WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Response->Body);
+			WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Response->Body);
 		}
 	}
 	break;
@@ -1169,8 +1406,9 @@ bool FWebRemoteControlModule::HandlePresetCallFunctionRoute(const FHttpServerReq
 	FBlockDelimiters Delimiters = CallRequest.GetParameterDelimiters(FRCPresetCallRequest::ParametersLabel());
 	const int64 DelimitersSize = Delimiters.GetBlockSize();
 
-	TArray<uint8> OutputBuffer;
-	FMemoryWriter Writer{ OutputBuffer };
+	static FWebRemoteControlBufferSizeHint OutputBufferSizeHint;
+	FWebRemoteControlPooledBuffer OutputBuffer(OutputBufferSizeHint);
+	FMemoryWriter Writer{ OutputBuffer.Get() };
 	TSharedPtr<TJsonWriter<UCS2CHAR>> JsonWriter = TJsonWriter<UCS2CHAR>::Create(&Writer);
 	FRCJsonStructSerializerBackend WriterBackend{ Writer };
 
@@ -1260,7 +1498,7 @@ bool FWebRemoteControlModule::HandlePresetCallFunctionRoute(const FHttpServerReq
 	if (bSuccess)
 	{
 		Response->Code = EHttpServerResponseCodes::Ok;
-		WebRemoteControlUtils::ConvertToUTF8(OutputBuffer, Response->Body);
+		WebRemoteControlUtils::ConvertToUTF8(OutputBuffer.Get(), Response->Body);
 	}
 	else
 	{
@@ -1401,12 +1639,13 @@ bool FWebRemoteControlModule::HandlePresetGetPropertyRoute(const FHttpServerRequ
 			Controller->CopyCompleteValue(TargetValueProp, DestPtr);
 
 			// Serialize to JSON
-			TArray<uint8> JsonBuffer;
-			FMemoryWriter Writer(JsonBuffer);
+			static FWebRemoteControlBufferSizeHint JsonBufferSizeHint;
+			FWebRemoteControlPooledBuffer JsonBuffer(JsonBufferSizeHint);
+			FMemoryWriter Writer(JsonBuffer.Get());
 			WebRemoteControlInternalUtils::SerializeStructOnScope(Result, Writer);
 
 			// Finalize HTTP Response
-			WebRemoteControlUtils::ConvertToUTF8(JsonBuffer, Response->Body);
+			WebRemoteControlUtils::ConvertToUTF8(JsonBuffer.Get(), Response->Body);
 			Response->Code = EHttpServerResponseCodes::Ok;
 
 			OnComplete(MoveTemp(Response));
@@ -1428,8 +1667,9 @@ bool FWebRemoteControlModule::HandlePresetGetPropertyRoute(const FHttpServerRequ
 		return true;
 	}
 
-	TArray<uint8> WorkingBuffer;
-	FMemoryWriter Writer(WorkingBuffer);
+	static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+	FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+	FMemoryWriter Writer(WorkingBuffer.Get());
 
 	FRCObjectReference ObjectRef;
 	FString Error;
@@ -1443,7 +1683,7 @@ bool FWebRemoteControlModule::HandlePresetGetPropertyRoute(const FHttpServerRequ
 		WebRemoteControlInternalUtils::SerializeStructOnScope(FinalStruct, Writer);
 
 		Response->Code = EHttpServerResponseCodes::Ok;
-		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Response->Body);
+		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Response->Body);
 	}
 	else
 	{
@@ -1510,15 +1750,16 @@ bool FWebRemoteControlModule::HandlePresetExposePropertyRoute(const FHttpServerR
 
 	if (ExposedProperty.IsValid())
 	{
-		TArray<uint8> WorkingBuffer;
-		FMemoryWriter Writer(WorkingBuffer);
+		static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+		FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+		FMemoryWriter Writer(WorkingBuffer.Get());
 
 		FStructOnScope PropertyValueOnScope = WebRemoteControlStructUtils::CreatePropertyValueOnScope(ExposedProperty, ObjectRef);
 		FStructOnScope FinalStruct = WebRemoteControlStructUtils::CreateGetPropertyOnScope(ExposedProperty, ObjectRef, MoveTemp(PropertyValueOnScope));
 		WebRemoteControlInternalUtils::SerializeStructOnScope(FinalStruct, Writer);
 
 		Response->Code = EHttpServerResponseCodes::Ok;
-		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Response->Body);
+		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Response->Body);
 	}
 	else
 	{
@@ -1587,8 +1828,9 @@ bool FWebRemoteControlModule::HandlePresetGetExposedActorPropertyRoute(const FHt
 	{
 		if (AActor* Actor = RCActor->GetActor())
 		{
-			TArray<uint8> WorkingBuffer;
-			FMemoryWriter Writer(WorkingBuffer);
+			static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+			FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+			FMemoryWriter Writer(WorkingBuffer.Get());
 
 			FRCObjectReference ObjectRef;
 			FString Error;
@@ -1599,7 +1841,7 @@ bool FWebRemoteControlModule::HandlePresetGetExposedActorPropertyRoute(const FHt
 				WebRemoteControlInternalUtils::SerializeStructOnScope(ActorPropertyOnScope, Writer);
 			
 				Response->Code = EHttpServerResponseCodes::Ok;
-				WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Response->Body);
+				WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Response->Body);
 			}
 			else
 			{
@@ -1634,14 +1876,15 @@ bool FWebRemoteControlModule::HandlePresetGetExposedActorPropertiesRoute(const F
 	{
 		if (AActor* Actor = RCActor->GetActor())
 		{
-			TArray<uint8> WorkingBuffer;
-			FMemoryWriter Writer(WorkingBuffer);
+			static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+			FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+			FMemoryWriter Writer(WorkingBuffer.Get());
 			FRCJsonStructSerializerBackend Backend{Writer};
 
 			FRCObjectReference Ref{ ERCAccess::READ_ACCESS, Actor};
 			if (IRemoteControlModule::Get().GetObjectProperties(Ref, Backend))
 			{
-				WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Response->Body);
+				WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Response->Body);
 				Response->Code = EHttpServerResponseCodes::Ok;
 			}
 			else
@@ -1843,11 +2086,108 @@ bool FWebRemoteControlModule::HandlePassphraseRoute(const FHttpServerRequest& Re
 	return true;
 }
 
+bool FWebRemoteControlModule::HandleMetricsRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse(EHttpServerResponseCodes::Ok);
+	WebRemoteControlInternalUtils::AddContentTypeHeaders(Response.Get(), TEXT("text/plain; version=0.0.4"));
+
+	TStringBuilder<4096> MetricsText;
+	FWebRemoteControlMetrics::Get().WritePrometheus(MetricsText);
+	WebRemoteControlUtils::ConvertToUTF8(FString(MetricsText.ToView()), Response->Body);
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool FWebRemoteControlModule::HandleCreateSessionRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse();
+
+	FString Passphrase;
+	if (const TArray<FString>* PassphraseHeader = Request.Headers.Find(WebRemoteControlInternalUtils::PassphraseHeader))
+	{
+		if (PassphraseHeader->Num())
+		{
+			Passphrase = PassphraseHeader->Last();
+		}
+	}
+
+	// A client holding a valid token can also use it to get a new one before it expires.
+	if (WebRemoteControlInternalUtils::HasValidSessionToken(Request) || WebRemoteControlInternalUtils::CheckPassphrase(Passphrase))
+	{
+		int32 LifetimeSeconds = 0;
+		FString SessionToken = WebRemoteControlInternalUtils::CreateSessionToken(LifetimeSeconds);
+		if (SessionToken.IsEmpty())
+		{
+			WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(TEXT("Unable to generate a session token."), Response->Body);
+			Response->Code = EHttpServerResponseCodes::ServerError;
+		}
+		else
+		{
+			WebRemoteControlUtils::SerializeMessage(FCreateSessionResponse{ MoveTemp(SessionToken), LifetimeSeconds }, Response->Body);
+			Response->Code = EHttpServerResponseCodes::Ok;
+		}
+	}
+	else
+	{
+		WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(WebRemoteControlInternalUtils::InvalidPassphraseError, Response->Body);
+		Response->Code = EHttpServerResponseCodes::Denied;
+	}
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool FWebRemoteControlModule::HandleDeleteSessionRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse();
+
+	const TArray<FString>* SessionTokenHeader = Request.Headers.Find(WebRemoteControlInternalUtils::SessionTokenHeader);
+	if (SessionTokenHeader && SessionTokenHeader->Num())
+	{
+		WebRemoteControlInternalUtils::RevokeSessionToken(SessionTokenHeader->Last());
+		Response->Code = EHttpServerResponseCodes::Ok;
+	}
+	else
+	{
+		WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(FString::Printf(TEXT("Missing %s header."), WebRemoteControlInternalUtils::SessionTokenHeader), Response->Body);
+		Response->Code = EHttpServerResponseCodes::BadRequest;
+	}
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
 
 bool FWebRemoteControlModule::HandleSearchActorRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse(EHttpServerResponseCodes::NotSupported);
-	WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(TEXT("Route not implemented."), Response->Body);
+	TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse();
+	FSearchActorRequest SearchActorRequest;
+	if (!WebRemoteControlInternalUtils::DeserializeRequest(Request, &OnComplete, SearchActorRequest))
+	{
+		return true;
+	}
+
+	UWorld* World = URemoteControlPreset::GetWorld(nullptr, SearchActorRequest.AllowPIE);
+	if (!World)
+	{
+		WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(TEXT("Could not find a world to search."), Response->Body);
+		Response->Code = EHttpServerResponseCodes::NotFound;
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	if (!ActorSearchIndex)
+	{
+		ActorSearchIndex = MakeUnique<FWebRemoteControlActorSearchIndex>();
+	}
+
+	TArray<AActor*> Actors;
+	const int32 TotalCount = ActorSearchIndex->Search(World, SearchActorRequest, Actors);
+
+	WebRemoteControlUtils::SerializeMessage(FSearchActorResponse{ Actors, TotalCount }, Response->Body);
+	Response->Code = EHttpServerResponseCodes::Ok;
+
 	OnComplete(MoveTemp(Response));
 	return true;
 }
@@ -1865,40 +2205,43 @@ bool FWebRemoteControlModule::HandleSearchAssetRoute(const FHttpServerRequest& R
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
 	FARFilter Filter = SearchAssetRequest.Filter.ToARFilter();
+	TArray<FAssetData> FilteredAssets;
+	int32 TotalCount = 0;
 
-	TArray<FAssetData> Assets;
-	AssetRegistryModule.Get().GetAssets(Filter, Assets);
-
-	//Do advanced blueprint filtering if required
-	WebRemoteControl::DoNativeClassBlueprintFilter(SearchAssetRequest, Assets);
-
-	TArrayView<FAssetData> AssetsView{Assets};
-	int32 ArrayEnd = FMath::Min(SearchAssetRequest.Limit, Assets.Num());
+	if (SearchAssetRequest.Query.IsEmpty())
+	{
+		// Without a query there is nothing to rank, the registry filter alone selects the assets.
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssets(Filter, Assets);
 
-	TArray<FAssetData> FilteredAssets;
-	FilteredAssets.Reserve(SearchAssetRequest.Limit);
+		//Do advanced blueprint filtering if required
+		WebRemoteControl::DoNativeClassBlueprintFilter(SearchAssetRequest, Assets);
 
-	for (const FAssetData& AssetData : Assets)
-	{	
-		if (!SearchAssetRequest.Query.IsEmpty())
-		{
-			if (AssetData.AssetName.ToString().Contains(*SearchAssetRequest.Query))
-			{
-				FilteredAssets.Add(AssetData);
-			}
-		}
-		else
+		TotalCount = Assets.Num();
+		const int32 Offset = FMath::Clamp(SearchAssetRequest.Offset, 0, Assets.Num());
+		const int32 Count = FMath::Clamp(SearchAssetRequest.Limit, 0, Assets.Num() - Offset);
+		FilteredAssets.Append(Assets.GetData() + Offset, Count);
+	}
+	else
+	{
+		if (!AssetSearchIndex)
 		{
-			FilteredAssets.Add(AssetData);
+			AssetSearchIndex = MakeUnique<FWebRemoteControlAssetSearchIndex>();
 		}
 
-		if (FilteredAssets.Num() >= SearchAssetRequest.Limit)
-		{
-			break;
-		}
+		FARCompiledFilter CompiledFilter;
+		AssetRegistry.CompileFilter(Filter, CompiledFilter);
+
+		const TSet<UClass*> NativeClasses = WebRemoteControl::GetNativeClassBlueprintFilterClasses(SearchAssetRequest);
+		TotalCount = AssetSearchIndex->Search(SearchAssetRequest.Query, SearchAssetRequest.Mode, CompiledFilter,
+			[&SearchAssetRequest, &NativeClasses](const FAssetData& AssetData)
+			{
+				return WebRemoteControl::PassesNativeClassBlueprintFilter(SearchAssetRequest, NativeClasses, AssetData);
+			},
+			SearchAssetRequest.Offset, SearchAssetRequest.Limit, FilteredAssets);
 	}
 
-	WebRemoteControlUtils::SerializeMessage(FSearchAssetResponse{ MoveTemp(FilteredAssets) }, Response->Body);
+	WebRemoteControlUtils::SerializeMessage(FSearchAssetResponse{ FilteredAssets, TotalCount }, Response->Body);
 	Response->Code = EHttpServerResponseCodes::Ok;
 
 	OnComplete(MoveTemp(Response));
@@ -2338,12 +2681,13 @@ bool FWebRemoteControlModule::HandlePresetGetControllerRoute(const FHttpServerRe
 	Controller->CopyCompleteValue(TargetValueProp, DestPtr);
 
 	// 7. Serialize to JSON
-	TArray<uint8> JsonBuffer;
-	FMemoryWriter Writer(JsonBuffer);
+	static FWebRemoteControlBufferSizeHint JsonBufferSizeHint;
+	FWebRemoteControlPooledBuffer JsonBuffer(JsonBufferSizeHint);
+	FMemoryWriter Writer(JsonBuffer.Get());
 	WebRemoteControlInternalUtils::SerializeStructOnScope(Result, Writer);
 
 	// 8. Finalize HTTP Response
-	WebRemoteControlUtils::ConvertToUTF8(JsonBuffer, Response->Body);
+	WebRemoteControlUtils::ConvertToUTF8(JsonBuffer.Get(), Response->Body);
 	Response->Code = EHttpServerResponseCodes::Ok;
 
 	OnComplete(MoveTemp(Response));
@@ -2376,15 +2720,31 @@ void FWebRemoteControlModule::HandleWebSocketHttpMessage(const FRemoteControlWeb
 		Wrapper.Passphrase = WebSocketMessage.Header[WebRemoteControlInternalUtils::PassphraseHeader][0];
 	}
 
-	LogRequestExternally(Wrapper.RequestId, TEXT("UE Received"));
+	// Records are only formatted when the log is drained, so logging here is a few stores per stage.
+	const bool bLogRequest = RequestLog && RequestLog->ShouldLogRequest(WebSocketMessage.ClientId, Wrapper.RequestId);
+	const uint32 RouteId = bLogRequest ? RequestLog->GetRouteId(Wrapper.URL) : 0;
+	uint64 StageStartCycles = FPlatformTime::Cycles64();
+
+	auto LogRequestStage = [this, bLogRequest, RouteId, &WebSocketMessage, &Wrapper, &StageStartCycles](ERCRequestLogStage Stage, int32 PayloadSize)
+	{
+		if (bLogRequest)
+		{
+			const uint64 CurrentCycles = FPlatformTime::Cycles64();
+			const uint32 DurationMicroseconds = static_cast<uint32>(FMath::Min(FPlatformTime::ToMilliseconds64(CurrentCycles - StageStartCycles) * 1000.0, static_cast<double>(MAX_uint32)));
+			RequestLog->Log(Stage, RouteId, WebSocketMessage.ClientId, Wrapper.RequestId, DurationMicroseconds, PayloadSize);
+			StageStartCycles = CurrentCycles;
+		}
+	};
+
+	LogRequestStage(ERCRequestLogStage::Received, WebSocketMessage.RequestPayload.Num());
 	
 	FMemoryWriter Writer(UTF8Response);
 	InvokeWrappedRequest(Wrapper, Writer);
 
-	LogRequestExternally(Wrapper.RequestId, TEXT("UE Processed"));
+	LogRequestStage(ERCRequestLogStage::Processed, UTF8Response.Num());
 
 	WebSocketServer.Send(WebSocketMessage.ClientId, MoveTemp(UTF8Response));
-	LogRequestExternally(Wrapper.RequestId, TEXT("UE Sent"));
+	LogRequestStage(ERCRequestLogStage::Sent, 0);
 }
 
 void FWebRemoteControlModule::HandleWebSocketBatchMessage(const FRemoteControlWebSocketMessage& WebSocketMessage)
@@ -2422,6 +2782,7 @@ void FWebRemoteControlModule::HandleWebSocketBatchMessage(const FRemoteControlWe
 void FWebRemoteControlModule::InvokeWrappedRequest(const FRCRequestWrapper& Wrapper, FMemoryWriter& OutUTF8PayloadWriter, const FHttpServerRequest* TemplateRequest)
 {
 	TSharedRef<FHttpServerRequest> UnwrappedRequest = RemotePayloadSerializer::UnwrapHttpRequest(Wrapper, TemplateRequest);
+	TGuardValue<bool> WrappedRequestGuard(bIsInvokingWrappedRequest, true);
 
 	auto ResponseLambda = [this, &OutUTF8PayloadWriter, &Wrapper](TUniquePtr<FHttpServerResponse> Response) {
 		RemotePayloadSerializer::SerializeWrappedCallResponse(Wrapper.RequestId, MoveTemp(Response), OutUTF8PayloadWriter);
@@ -2439,10 +2800,29 @@ void FWebRemoteControlModule::RegisterDefaultPreprocessors()
 {
 	using namespace UE::WebRemoteControl;
 
-	auto MakeWebsocketPreDispatch = [this](FRCPreprocessorHandler PreprocessorHandler)
+	auto MakeWebsocketPreDispatch = [this](FRCPreprocessorHandler PreprocessorHandler, uint32 ValidationFlag)
 	{
-		return [this, PreprocessorHandler](const FRemoteControlWebSocketMessage& Message) -> bool
+		return [this, PreprocessorHandler, ValidationFlag](const FRemoteControlWebSocketMessage& Message) -> bool
 		{
+			// A connection is authenticated by the first message that passes a preprocessor, it only needs to be validated again when the settings change.
+			const uint32 ClientAccessVersion = GetDefault<URemoteControlSettings>()->GetClientAccessVersion();
+			FValidatedWebSocketClient& ValidatedClient = ValidatedWebSocketClients.FindOrAdd(Message.ClientId);
+			if (ValidatedClient.ClientAccessVersion != ClientAccessVersion)
+			{
+				ValidatedClient.ClientAccessVersion = ClientAccessVersion;
+				ValidatedClient.PassedPreprocessors = 0;
+			}
+			else if (!ValidatedClient.SessionToken.IsEmpty() && !WebRemoteControlInternalUtils::CheckSessionToken(ValidatedClient.SessionToken))
+			{
+				// The token the connection was authenticated with expired or was revoked, so the client has to authenticate again.
+				ValidatedClient.SessionToken.Reset();
+				ValidatedClient.PassedPreprocessors = 0;
+			}
+			else if (ValidatedClient.PassedPreprocessors & ValidationFlag)
+			{
+				return true;
+			}
+
 			FHttpServerRequest Request;
 			Request.Headers = Message.Header;
 			Request.PeerAddress = Message.PeerAddress;
@@ -2450,23 +2830,37 @@ void FWebRemoteControlModule::RegisterDefaultPreprocessors()
 			FPreprocessorResult Result = PreprocessorHandler(Request);
 			if (Result.Result == EPreprocessorResult::RequestPassthrough)
 			{
+				// The handler may have sent messages and invalidated the reference.
+				FValidatedWebSocketClient& PassedClient = ValidatedWebSocketClients.FindOrAdd(Message.ClientId);
+				PassedClient.PassedPreprocessors |= ValidationFlag;
+
+				// A connection authenticated by its session token only stays authenticated while that token is valid.
+				if (!Result.AcceptedSessionToken.IsEmpty())
+				{
+					PassedClient.SessionToken = MoveTemp(Result.AcceptedSessionToken);
+				}
 				return true;
 			}
 			else
 			{
-				TArray<uint8> Response;
-
-				const TArray<FString>* InPassphrase = Message.Header.Find(WebRemoteControlInternalUtils::PassphraseHeader);
-				const FString Passphrase = InPassphrase ? InPassphrase->Last() : FString("");
+				// The error body is already UTF-8 JSON, so it can be embedded in the response as is.
+				TAnsiStringBuilder<64> ResponseHeader;
+				ResponseHeader.Appendf("{\"RequestId\":%d,\"URL\":\"\",\"Verb\":\"401\",\"Body\":", Message.MessageId);
 
-				FRCRequestWrapper Wrapper;
-				Wrapper.RequestId = Message.MessageId;
-				Wrapper.Passphrase = Passphrase;
-				Wrapper.Verb = "401";
+				const TArray<uint8>& ErrorBody = Result.OptionalResponse->Body;
 
-				// Not ideal, we're re-converting to tchar, this should be removed once the WebRC pipeline is cleaned up.
-				WebRemoteControlUtils::ConvertToTCHAR(Result.OptionalResponse->Body, Wrapper.TCHARBody);
-				WebRemoteControlUtils::SerializeMessage(Wrapper, Response);
+				TArray<uint8> Response;
+				Response.Reserve(ResponseHeader.Len() + ErrorBody.Num() + 1);
+				Response.Append(reinterpret_cast<const uint8*>(ResponseHeader.GetData()), ResponseHeader.Len());
+				if (ErrorBody.Num())
+				{
+					Response.Append(ErrorBody);
+				}
+				else
+				{
+					Response.Append(reinterpret_cast<const uint8*>("{}"), 2);
+				}
+				Response.Add('}');
 
 				WebSocketServer.Send(Message.ClientId, MoveTemp(Response));
 
@@ -2475,7 +2869,8 @@ void FWebRemoteControlModule::RegisterDefaultPreprocessors()
 		};
 	};
 
-	auto RegisterInternalPreprocessor = [this, MakeWebsocketPreDispatch](FRCPreprocessorHandler PreprocessorHandler)
+	uint32 NextValidationFlag = 1;
+	auto RegisterInternalPreprocessor = [this, MakeWebsocketPreDispatch, &NextValidationFlag](FRCPreprocessorHandler PreprocessorHandler)
 	{
 		if (HttpRouter)
 		{
@@ -2484,13 +2879,18 @@ void FWebRemoteControlModule::RegisterDefaultPreprocessors()
 
 		if (WebSocketRouter)
 		{
-			WebSocketRouter->AddPreDispatch(MakeWebsocketPreDispatch(PreprocessorHandler));
+			WebSocketRouter->AddPreDispatch(MakeWebsocketPreDispatch(PreprocessorHandler, NextValidationFlag));
 		}
+
+		NextValidationFlag <<= 1;
 	};
 
 	RegisterInternalPreprocessor(&RemotePassphraseEnforcementPreprocessor);
 	RegisterInternalPreprocessor(&PassphrasePreprocessor);
 	RegisterInternalPreprocessor(&IPValidationPreprocessor);
+
+	WebSocketServer.OnConnectionClosed().RemoveAll(this);
+	WebSocketServer.OnConnectionClosed().AddRaw(this, &FWebRemoteControlModule::OnWebSocketConnectionClosed);
 }
 
 void FWebRemoteControlModule::UnregisterAllPreprocessors()
@@ -2504,6 +2904,11 @@ void FWebRemoteControlModule::UnregisterAllPreprocessors()
 	}
 }
 
+void FWebRemoteControlModule::OnWebSocketConnectionClosed(FGuid ClientId)
+{
+	ValidatedWebSocketClients.Remove(ClientId);
+}
+
 void FWebRemoteControlModule::RegisterExternalPreprocesors()
 {
 	if (HttpRouter)
@@ -2584,14 +2989,6 @@ void FWebRemoteControlModule::OnSettingsModified(UObject* Settings, FPropertyCha
 
 #endif
 
-void FWebRemoteControlModule::LogRequestExternally(int32 RequestId, const TCHAR* Stage)
-{
-	if (ExternalLogger.IsValid())
-	{
-		ExternalLogger->Log(RequestId, Stage);
-	}
-}
-
 #undef LOCTEXT_NAMESPACE /* WebRemoteControl */
 
 IMPLEMENT_MODULE(FWebRemoteControlModule, WebRemoteControl);
@@ -0,0 +1,545 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlActorSearchIndex.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "RemoteControlRequest.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "WebRemoteControlSearchUtils.h"
+
+namespace WebRemoteControlActorSearchUtils
+{
+	/** Find a class from its path or its name. */
+	UClass* ResolveClass(const FString& InClassName)
+	{
+		if (InClassName.Contains(TEXT("/")))
+		{
+			return FindObject<UClass>(FTopLevelAssetPath(InClassName));
+		}
+		return FindFirstObject<UClass>(*InClassName, EFindFirstObjectOptions::NativeFirst);
+	}
+
+	/** Whether a level is designated by a level filter, which can be the level's path, its package name or the map name. */
+	bool MatchesLevel(const ULevel* InLevel, const FString& InLevelFilter)
+	{
+		const FString PackageName = UWorld::RemovePIEPrefix(InLevel->GetOutermost()->GetName());
+		return InLevelFilter.Equals(PackageName, ESearchCase::IgnoreCase)
+			|| InLevelFilter.Equals(FPackageName::GetShortName(PackageName), ESearchCase::IgnoreCase)
+			|| InLevelFilter.Equals(InLevel->GetPathName(), ESearchCase::IgnoreCase);
+	}
+
+	/** Remove an entry from the list stored under a key, dropping the list once empty. */
+	template <typename KeyType>
+	void RemoveFromList(TMap<KeyType, TArray<int32>>& InOutLists, const KeyType& InKey, int32 InEntryIndex)
+	{
+		if (TArray<int32>* List = InOutLists.Find(InKey))
+		{
+			List->RemoveSingleSwap(InEntryIndex, EAllowShrinking::No);
+			if (List->Num() == 0)
+			{
+				InOutLists.Remove(InKey);
+			}
+		}
+	}
+}
+
+FWebRemoteControlActorSearchIndex::FWebRemoteControlActorSearchIndex()
+{
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().AddRaw(this, &FWebRemoteControlActorSearchIndex::OnActorSpawned);
+		GEngine->OnLevelActorDeleted().AddRaw(this, &FWebRemoteControlActorSearchIndex::OnActorDestroyed);
+		OnLevelActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FWebRemoteControlActorSearchIndex::OnLevelActorListChanged);
+	}
+
+	FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FWebRemoteControlActorSearchIndex::OnLevelAddedToWorld);
+	FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FWebRemoteControlActorSearchIndex::OnLevelRemovedFromWorld);
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FWebRemoteControlActorSearchIndex::OnWorldCleanup);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FWebRemoteControlActorSearchIndex::OnObjectPropertyChanged);
+	FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FWebRemoteControlActorSearchIndex::OnObjectTransacted);
+#endif
+}
+
+FWebRemoteControlActorSearchIndex::~FWebRemoteControlActorSearchIndex()
+{
+	TArray<TObjectKey<UWorld>> Worlds;
+	WorldIndices.GetKeys(Worlds);
+	for (const TObjectKey<UWorld>& World : Worlds)
+	{
+		RemoveWorldIndex(World.ResolveObjectPtr());
+	}
+	WorldIndices.Empty();
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().RemoveAll(this);
+		GEngine->OnLevelActorDeleted().RemoveAll(this);
+		GEngine->OnLevelActorListChanged().Remove(OnLevelActorListChangedHandle);
+	}
+
+	FWorldDelegates::LevelAddedToWorld.RemoveAll(this);
+	FWorldDelegates::LevelRemovedFromWorld.RemoveAll(this);
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectTransacted.RemoveAll(this);
+#endif
+}
+
+int32 FWebRemoteControlActorSearchIndex::Search(UWorld* InWorld, const FSearchActorRequest& InRequest, TArray<AActor*>& OutActors)
+{
+	using namespace WebRemoteControlActorSearchUtils;
+
+	if (!InWorld)
+	{
+		return 0;
+	}
+
+	FWorldIndex& Index = GetWorldIndex(InWorld);
+
+	UClass* FilterClass = nullptr;
+	if (!InRequest.Class.IsEmpty())
+	{
+		FilterClass = ResolveClass(InRequest.Class);
+		if (!FilterClass)
+		{
+			return 0;
+		}
+	}
+
+	TSet<const ULevel*> FilterLevels;
+	if (!InRequest.Level.IsEmpty())
+	{
+		for (const ULevel* Level : InWorld->GetLevels())
+		{
+			if (Level && MatchesLevel(Level, InRequest.Level))
+			{
+				FilterLevels.Add(Level);
+			}
+		}
+
+		if (FilterLevels.Num() == 0)
+		{
+			return 0;
+		}
+	}
+
+	// Each criterion yields the set of entries that can match it, only the smallest one needs to be visited.
+	TArray<const TArray<int32>*, TInlineAllocator<8>> CandidateLists;
+	int32 CandidateCount = MAX_int32;
+	bool bHasCandidateLists = false;
+
+	auto ConsiderCandidates = [&CandidateLists, &CandidateCount, &bHasCandidateLists](TArray<const TArray<int32>*, TInlineAllocator<8>>&& InLists)
+	{
+		int32 Count = 0;
+		for (const TArray<int32>* List : InLists)
+		{
+			Count += List->Num();
+		}
+
+		if (!bHasCandidateLists || Count < CandidateCount)
+		{
+			CandidateLists = MoveTemp(InLists);
+			CandidateCount = Count;
+			bHasCandidateLists = true;
+		}
+	};
+
+	if (FilterClass)
+	{
+		TArray<const TArray<int32>*, TInlineAllocator<8>> ClassLists;
+		for (const TPair<TObjectKey<UClass>, TArray<int32>>& Pair : Index.ClassEntries)
+		{
+			const UClass* Class = Pair.Key.ResolveObjectPtr();
+			if (Class && Class->IsChildOf(FilterClass))
+			{
+				ClassLists.Add(&Pair.Value);
+			}
+		}
+		ConsiderCandidates(MoveTemp(ClassLists));
+	}
+
+	if (FilterLevels.Num())
+	{
+		TArray<const TArray<int32>*, TInlineAllocator<8>> LevelLists;
+		for (const ULevel* Level : FilterLevels)
+		{
+			if (const TArray<int32>* List = Index.LevelEntries.Find(Level))
+			{
+				LevelLists.Add(List);
+			}
+		}
+		ConsiderCandidates(MoveTemp(LevelLists));
+	}
+
+	for (const FName& Tag : InRequest.Tags)
+	{
+		TArray<const TArray<int32>*, TInlineAllocator<8>> TagLists;
+		if (const TArray<int32>* List = Index.TagEntries.Find(Tag))
+		{
+			TagLists.Add(List);
+		}
+		ConsiderCandidates(MoveTemp(TagLists));
+	}
+
+	TArray<uint64> QueryTrigrams;
+	WebRemoteControlSearchUtils::GetTrigrams(InRequest.Query, QueryTrigrams);
+	for (uint64 Trigram : QueryTrigrams)
+	{
+		TArray<const TArray<int32>*, TInlineAllocator<8>> TrigramLists;
+		if (const TArray<int32>* List = Index.TrigramEntries.Find(Trigram))
+		{
+			TrigramLists.Add(List);
+		}
+		ConsiderCandidates(MoveTemp(TrigramLists));
+	}
+
+	struct FScoredActor
+	{
+		AActor* Actor = nullptr;
+		int32 Score = 0;
+		FString Path;
+	};
+
+	// Keep the best results in a heap whose top is the worst of them, ties are ordered by path so pages are stable.
+	auto IsWorse = [](const FScoredActor& A, const FScoredActor& B)
+	{
+		if (A.Score != B.Score)
+		{
+			return A.Score < B.Score;
+		}
+		return A.Path > B.Path;
+	};
+
+	const int32 Offset = FMath::Max(InRequest.Offset, 0);
+	const int32 MaxResults = InRequest.Limit > 0 ? Offset + InRequest.Limit : 0;
+	TArray<FScoredActor> BestActors;
+	BestActors.Reserve(MaxResults + 1);
+	int32 TotalMatches = 0;
+
+	auto ConsiderEntry = [&](const FActorEntry& Entry)
+	{
+		AActor* Actor = Entry.Actor.Get();
+		if (!IsValid(Actor) || Actor->IsActorBeingDestroyed() || Actor->GetWorld() != InWorld)
+		{
+			return;
+		}
+
+		if ((FilterClass && !Actor->IsA(FilterClass)) || (FilterLevels.Num() && !FilterLevels.Contains(Actor->GetLevel())))
+		{
+			return;
+		}
+
+		for (const FName& Tag : InRequest.Tags)
+		{
+			if (!Actor->ActorHasTag(Tag))
+			{
+				return;
+			}
+		}
+
+		int32 Score = 0;
+		if (!InRequest.Query.IsEmpty())
+		{
+			Score = FMath::Max(WebRemoteControlSearchUtils::ScoreName(Actor->GetActorNameOrLabel(), InRequest.Query, false), WebRemoteControlSearchUtils::ScoreName(Actor->GetName(), InRequest.Query, false));
+			if (Score == 0)
+			{
+				return;
+			}
+		}
+
+		TotalMatches++;
+		if (MaxResults > 0)
+		{
+			BestActors.HeapPush(FScoredActor{ Actor, Score, Actor->GetPathName() }, IsWorse);
+			if (BestActors.Num() > MaxResults)
+			{
+				BestActors.HeapPopDiscard(IsWorse, EAllowShrinking::No);
+			}
+		}
+	};
+
+	if (bHasCandidateLists)
+	{
+		for (const TArray<int32>* List : CandidateLists)
+		{
+			for (int32 EntryIndex : *List)
+			{
+				ConsiderEntry(Index.Entries[EntryIndex]);
+			}
+		}
+	}
+	else
+	{
+		for (const FActorEntry& Entry : Index.Entries)
+		{
+			ConsiderEntry(Entry);
+		}
+	}
+
+	BestActors.Sort([&IsWorse](const FScoredActor& A, const FScoredActor& B) { return IsWorse(B, A); });
+
+	for (int32 ResultIndex = Offset; ResultIndex < BestActors.Num(); ++ResultIndex)
+	{
+		OutActors.Add(BestActors[ResultIndex].Actor);
+	}
+
+	return TotalMatches;
+}
+
+FWebRemoteControlActorSearchIndex::FWorldIndex& FWebRemoteControlActorSearchIndex::GetWorldIndex(UWorld* InWorld)
+{
+	if (FWorldIndex* ExistingIndex = WorldIndices.Find(InWorld))
+	{
+		if (ExistingIndex->bIsDirty)
+		{
+			// Start over while keeping the world's delegates bound.
+			FWorldIndex RebuiltIndex;
+			RebuiltIndex.ActorSpawnedHandle = ExistingIndex->ActorSpawnedHandle;
+			RebuiltIndex.ActorDestroyedHandle = ExistingIndex->ActorDestroyedHandle;
+			*ExistingIndex = MoveTemp(RebuiltIndex);
+			PopulateWorldIndex(InWorld, *ExistingIndex);
+		}
+		return *ExistingIndex;
+	}
+
+	FWorldIndex& Index = WorldIndices.Add(InWorld);
+	Index.ActorSpawnedHandle = InWorld->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateRaw(this, &FWebRemoteControlActorSearchIndex::OnActorSpawned));
+	Index.ActorDestroyedHandle = InWorld->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateRaw(this, &FWebRemoteControlActorSearchIndex::OnActorDestroyed));
+	PopulateWorldIndex(InWorld, Index);
+	return Index;
+}
+
+void FWebRemoteControlActorSearchIndex::PopulateWorldIndex(UWorld* InWorld, FWorldIndex& InOutIndex)
+{
+	for (AActor* Actor : TActorRange<AActor>(InWorld))
+	{
+		AddActor(InOutIndex, Actor);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::RemoveWorldIndex(UWorld* InWorld)
+{
+	FWorldIndex Index;
+	if (!WorldIndices.RemoveAndCopyValue(InWorld, Index))
+	{
+		return;
+	}
+
+	if (InWorld)
+	{
+		InWorld->RemoveOnActorSpawnedHandler(Index.ActorSpawnedHandle);
+		InWorld->RemoveOnActorDestroyededHandler(Index.ActorDestroyedHandle);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::AddActor(FWorldIndex& InOutIndex, AActor* InActor)
+{
+	if (!IsValid(InActor) || InOutIndex.EntryIndices.Contains(InActor))
+	{
+		return;
+	}
+
+	FActorEntry Entry;
+	Entry.Actor = InActor;
+	Entry.Class = InActor->GetClass();
+	Entry.Level = InActor->GetLevel();
+
+	for (const FName& Tag : InActor->Tags)
+	{
+		Entry.Tags.AddUnique(Tag);
+	}
+
+	WebRemoteControlSearchUtils::GetTrigrams(InActor->GetActorNameOrLabel(), Entry.Trigrams);
+	WebRemoteControlSearchUtils::GetTrigrams(InActor->GetName(), Entry.Trigrams);
+
+	const int32 EntryIndex = InOutIndex.Entries.Add(MoveTemp(Entry));
+	const FActorEntry& AddedEntry = InOutIndex.Entries[EntryIndex];
+	InOutIndex.EntryIndices.Add(InActor, EntryIndex);
+	InOutIndex.ClassEntries.FindOrAdd(AddedEntry.Class).Add(EntryIndex);
+	InOutIndex.LevelEntries.FindOrAdd(AddedEntry.Level).Add(EntryIndex);
+
+	for (const FName& Tag : AddedEntry.Tags)
+	{
+		InOutIndex.TagEntries.FindOrAdd(Tag).Add(EntryIndex);
+	}
+
+	for (uint64 Trigram : AddedEntry.Trigrams)
+	{
+		InOutIndex.TrigramEntries.FindOrAdd(Trigram).Add(EntryIndex);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::RemoveActor(FWorldIndex& InOutIndex, const AActor* InActor)
+{
+	using namespace WebRemoteControlActorSearchUtils;
+
+	int32 EntryIndex = INDEX_NONE;
+	if (!InOutIndex.EntryIndices.RemoveAndCopyValue(InActor, EntryIndex))
+	{
+		return;
+	}
+
+	const FActorEntry& Entry = InOutIndex.Entries[EntryIndex];
+	RemoveFromList(InOutIndex.ClassEntries, Entry.Class, EntryIndex);
+	RemoveFromList(InOutIndex.LevelEntries, Entry.Level, EntryIndex);
+
+	for (const FName& Tag : Entry.Tags)
+	{
+		RemoveFromList(InOutIndex.TagEntries, Tag, EntryIndex);
+	}
+
+	for (uint64 Trigram : Entry.Trigrams)
+	{
+		RemoveFromList(InOutIndex.TrigramEntries, Trigram, EntryIndex);
+	}
+
+	InOutIndex.Entries.RemoveAt(EntryIndex);
+}
+
+void FWebRemoteControlActorSearchIndex::ReindexActor(AActor* InActor)
+{
+	if (FWorldIndex* Index = FindWorldIndex(InActor))
+	{
+		RemoveActor(*Index, InActor);
+		AddActor(*Index, InActor);
+	}
+}
+
+FWebRemoteControlActorSearchIndex::FWorldIndex* FWebRemoteControlActorSearchIndex::FindWorldIndex(const AActor* InActor)
+{
+	if (InActor)
+	{
+		if (UWorld* World = InActor->GetWorld())
+		{
+			return WorldIndices.Find(World);
+		}
+	}
+	return nullptr;
+}
+
+void FWebRemoteControlActorSearchIndex::OnActorSpawned(AActor* InActor)
+{
+	if (FWorldIndex* Index = FindWorldIndex(InActor))
+	{
+		AddActor(*Index, InActor);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::OnActorDestroyed(AActor* InActor)
+{
+	if (FWorldIndex* Index = FindWorldIndex(InActor))
+	{
+		RemoveActor(*Index, InActor);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::OnLevelActorListChanged()
+{
+	// We don't know what changed, so rebuild the indices the next time they're searched.
+	for (TPair<TObjectKey<UWorld>, FWorldIndex>& Pair : WorldIndices)
+	{
+		Pair.Value.bIsDirty = true;
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::OnLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld)
+{
+	FWorldIndex* Index = WorldIndices.Find(InWorld);
+	if (!Index || !InLevel)
+	{
+		return;
+	}
+
+	for (AActor* Actor : InLevel->Actors)
+	{
+		AddActor(*Index, Actor);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::OnLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld)
+{
+	FWorldIndex* Index = WorldIndices.Find(InWorld);
+	if (!Index)
+	{
+		return;
+	}
+
+	// A null level means that every level was removed.
+	if (!InLevel)
+	{
+		Index->bIsDirty = true;
+		return;
+	}
+
+	if (const TArray<int32>* LevelEntries = Index->LevelEntries.Find(InLevel))
+	{
+		TArray<TWeakObjectPtr<AActor>> ActorsToRemove;
+		for (int32 EntryIndex : *LevelEntries)
+		{
+			ActorsToRemove.Add(Index->Entries[EntryIndex].Actor);
+		}
+
+		for (const TWeakObjectPtr<AActor>& Actor : ActorsToRemove)
+		{
+			RemoveActor(*Index, Actor.GetEvenIfUnreachable());
+		}
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	RemoveWorldIndex(InWorld);
+}
+
+#if WITH_EDITOR
+void FWebRemoteControlActorSearchIndex::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InEvent)
+{
+	static const FName LabelProperty(TEXT("ActorLabel"));
+	static const FName TagsProperty(TEXT("Tags"));
+
+	// Only labels and tags are indexed, other properties don't affect searches.
+	const FName PropertyName = InEvent.GetPropertyName();
+	if (PropertyName != LabelProperty && PropertyName != TagsProperty && PropertyName != NAME_None)
+	{
+		return;
+	}
+
+	if (AActor* Actor = Cast<AActor>(InObject))
+	{
+		ReindexActor(Actor);
+	}
+}
+
+void FWebRemoteControlActorSearchIndex::OnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InTransactionEvent)
+{
+	// We only care about undo/redo
+	if (InTransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
+	{
+		return;
+	}
+
+	AActor* Actor = Cast<AActor>(InObject);
+	FWorldIndex* Index = FindWorldIndex(Actor);
+	if (!Index)
+	{
+		return;
+	}
+
+	RemoveActor(*Index, Actor);
+	if (IsValid(Actor))
+	{
+		AddActor(*Index, Actor);
+	}
+}
+#endif
@@ -0,0 +1,255 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlAssetSearchIndex.h"
+
+#include "AssetRegistry/ARFilter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Modules/ModuleManager.h"
+#include "WebRemoteControlSearchUtils.h"
+
+FWebRemoteControlAssetSearchIndex::~FWebRemoteControlAssetSearchIndex()
+{
+	Reset();
+}
+
+int32 FWebRemoteControlAssetSearchIndex::Search(const FString& InQuery, ERCAssetSearchMode InMode, const FARCompiledFilter& InFilter, TFunctionRef<bool(const FAssetData&)> InPredicate, int32 InOffset, int32 InLimit, TArray<FAssetData>& OutAssets)
+{
+	if (!bIsBuilt)
+	{
+		Build();
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	InOffset = FMath::Max(InOffset, 0);
+	const int32 MaxResults = InLimit > 0 ? InOffset + InLimit : 0;
+
+	// Keep the best results in a heap whose top is the worst of them.
+	auto IsWorse = [this](const FScoredEntry& A, const FScoredEntry& B)
+	{
+		if (A.Score != B.Score)
+		{
+			return A.Score < B.Score;
+		}
+		return Entries[A.EntryIndex].Name > Entries[B.EntryIndex].Name;
+	};
+
+	TArray<FScoredEntry> BestEntries;
+	BestEntries.Reserve(MaxResults + 1);
+	int32 TotalMatches = 0;
+
+	auto ConsiderEntry = [&](int32 EntryIndex, int32 SharedTrigrams, int32 QueryTrigrams)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		const int32 Score = ScoreEntry(Entry, InQuery, InMode, SharedTrigrams, QueryTrigrams);
+		if (Score <= 0 || !AssetRegistry.IsAssetIncludedByFilter(Entry.AssetData, InFilter) || !InPredicate(Entry.AssetData))
+		{
+			return;
+		}
+
+		TotalMatches++;
+		if (MaxResults > 0)
+		{
+			BestEntries.HeapPush(FScoredEntry{ EntryIndex, Score }, IsWorse);
+			if (BestEntries.Num() > MaxResults)
+			{
+				BestEntries.HeapPopDiscard(IsWorse, EAllowShrinking::No);
+			}
+		}
+	};
+
+	TArray<uint64> QueryTrigrams;
+	WebRemoteControlSearchUtils::GetTrigrams(InQuery, QueryTrigrams);
+
+	if (QueryTrigrams.Num() == 0)
+	{
+		// Queries too short to have trigrams are matched against every name.
+		for (TSparseArray<FEntry>::TConstIterator It(Entries); It; ++It)
+		{
+			ConsiderEntry(It.GetIndex(), 0, 0);
+		}
+	}
+	else if (InMode == ERCAssetSearchMode::Fuzzy)
+	{
+		// Any name sharing enough trigrams with the query is a candidate.
+		TMap<int32, int32> SharedTrigramCounts;
+		for (uint64 Trigram : QueryTrigrams)
+		{
+			if (const TArray<int32>* TrigramEntryIndices = TrigramEntries.Find(Trigram))
+			{
+				for (int32 EntryIndex : *TrigramEntryIndices)
+				{
+					SharedTrigramCounts.FindOrAdd(EntryIndex)++;
+				}
+			}
+		}
+
+		for (const TPair<int32, int32>& Pair : SharedTrigramCounts)
+		{
+			ConsiderEntry(Pair.Key, Pair.Value, QueryTrigrams.Num());
+		}
+	}
+	else
+	{
+		// A matching name contains every trigram of the query, so only the rarest one needs to be visited.
+		const TArray<int32>* SmallestEntryList = nullptr;
+		for (uint64 Trigram : QueryTrigrams)
+		{
+			const TArray<int32>* TrigramEntryIndices = TrigramEntries.Find(Trigram);
+			if (!TrigramEntryIndices)
+			{
+				SmallestEntryList = nullptr;
+				break;
+			}
+
+			if (!SmallestEntryList || TrigramEntryIndices->Num() < SmallestEntryList->Num())
+			{
+				SmallestEntryList = TrigramEntryIndices;
+			}
+		}
+
+		if (SmallestEntryList)
+		{
+			for (int32 EntryIndex : *SmallestEntryList)
+			{
+				ConsiderEntry(EntryIndex, QueryTrigrams.Num(), QueryTrigrams.Num());
+			}
+		}
+	}
+
+	BestEntries.Sort([&IsWorse](const FScoredEntry& A, const FScoredEntry& B) { return IsWorse(B, A); });
+
+	for (int32 Index = InOffset; Index < BestEntries.Num(); ++Index)
+	{
+		OutAssets.Add(Entries[BestEntries[Index].EntryIndex].AssetData);
+	}
+
+	return TotalMatches;
+}
+
+void FWebRemoteControlAssetSearchIndex::Build()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAllAssets(Assets);
+
+	Entries.Reserve(Assets.Num());
+	EntryIndices.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		AddAsset(AssetData);
+	}
+
+	// Assets discovered by a scan that is still running are added through these callbacks.
+	AssetRegistry.OnAssetAdded().AddRaw(this, &FWebRemoteControlAssetSearchIndex::OnAssetAdded);
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FWebRemoteControlAssetSearchIndex::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FWebRemoteControlAssetSearchIndex::OnAssetRenamed);
+	AssetRegistry.OnAssetUpdated().AddRaw(this, &FWebRemoteControlAssetSearchIndex::OnAssetUpdated);
+
+	bIsBuilt = true;
+}
+
+void FWebRemoteControlAssetSearchIndex::Reset()
+{
+	if (bIsBuilt)
+	{
+		if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnAssetAdded().RemoveAll(this);
+			AssetRegistry.OnAssetRemoved().RemoveAll(this);
+			AssetRegistry.OnAssetRenamed().RemoveAll(this);
+			AssetRegistry.OnAssetUpdated().RemoveAll(this);
+		}
+	}
+
+	Entries.Empty();
+	EntryIndices.Empty();
+	TrigramEntries.Empty();
+	bIsBuilt = false;
+}
+
+void FWebRemoteControlAssetSearchIndex::AddAsset(const FAssetData& InAssetData)
+{
+	const FSoftObjectPath ObjectPath = InAssetData.GetSoftObjectPath();
+	if (int32* ExistingIndex = EntryIndices.Find(ObjectPath))
+	{
+		Entries[*ExistingIndex].AssetData = InAssetData;
+		return;
+	}
+
+	FEntry Entry;
+	Entry.AssetData = InAssetData;
+	Entry.Name = InAssetData.AssetName.ToString();
+
+	TArray<uint64> Trigrams;
+	WebRemoteControlSearchUtils::GetTrigrams(Entry.Name, Trigrams);
+
+	const int32 EntryIndex = Entries.Add(MoveTemp(Entry));
+	EntryIndices.Add(ObjectPath, EntryIndex);
+
+	for (uint64 Trigram : Trigrams)
+	{
+		TrigramEntries.FindOrAdd(Trigram).Add(EntryIndex);
+	}
+}
+
+void FWebRemoteControlAssetSearchIndex::RemoveAsset(const FSoftObjectPath& InObjectPath)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryIndices.RemoveAndCopyValue(InObjectPath, EntryIndex))
+	{
+		return;
+	}
+
+	TArray<uint64> Trigrams;
+	WebRemoteControlSearchUtils::GetTrigrams(Entries[EntryIndex].Name, Trigrams);
+
+	for (uint64 Trigram : Trigrams)
+	{
+		if (TArray<int32>* TrigramEntryIndices = TrigramEntries.Find(Trigram))
+		{
+			TrigramEntryIndices->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+			if (TrigramEntryIndices->Num() == 0)
+			{
+				TrigramEntries.Remove(Trigram);
+			}
+		}
+	}
+
+	Entries.RemoveAt(EntryIndex);
+}
+
+void FWebRemoteControlAssetSearchIndex::OnAssetAdded(const FAssetData& InAssetData)
+{
+	AddAsset(InAssetData);
+}
+
+void FWebRemoteControlAssetSearchIndex::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	RemoveAsset(InAssetData.GetSoftObjectPath());
+}
+
+void FWebRemoteControlAssetSearchIndex::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	RemoveAsset(FSoftObjectPath(InOldObjectPath));
+	AddAsset(InAssetData);
+}
+
+void FWebRemoteControlAssetSearchIndex::OnAssetUpdated(const FAssetData& InAssetData)
+{
+	// Updates can change tags used by filters but never the name, so the trigrams stay valid.
+	AddAsset(InAssetData);
+}
+
+int32 FWebRemoteControlAssetSearchIndex::ScoreEntry(const FEntry& InEntry, const FString& InQuery, ERCAssetSearchMode InMode, int32 InSharedTrigrams, int32 InQueryTrigrams) const
+{
+	const int32 Score = WebRemoteControlSearchUtils::ScoreName(InEntry.Name, InQuery, InMode == ERCAssetSearchMode::Prefix);
+	if (Score == 0 && InMode == ERCAssetSearchMode::Fuzzy)
+	{
+		return WebRemoteControlSearchUtils::ScoreFuzzyName(InEntry.Name, InQuery, InSharedTrigrams, InQueryTrigrams);
+	}
+	return Score;
+}
@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlBufferPool.h"
+
+#include "WebRemoteControlMetrics.h"
+
+namespace WebRemoteControlBufferPoolUtils
+{
+	/** Free buffers of a thread, binned by size class. */
+	struct FThreadPool
+	{
+		~FThreadPool()
+		{
+			// The free buffers are freed along with the thread.
+			FWebRemoteControlMetrics::Get().PooledBufferIdleBytes.fetch_sub(IdleBytes, std::memory_order_relaxed);
+		}
+
+		TArray<TArray<uint8>> FreeBuffers[FWebRemoteControlBufferPool::NumSizeClasses];
+
+		/** Total capacity of the free buffers. */
+		int64 IdleBytes = 0;
+	};
+
+	FThreadPool& GetThreadPool()
+	{
+		static thread_local FThreadPool ThreadPool;
+		return ThreadPool;
+	}
+
+	/** Size class whose buffers all have at least the given capacity. */
+	int32 GetSizeClassForCapacity(int32 InMinCapacity)
+	{
+		const uint32 CapacityBits = InMinCapacity > 1 ? FMath::CeilLogTwo(static_cast<uint32>(InMinCapacity)) : 0;
+		return FMath::Max<int32>(CapacityBits, FWebRemoteControlBufferPool::MinSizeClassBits) - FWebRemoteControlBufferPool::MinSizeClassBits;
+	}
+
+	/** Size class a buffer is pooled in, its capacity being at least the capacity of the class. INDEX_NONE if it shouldn't be pooled. */
+	int32 GetSizeClassOfBuffer(const TArray<uint8>& InBuffer)
+	{
+		const int32 Capacity = InBuffer.Max();
+		if (Capacity < (1 << FWebRemoteControlBufferPool::MinSizeClassBits) || Capacity >= (2 << FWebRemoteControlBufferPool::MaxSizeClassBits))
+		{
+			return INDEX_NONE;
+		}
+
+		return FMath::Min<int32>(FMath::FloorLog2(static_cast<uint32>(Capacity)), FWebRemoteControlBufferPool::MaxSizeClassBits) - FWebRemoteControlBufferPool::MinSizeClassBits;
+	}
+
+	void AddBytesInUse(int64 InBytes)
+	{
+		FWebRemoteControlMetrics& Metrics = FWebRemoteControlMetrics::Get();
+
+		const uint64 BytesInUse = Metrics.PooledBufferBytesInUse.fetch_add(InBytes, std::memory_order_relaxed) + InBytes;
+
+		uint64 PeakBytes = Metrics.PooledBufferPeakBytes.load(std::memory_order_relaxed);
+		while (BytesInUse > PeakBytes && !Metrics.PooledBufferPeakBytes.compare_exchange_weak(PeakBytes, BytesInUse, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void AddIdleBytes(FThreadPool& InThreadPool, int64 InBytes)
+	{
+		InThreadPool.IdleBytes += InBytes;
+		FWebRemoteControlMetrics::Get().PooledBufferIdleBytes.fetch_add(InBytes, std::memory_order_relaxed);
+	}
+}
+
+TArray<uint8> FWebRemoteControlBufferPool::Acquire(int32 InMinCapacity)
+{
+	using namespace WebRemoteControlBufferPoolUtils;
+
+	TArray<uint8> Buffer;
+
+	const int32 SizeClass = GetSizeClassForCapacity(InMinCapacity);
+	if (SizeClass < NumSizeClasses)
+	{
+		FThreadPool& ThreadPool = GetThreadPool();
+
+		// Fall back to a buffer of the next size classes before allocating a new one.
+		for (int32 Index = SizeClass; Index < NumSizeClasses; ++Index)
+		{
+			if (ThreadPool.FreeBuffers[Index].Num())
+			{
+				Buffer = ThreadPool.FreeBuffers[Index].Pop(EAllowShrinking::No);
+				AddIdleBytes(ThreadPool, -static_cast<int64>(Buffer.Max()));
+				break;
+			}
+		}
+	}
+
+	FWebRemoteControlMetrics& Metrics = FWebRemoteControlMetrics::Get();
+	if (Buffer.Max() > 0)
+	{
+		Metrics.PooledBufferHits.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		Metrics.PooledBufferMisses.fetch_add(1, std::memory_order_relaxed);
+		Buffer.Reserve(SizeClass < NumSizeClasses ? 1 << (SizeClass + MinSizeClassBits) : InMinCapacity);
+	}
+
+	AddBytesInUse(Buffer.Max());
+	return Buffer;
+}
+
+void FWebRemoteControlBufferPool::Release(TArray<uint8>&& InBuffer, int32 InAcquiredCapacity)
+{
+	using namespace WebRemoteControlBufferPoolUtils;
+
+	TArray<uint8> Buffer = MoveTemp(InBuffer);
+	AddBytesInUse(-static_cast<int64>(InAcquiredCapacity));
+
+	const int32 SizeClass = GetSizeClassOfBuffer(Buffer);
+	if (SizeClass == INDEX_NONE)
+	{
+		return;
+	}
+
+	FThreadPool& ThreadPool = GetThreadPool();
+	TArray<TArray<uint8>>& FreeBuffers = ThreadPool.FreeBuffers[SizeClass];
+	if (FreeBuffers.Num() < MaxFreeBuffersPerSizeClass && ThreadPool.IdleBytes + Buffer.Max() <= MaxIdleBytesPerThread)
+	{
+		AddIdleBytes(ThreadPool, Buffer.Max());
+		Buffer.Reset();
+		FreeBuffers.Add(MoveTemp(Buffer));
+	}
+}
@@ -18,6 +18,10 @@
 // Console variable handling
 #include "HAL/ConsoleManager.h"
 
+// Async
+#include "Async/Async.h"
+#include "Containers/LruCache.h"
+
 // Global UOject delegates
 #include "UObject/UObjectGlobals.h"
 
@@ -29,16 +33,285 @@
 #include "IImageWrapper.h"
 #include "Misc/ObjectThumbnail.h"
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
 #include "ObjectTools.h"
+#include "UObject/Package.h"
 
 #include "Styling/SlateBrush.h"
 
+static TAutoConsoleVariable<int32> CVarWebRemoteControlThumbnailCacheSizeMB(
+	TEXT("WebControl.ThumbnailCacheSizeMB"),
+	64,
+	TEXT("Maximum amount of memory in megabytes used to cache encoded thumbnails. 0 disables the cache.")
+);
+
+namespace WebRemoteControlThumbnailUtils
+{
+	/** Find the asset targeted by a thumbnail request, also accepting package paths without the asset name. */
+	bool FindThumbnailAsset(const FString& InObjectPath, FAssetData& OutAssetData)
+	{
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+		FARFilter Filter;
+		Filter.SoftObjectPaths.Add(InObjectPath);
+
+		TArray<FAssetData> Assets;
+		AssetRegistryModule.Get().GetAssets(Filter, Assets);
+
+		if (!Assets.Num())
+		{
+			// Attempt to find by stripping file extension
+			int32 Index = INDEX_NONE;
+			FStringView ModifiedName = FStringView(InObjectPath);
+
+			// Attempt to strip asset extension
+			if (InObjectPath.FindLastChar(TEXT('.'), Index))
+			{
+				ModifiedName.LeftInline(Index);
+			}
+
+			if (InObjectPath.FindLastChar(TEXT('/'), Index))
+			{
+				// Attempt to find by duplicating the last part of the path.
+				FStringView LastSegment = ModifiedName.RightChop(Index + 1);
+				TStringBuilder<64> Builder;
+				Builder.Append(ModifiedName);
+				Builder.Append(TEXT("."));
+				Builder.Append(LastSegment);
+
+				FARFilter FallbackFilter;
+				FallbackFilter.SoftObjectPaths.Add(FSoftObjectPath(Builder.ToView()));
+				AssetRegistryModule.Get().GetAssets(FallbackFilter, Assets);
+			}
+		}
+
+		if (Assets.Num())
+		{
+			OutAssetData = Assets[0];
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Build an ETag from the asset path and the save timestamp of its package.
+	 * Returns an empty string when the thumbnail should not be cached, ie. the package is unsaved or modified in memory.
+	 */
+	FString MakeThumbnailETag(const FAssetData& InAssetData)
+	{
+		const FString PackageName = InAssetData.PackageName.ToString();
+		if (UPackage* Package = FindPackage(nullptr, *PackageName))
+		{
+			if (Package->IsDirty())
+			{
+				return FString();
+			}
+		}
+
+		FString PackageFilename;
+		if (!FPackageName::DoesPackageExist(PackageName, &PackageFilename))
+		{
+			return FString();
+		}
+
+		const FDateTime SaveTime = IFileManager::Get().GetTimeStamp(*PackageFilename);
+		if (SaveTime == FDateTime::MinValue())
+		{
+			return FString();
+		}
+
+		return FString::Printf(TEXT("\"%08x-%llx\""), GetTypeHash(InAssetData.GetObjectPathString()), SaveTime.GetTicks());
+	}
+
+	/** Whether the request's If-None-Match header lists the given ETag, weak ETags match their strong counterpart. */
+	bool MatchesETag(const FHttpServerRequest& InRequest, const FString& InETag)
+	{
+		if (const TArray<FString>* IfNoneMatch = InRequest.Headers.Find(TEXT("If-None-Match")))
+		{
+			for (const FString& Value : *IfNoneMatch)
+			{
+				TArray<FString> ETags;
+				Value.ParseIntoArray(ETags, TEXT(","));
+				for (const FString& ETag : ETags)
+				{
+					FStringView TrimmedETag = FStringView(ETag).TrimStartAndEnd();
+					if (TrimmedETag.StartsWith(TEXT("W/")))
+					{
+						TrimmedETag.RightChopInline(2);
+					}
+
+					if (TrimmedETag == TEXT("*") || TrimmedETag.Equals(InETag, ESearchCase::CaseSensitive))
+					{
+						return true;
+					}
+				}
+			}
+		}
+		return false;
+	}
+
+	/** Decode a compressed thumbnail and re-encode it as a PNG. Safe to call from any thread. */
+	TArray<uint8> EncodeThumbnailToPNG(IImageWrapperModule& ImageWrapperModule, const TArray<uint8>& InCompressedData, EImageFormat InFormat)
+	{
+		TSharedPtr<IImageWrapper> SourceWrapper = ImageWrapperModule.CreateImageWrapper(InFormat);
+		TArray<uint8> RawData;
+		if (SourceWrapper && SourceWrapper->SetCompressed(InCompressedData.GetData(), InCompressedData.Num()) && SourceWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+		{
+			TSharedPtr<IImageWrapper> PNGWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+			if (PNGWrapper && PNGWrapper->SetRaw(RawData.GetData(), RawData.Num(), SourceWrapper->GetWidth(), SourceWrapper->GetHeight(), ERGBFormat::BGRA, 8))
+			{
+				return TArray<uint8>(PNGWrapper->GetCompressed());
+			}
+		}
+		return TArray<uint8>();
+	}
+
+	/** Respond with the thumbnail data, or with a 404 if it's empty. */
+	void SendThumbnailResponse(const FString& InObjectPath, const TArray<uint8>& InThumbnailData, const FString& InETag, const FHttpResultCallback& OnComplete)
+	{
+		TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse();
+		if (InThumbnailData.Num())
+		{
+			WebRemoteControlInternalUtils::AddContentTypeHeaders(Response.Get(), TEXT("image/png"));
+			if (!InETag.IsEmpty())
+			{
+				Response->Headers.Add(TEXT("ETag"), { InETag });
+			}
+			Response->Body = InThumbnailData;
+			Response->Code = EHttpServerResponseCodes::Ok;
+		}
+		else
+		{
+			WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(FString::Printf(TEXT("Could not load thumbnail for object %s"), *InObjectPath), Response->Body);
+			Response->Code = EHttpServerResponseCodes::NotFound;
+		}
+
+		OnComplete(MoveTemp(Response));
+	}
+}
+
+struct FWebRemoteControlEditorRoutes::FThumbnailCache
+{
+	struct FEntry
+	{
+		FString ETag;
+		TArray<uint8> Data;
+	};
+
+	/** Object path and ETag of a thumbnail being encoded, the ETag is empty while its package is dirty. */
+	using FPendingEncodeKey = TTuple<FString, FString>;
+
+	FThumbnailCache()
+	{
+		CacheSizeChangedHandle = CVarWebRemoteControlThumbnailCacheSizeMB->OnChangedDelegate().AddRaw(this, &FThumbnailCache::OnCacheSizeChanged);
+	}
+
+	~FThumbnailCache()
+	{
+		CVarWebRemoteControlThumbnailCacheSizeMB->OnChangedDelegate().Remove(CacheSizeChangedHandle);
+	}
+
+	/** Maximum size of the cached thumbnails, from WebControl.ThumbnailCacheSizeMB. */
+	static int64 GetMaxSizeBytes()
+	{
+		return (int64)FMath::Max(CVarWebRemoteControlThumbnailCacheSizeMB.GetValueOnGameThread(), 0) * 1024 * 1024;
+	}
+
+	/** Returns the cached thumbnail if it is still up to date. */
+	const TArray<uint8>* Find(const FString& InKey, const FString& InETag)
+	{
+		if (const FEntry* Entry = Entries.FindAndTouch(InKey))
+		{
+			if (Entry->ETag == InETag)
+			{
+				return &Entry->Data;
+			}
+			Remove(InKey);
+		}
+		return nullptr;
+	}
+
+	/** Cache a thumbnail, evicting the least recently used ones until it fits in the memory budget. */
+	void Add(const FString& InKey, const FString& InETag, const TArray<uint8>& InData)
+	{
+		const int64 MaxSizeBytes = GetMaxSizeBytes();
+		if (InETag.IsEmpty() || InData.Num() > MaxSizeBytes)
+		{
+			return;
+		}
+
+		Remove(InKey);
+		Trim(MaxSizeBytes - InData.Num());
+
+		if (Entries.Num() == Entries.Max())
+		{
+			SizeBytes -= Entries.RemoveLeastRecent().Data.Num();
+		}
+
+		SizeBytes += InData.Num();
+		Entries.Add(InKey, FEntry{ InETag, InData });
+	}
+
+	void Remove(const FString& InKey)
+	{
+		if (const FEntry* Entry = Entries.FindAndTouch(InKey))
+		{
+			SizeBytes -= Entry->Data.Num();
+			Entries.Remove(InKey);
+		}
+	}
+
+	/** Evict the least recently used thumbnails until the cache fits in the given size. */
+	void Trim(int64 InMaxSizeBytes)
+	{
+		while (Entries.Num() && SizeBytes > InMaxSizeBytes)
+		{
+			SizeBytes -= Entries.RemoveLeastRecent().Data.Num();
+		}
+	}
+
+	/** Trim the cache when its memory budget is lowered. */
+	void OnCacheSizeChanged(IConsoleVariable* InVariable)
+	{
+		Trim(GetMaxSizeBytes());
+	}
+
+	/** Cache the result of a background encode and respond to every request that was waiting on it. */
+	void CompletePendingEncode(const FString& InKey, const FString& InETag, TArray<uint8>&& InData)
+	{
+		TArray<FHttpResultCallback> Callbacks;
+		PendingEncodes.RemoveAndCopyValue(MakeTuple(InKey, InETag), Callbacks);
+
+		if (InData.Num())
+		{
+			Add(InKey, InETag, InData);
+		}
+
+		for (const FHttpResultCallback& Callback : Callbacks)
+		{
+			WebRemoteControlThumbnailUtils::SendThumbnailResponse(InKey, InData, InETag, Callback);
+		}
+	}
+
+	/** Least recently used thumbnails, bounded by WebControl.ThumbnailCacheSizeMB. */
+	TLruCache<FString, FEntry> Entries{ 4096 };
+	/** Total size of the cached thumbnails. */
+	int64 SizeBytes = 0;
+	/** Requests waiting on a thumbnail that is being encoded, by object path and the state of its package. */
+	TMap<FPendingEncodeKey, TArray<FHttpResultCallback>> PendingEncodes;
+	/** Handle to the WebControl.ThumbnailCacheSizeMB change callback. */
+	FDelegateHandle CacheSizeChangedHandle;
+};
+
 FWebRemoteControlEditorRoutes::FWebRemoteControlEditorRoutes(FVTableHelper& Helper)
 {
 }
 
 void FWebRemoteControlEditorRoutes::RegisterRoutes(FWebRemoteControlModule* WebRemoteControl)
 {
+	ThumbnailCache = MakeShared<FThumbnailCache>();
+
 	if (FConsoleManager::Get().FindConsoleVariable(TEXT("WebControl.EnableExperimentalRoutes"))->GetBool())
 	{
 		static const FName ModuleName = "WebRemoteControl";
@@ -68,6 +341,8 @@ void FWebRemoteControlEditorRoutes::UnregisterRoutes(FWebRemoteControlModule* We
 	{
 		WebRemoteControl->UnregisterRoute(Route);
 	}
+
+	ThumbnailCache.Reset();
 }
 
 bool FWebRemoteControlEditorRoutes::HandleObjectEventRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -90,95 +365,109 @@ bool FWebRemoteControlEditorRoutes::HandleObjectEventRoute(const FHttpServerRequ
 
 bool FWebRemoteControlEditorRoutes::HandleGetThumbnailRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse();
 	FGetObjectThumbnailRequest GetThumbnailRequest;
 	if (!WebRemoteControlInternalUtils::DeserializeRequest(Request, &OnComplete, GetThumbnailRequest))
 	{
 		return true;
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-	FARFilter Filter;
-	Filter.SoftObjectPaths.Add(GetThumbnailRequest.ObjectPath);
+	FAssetData AssetData;
+	if (!WebRemoteControlThumbnailUtils::FindThumbnailAsset(GetThumbnailRequest.ObjectPath, AssetData))
+	{
+		WebRemoteControlThumbnailUtils::SendThumbnailResponse(GetThumbnailRequest.ObjectPath, TArray<uint8>(), FString(), OnComplete);
+		return true;
+	}
 
-	TArray<FAssetData> Assets;
-	AssetRegistryModule.Get().GetAssets(Filter, Assets);
+	const FString CacheKey = AssetData.GetObjectPathString();
+	const FString ETag = WebRemoteControlThumbnailUtils::MakeThumbnailETag(AssetData);
 
-	if (!Assets.Num())
+	if (!ETag.IsEmpty())
 	{
-		// Attempt to find by stripping file extension
-		int32 Index = INDEX_NONE;
-		FStringView ModifiedName = FStringView(GetThumbnailRequest.ObjectPath);
-
-		// Attempt to strip asset extension
-		if (GetThumbnailRequest.ObjectPath.FindLastChar(TEXT('.'), Index))
+		// The client already holds this version of the thumbnail, skip the image pipeline entirely.
+		if (WebRemoteControlThumbnailUtils::MatchesETag(Request, ETag))
 		{
-			ModifiedName.LeftInline(Index);
+			TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse(EHttpServerResponseCodes::NotModified);
+			Response->Headers.Add(TEXT("ETag"), { ETag });
+			OnComplete(MoveTemp(Response));
+			return true;
 		}
 
-		if (GetThumbnailRequest.ObjectPath.FindLastChar(TEXT('/'), Index))
+		if (const TArray<uint8>* CachedThumbnail = ThumbnailCache->Find(CacheKey, ETag))
 		{
-			// Attempt to find by duplicating the last part of the path.
-			FStringView LastSegment = ModifiedName.RightChop(Index + 1);
-			TStringBuilder<64> Builder;
-			Builder.Append(ModifiedName);
-			Builder.Append(TEXT("."));
-			Builder.Append(LastSegment);
-
-			FARFilter FallbackFilter;
-			FallbackFilter.SoftObjectPaths.Add(FSoftObjectPath(Builder.ToView()));
-			AssetRegistryModule.Get().GetAssets(FallbackFilter, Assets);
+			WebRemoteControlThumbnailUtils::SendThumbnailResponse(CacheKey, *CachedThumbnail, ETag, OnComplete);
+			return true;
 		}
 	}
 
-	if (Assets.Num())
+	// Another request is already encoding this state of the thumbnail, respond when it completes.
+	const FThumbnailCache::FPendingEncodeKey PendingEncodeKey = MakeTuple(CacheKey, ETag);
+	if (TArray<FHttpResultCallback>* PendingCallbacks = ThumbnailCache->PendingEncodes.Find(PendingEncodeKey))
 	{
-		const FAssetData& AssetData = Assets[0];
-		FName ObjectFullName = FName(*AssetData.GetFullName());
-		FThumbnailMap ThumbnailMap;
+		PendingCallbacks->Add(OnComplete);
+		return true;
+	}
 
-		if (ThumbnailTools::ConditionallyLoadThumbnailsForObjects({ ObjectFullName }, ThumbnailMap))
+	FString FallbackIconPath;
+	if (const FSlateBrush* ThumbnailBrush = FClassIconFinder::FindThumbnailForClass(AssetData.GetClass()))
+	{
+		FallbackIconPath = ThumbnailBrush->GetResourceName().ToString();
+	}
+
+	// Thumbnails have to be loaded on the game thread.
+	FName ObjectFullName = FName(*AssetData.GetFullName());
+	FThumbnailMap ThumbnailMap;
+	FObjectThumbnail* Thumbnail = nullptr;
+	if (ThumbnailTools::ConditionallyLoadThumbnailsForObjects({ ObjectFullName }, ThumbnailMap))
+	{
+		Thumbnail = ThumbnailMap.Find(ObjectFullName);
+	}
+
+	if (Thumbnail && Thumbnail->AccessCompressedImageData().Num())
+	{
+		IImageWrapperModule& ImageWrapperModule = FModuleManager::Get().LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+		const TArray<uint8>& CompressedImageData = Thumbnail->AccessCompressedImageData();
+		const EImageFormat Format = ImageWrapperModule.DetectImageFormat(CompressedImageData.GetData(), CompressedImageData.Num());
+
+		// PNG thumbnails can be served as is.
+		if (Format == EImageFormat::PNG)
 		{
-			if (FObjectThumbnail* Thumbnail = ThumbnailMap.Find(ObjectFullName))
-			{
-				WebRemoteControlInternalUtils::AddContentTypeHeaders(Response.Get(), TEXT("image/png"));
-				IImageWrapperModule& ImageWrapperModule = FModuleManager::Get().LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
-				EImageFormat Format = ImageWrapperModule.DetectImageFormat((void*)Thumbnail->AccessCompressedImageData().GetData(), Thumbnail->AccessCompressedImageData().Num());
-				if (Format == EImageFormat::PNG)
-				{
-					TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(Format);
-					Wrapper->SetRaw(Thumbnail->GetUncompressedImageData().GetData(), Thumbnail->GetUncompressedImageData().Num(), Thumbnail->GetImageWidth(), Thumbnail->GetImageHeight(), ERGBFormat::BGRA, 8);
-					if (Wrapper)
-					{
-						ERGBFormat RGBFormat = Wrapper->GetFormat();
-						Response->Body = Wrapper->GetCompressed();
-						Response->Code = EHttpServerResponseCodes::Ok;
-					}
-				}
-			}
+			ThumbnailCache->Add(CacheKey, ETag, CompressedImageData);
+			WebRemoteControlThumbnailUtils::SendThumbnailResponse(CacheKey, CompressedImageData, ETag, OnComplete);
+			return true;
 		}
 
-		if (!Response->Body.Num())
+		if (Format != EImageFormat::Invalid)
 		{
-			if (const FSlateBrush* ThumbnailBrush = FClassIconFinder::FindThumbnailForClass(AssetData.GetClass()))
+			// Re-encode other formats on a worker thread and respond from the game thread once done.
+			ThumbnailCache->PendingEncodes.Add(PendingEncodeKey).Add(OnComplete);
+
+			TWeakPtr<FThumbnailCache> WeakCache = ThumbnailCache;
+			Async(EAsyncExecution::ThreadPool, [&ImageWrapperModule, WeakCache, CacheKey, ETag, FallbackIconPath, Format, CompressedImageData = TArray<uint8>(CompressedImageData)]()
 			{
-				FName ResourceName = ThumbnailBrush->GetResourceName();
-				if (FFileHelper::LoadFileToArray(Response->Body, *ResourceName.ToString()))
+				TArray<uint8> EncodedThumbnail = WebRemoteControlThumbnailUtils::EncodeThumbnailToPNG(ImageWrapperModule, CompressedImageData, Format);
+				AsyncTask(ENamedThreads::GameThread, [WeakCache, CacheKey, ETag, FallbackIconPath, EncodedThumbnail = MoveTemp(EncodedThumbnail)]() mutable
 				{
-					WebRemoteControlInternalUtils::AddContentTypeHeaders(Response.Get(), TEXT("image/png"));
-					Response->Code = EHttpServerResponseCodes::Ok;
-				}
-			}
+					if (TSharedPtr<FThumbnailCache> Cache = WeakCache.Pin())
+					{
+						if (!EncodedThumbnail.Num() && !FallbackIconPath.IsEmpty())
+						{
+							FFileHelper::LoadFileToArray(EncodedThumbnail, *FallbackIconPath);
+						}
+						Cache->CompletePendingEncode(CacheKey, ETag, MoveTemp(EncodedThumbnail));
+					}
+				});
+			});
+			return true;
 		}
 	}
 
-	if (!Response->Body.Num())
+	TArray<uint8> IconData;
+	if (!FallbackIconPath.IsEmpty() && FFileHelper::LoadFileToArray(IconData, *FallbackIconPath))
 	{
-		WebRemoteControlInternalUtils::CreateUTF8ErrorMessage(FString::Printf(TEXT("Could not load thumbnail for object %s"), *GetThumbnailRequest.ObjectPath), Response->Body);
-		Response->Code = EHttpServerResponseCodes::NotFound;
+		ThumbnailCache->Add(CacheKey, ETag, IconData);
 	}
 
-	OnComplete(MoveTemp(Response));
+	WebRemoteControlThumbnailUtils::SendThumbnailResponse(CacheKey, IconData, ETag, OnComplete);
 	return true;
 }
 
@@ -272,14 +561,15 @@ void FWebRemoteControlEditorRoutes::FRemoteEventDispatcher::Dispatch(UObject* In
 
 void FWebRemoteControlEditorRoutes::FRemoteEventDispatcher::SendResponse(FRemoteEventHook& EventHook)
 {
-	TArray<uint8> WorkingBuffer;
-	FMemoryWriter Writer(WorkingBuffer);
+	static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+	FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+	FMemoryWriter Writer(WorkingBuffer.Get());
 	FJsonStructSerializerBackend SerializerBackend(Writer, EStructSerializerBackendFlags::Default);
 
 	if (IRemoteControlModule::Get().GetObjectProperties(EventHook.ObjectRef, SerializerBackend))
 	{
 		EventHook.Response->Code = EHttpServerResponseCodes::Ok;
-		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, EventHook.Response->Body);
+		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), EventHook.Response->Body);
 	}
 	else
 	{
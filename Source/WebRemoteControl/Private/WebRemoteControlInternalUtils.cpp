@@ -2,14 +2,57 @@
 
 #include "WebRemoteControlInternalUtils.h"
 
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 #include "HttpServerRequest.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Misc/Base64.h"
+#include "PlatformCrypto.h"
 #include "PlatformHttp.h"
 #include "RemoteControlSettings.h"
 #include "Serialization/JsonReader.h"
 #include "UObject/StructOnScope.h"
 
+static TAutoConsoleVariable<int32> CVarWebControlSessionTokenLifetime(
+	TEXT("WebControl.SessionTokenLifetime"),
+	900,
+	TEXT("Number of seconds a session token created through /remote/session stays valid for.")
+);
+
+namespace WebRemoteControlSessionTokenUtils
+{
+	/** A session token handed out to a client that provided a valid passphrase. */
+	struct FSessionToken
+	{
+		/** Time at which the token expires, in FPlatformTime::Seconds. */
+		double ExpirationTime = 0.0;
+		/** Client access settings version the token was created under, tokens are revoked when those settings change. */
+		uint32 ClientAccessVersion = 0;
+	};
+
+	/** Session tokens that are currently valid. */
+	TMap<FString, FSessionToken> SessionTokens;
+
+	/** Time at which expired tokens were last removed from the table. */
+	double LastPruneTime = 0.0;
+
+	/** Number of random bytes in a session token. */
+	constexpr int32 SessionTokenNumBytes = 32;
+
+	void PruneExpiredTokens(double CurrentTime)
+	{
+		const uint32 ClientAccessVersion = GetDefault<URemoteControlSettings>()->GetClientAccessVersion();
+		for (TMap<FString, FSessionToken>::TIterator It = SessionTokens.CreateIterator(); It; ++It)
+		{
+			if (It->Value.ExpirationTime <= CurrentTime || It->Value.ClientAccessVersion != ClientAccessVersion)
+			{
+				It.RemoveCurrent();
+			}
+		}
+		LastPruneTime = CurrentTime;
+	}
+}
+
 namespace RemotePayloadSerializer
 {
 FName NAME_Get = "GET";
@@ -69,6 +112,27 @@ EHttpServerRequestVerbs ParseHttpVerb(FName InVerb)
 	}
 }
 
+FName GetHttpVerbName(EHttpServerRequestVerbs InVerb)
+{
+	switch (InVerb)
+	{
+	case EHttpServerRequestVerbs::VERB_GET:
+		return NAME_Get;
+	case EHttpServerRequestVerbs::VERB_POST:
+		return NAME_Post;
+	case EHttpServerRequestVerbs::VERB_PUT:
+		return NAME_Put;
+	case EHttpServerRequestVerbs::VERB_PATCH:
+		return NAME_Patch;
+	case EHttpServerRequestVerbs::VERB_DELETE:
+		return NAME_Delete;
+	case EHttpServerRequestVerbs::VERB_OPTIONS:
+		return NAME_Options;
+	default:
+		return NAME_None;
+	}
+}
+
 TSharedRef<FHttpServerRequest> UnwrapHttpRequest(const FRCRequestWrapper& Wrapper, const FHttpServerRequest* TemplateRequest)
 {
 	TSharedRef<FHttpServerRequest> WrappedHttpRequest = MakeShared<FHttpServerRequest>();
@@ -658,3 +722,75 @@ bool WebRemoteControlInternalUtils::CheckPassphrase(const FString& HashedPassphr
 
 	return bOutResult;
 }
+
+FString WebRemoteControlInternalUtils::CreateSessionToken(int32& OutLifetimeSeconds)
+{
+	using namespace WebRemoteControlSessionTokenUtils;
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	OutLifetimeSeconds = FMath::Max(CVarWebControlSessionTokenLifetime.GetValueOnAnyThread(), 1);
+
+	// Expired tokens are only removed lazily, do it when creating new ones so the table doesn't grow unbounded.
+	if (CurrentTime - LastPruneTime > OutLifetimeSeconds)
+	{
+		PruneExpiredTokens(CurrentTime);
+	}
+
+	// Tokens stand in for the passphrase, so they must come from a cryptographically secure source.
+	uint8 TokenBytes[SessionTokenNumBytes];
+	TUniquePtr<FEncryptionContext> EncryptionContext = IPlatformCrypto::Get().CreateContext();
+	if (!EncryptionContext.IsValid() || EncryptionContext->CreateRandomBytes(MakeArrayView(TokenBytes)) != EPlatformCryptoResult::Success)
+	{
+		OutLifetimeSeconds = 0;
+		return FString();
+	}
+
+	const FString SessionToken = BytesToHex(TokenBytes, SessionTokenNumBytes);
+	SessionTokens.Add(SessionToken, FSessionToken{ CurrentTime + OutLifetimeSeconds, GetDefault<URemoteControlSettings>()->GetClientAccessVersion() });
+	return SessionToken;
+}
+
+void WebRemoteControlInternalUtils::RevokeSessionToken(const FString& SessionToken)
+{
+	WebRemoteControlSessionTokenUtils::SessionTokens.Remove(SessionToken);
+}
+
+bool WebRemoteControlInternalUtils::CheckSessionToken(const FString& SessionToken)
+{
+	using namespace WebRemoteControlSessionTokenUtils;
+
+	if (SessionToken.IsEmpty())
+	{
+		return false;
+	}
+
+	const FSessionToken* Token = SessionTokens.Find(SessionToken);
+	if (!Token)
+	{
+		return false;
+	}
+
+	if (Token->ExpirationTime <= FPlatformTime::Seconds() || Token->ClientAccessVersion != GetDefault<URemoteControlSettings>()->GetClientAccessVersion())
+	{
+		SessionTokens.Remove(SessionToken);
+		return false;
+	}
+
+	return true;
+}
+
+const FString* WebRemoteControlInternalUtils::FindValidSessionToken(const FHttpServerRequest& Request)
+{
+	const TArray<FString>* SessionTokenHeaderValues = Request.Headers.Find(SessionTokenHeader);
+	if (SessionTokenHeaderValues && SessionTokenHeaderValues->Num() && CheckSessionToken(SessionTokenHeaderValues->Last()))
+	{
+		return &SessionTokenHeaderValues->Last();
+	}
+
+	return nullptr;
+}
+
+bool WebRemoteControlInternalUtils::HasValidSessionToken(const FHttpServerRequest& Request)
+{
+	return !!FindValidSessionToken(Request);
+}
@@ -0,0 +1,312 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlMetrics.h"
+
+#include "Misc/StringBuilder.h"
+
+namespace WebRemoteControlMetricsUtils
+{
+	/** Quantiles reported for every histogram. */
+	constexpr double Quantiles[] = { 0.5, 0.99, 0.999 };
+
+	void AppendEscapedLabel(FStringBuilderBase& OutText, const FString& InLabel)
+	{
+		for (TCHAR Character : InLabel)
+		{
+			if (Character == TCHAR('\\') || Character == TCHAR('"'))
+			{
+				OutText.AppendChar(TCHAR('\\'));
+			}
+			OutText.AppendChar(Character);
+		}
+	}
+
+	void AppendLabels(FStringBuilderBase& OutText, const TCHAR* InLabelName, const FString* InLabelValue, const TCHAR* InQuantile = nullptr)
+	{
+		if (!InLabelValue && !InQuantile)
+		{
+			return;
+		}
+
+		OutText << TEXT("{");
+		if (InLabelValue)
+		{
+			OutText << InLabelName << TEXT("=\"");
+			AppendEscapedLabel(OutText, *InLabelValue);
+			OutText << TEXT("\"");
+		}
+		if (InQuantile)
+		{
+			OutText << (InLabelValue ? TEXT(",") : TEXT("")) << TEXT("quantile=\"") << InQuantile << TEXT("\"");
+		}
+		OutText << TEXT("}");
+	}
+
+	void WriteHeader(FStringBuilderBase& OutText, const TCHAR* InName, const TCHAR* InType, const TCHAR* InHelp)
+	{
+		OutText.Appendf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), InName, InHelp, InName, InType);
+	}
+
+	void WriteCounter(FStringBuilderBase& OutText, const TCHAR* InName, const TCHAR* InLabelName, const FString* InLabelValue, uint64 InValue)
+	{
+		OutText << InName;
+		AppendLabels(OutText, InLabelName, InLabelValue);
+		OutText.Appendf(TEXT(" %llu\n"), InValue);
+	}
+
+	/**
+	 * Write a histogram as a Prometheus summary.
+	 * @param InScale Factor applied to the recorded values, used to convert microseconds to seconds.
+	 */
+	void WriteSummary(FStringBuilderBase& OutText, const TCHAR* InName, const TCHAR* InLabelName, const FString* InLabelValue, const FRCMetricsHistogram& InHistogram, double InScale)
+	{
+		for (double Quantile : Quantiles)
+		{
+			OutText << InName;
+			AppendLabels(OutText, InLabelName, InLabelValue, *FString::SanitizeFloat(Quantile));
+			OutText.Appendf(TEXT(" %.9g\n"), InHistogram.GetPercentile(Quantile) * InScale);
+		}
+
+		OutText << InName << TEXT("_sum");
+		AppendLabels(OutText, InLabelName, InLabelValue);
+		OutText.Appendf(TEXT(" %.9g\n"), InHistogram.GetSum() * InScale);
+
+		OutText << InName << TEXT("_count");
+		AppendLabels(OutText, InLabelName, InLabelValue);
+		OutText.Appendf(TEXT(" %llu\n"), InHistogram.GetCount());
+	}
+
+	/** Write the metrics of a family of routes, skipping the routes that were never requested. */
+	void WriteRoutes(FStringBuilderBase& OutText, const TCHAR* InPrefix, const TCHAR* InLabelName, const TMap<FString, TUniquePtr<FWebRemoteControlMetrics::FRouteMetrics>>& InRoutes, bool bWriteResponses)
+	{
+		TArray<TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>> ActiveRoutes;
+		for (const TPair<FString, TUniquePtr<FWebRemoteControlMetrics::FRouteMetrics>>& Pair : InRoutes)
+		{
+			if (Pair.Value->Requests.load(std::memory_order_relaxed) > 0)
+			{
+				ActiveRoutes.Emplace(&Pair.Key, Pair.Value.Get());
+			}
+		}
+
+		ActiveRoutes.Sort([](const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& A, const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& B)
+		{
+			return *A.Key < *B.Key;
+		});
+
+		const FString RequestsName = FString::Printf(TEXT("%s_requests_total"), InPrefix);
+		WriteHeader(OutText, *RequestsName, TEXT("counter"), TEXT("Number of requests handled."));
+		for (const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& Route : ActiveRoutes)
+		{
+			WriteCounter(OutText, *RequestsName, InLabelName, Route.Key, Route.Value->Requests.load(std::memory_order_relaxed));
+		}
+
+		const FString ErrorsName = FString::Printf(TEXT("%s_errors_total"), InPrefix);
+		WriteHeader(OutText, *ErrorsName, TEXT("counter"), TEXT("Number of requests that were responded to with an error."));
+		for (const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& Route : ActiveRoutes)
+		{
+			WriteCounter(OutText, *ErrorsName, InLabelName, Route.Key, Route.Value->Errors.load(std::memory_order_relaxed));
+		}
+
+		const FString LatencyName = FString::Printf(TEXT("%s_duration_seconds"), InPrefix);
+		WriteHeader(OutText, *LatencyName, TEXT("summary"), TEXT("Time taken to handle requests."));
+		for (const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& Route : ActiveRoutes)
+		{
+			WriteSummary(OutText, *LatencyName, InLabelName, Route.Key, Route.Value->Latency, 1e-6);
+		}
+
+		const FString RequestSizeName = FString::Printf(TEXT("%s_request_size_bytes"), InPrefix);
+		WriteHeader(OutText, *RequestSizeName, TEXT("summary"), TEXT("Size of the request payloads."));
+		for (const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& Route : ActiveRoutes)
+		{
+			WriteSummary(OutText, *RequestSizeName, InLabelName, Route.Key, Route.Value->RequestSize, 1.0);
+		}
+
+		if (bWriteResponses)
+		{
+			const FString ResponseSizeName = FString::Printf(TEXT("%s_response_size_bytes"), InPrefix);
+			WriteHeader(OutText, *ResponseSizeName, TEXT("summary"), TEXT("Size of the response payloads."));
+			for (const TPair<const FString*, const FWebRemoteControlMetrics::FRouteMetrics*>& Route : ActiveRoutes)
+			{
+				WriteSummary(OutText, *ResponseSizeName, InLabelName, Route.Key, Route.Value->ResponseSize, 1.0);
+			}
+		}
+	}
+}
+
+void FRCMetricsHistogram::Record(uint64 InValue)
+{
+	Buckets[GetBucketIndex(InValue)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+	Sum.fetch_add(InValue, std::memory_order_relaxed);
+}
+
+uint64 FRCMetricsHistogram::GetPercentile(double InFraction) const
+{
+	const uint64 TotalCount = GetCount();
+	if (TotalCount == 0)
+	{
+		return 0;
+	}
+
+	const uint64 TargetCount = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(InFraction, 0.0, 1.0) * TotalCount)));
+
+	uint64 CumulativeCount = 0;
+	int32 LastNonEmptyBucket = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		const uint64 BucketCount = Buckets[BucketIndex].load(std::memory_order_relaxed);
+		if (BucketCount == 0)
+		{
+			continue;
+		}
+
+		LastNonEmptyBucket = BucketIndex;
+		CumulativeCount += BucketCount;
+		if (CumulativeCount >= TargetCount)
+		{
+			return GetBucketValue(BucketIndex);
+		}
+	}
+
+	// Values recorded while iterating can make the count go out of sync with the buckets.
+	return GetBucketValue(LastNonEmptyBucket);
+}
+
+void FRCMetricsHistogram::Reset()
+{
+	for (std::atomic<uint64>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	Sum.store(0, std::memory_order_relaxed);
+}
+
+int32 FRCMetricsHistogram::GetBucketIndex(uint64 InValue)
+{
+	InValue = FMath::Min(InValue, (uint64(1) << MaxValueBits) - 1);
+	if (InValue < NumSubBuckets)
+	{
+		return static_cast<int32>(InValue);
+	}
+
+	// The top SubBucketBits bits below the most significant one select the sub-bucket.
+	const int32 Shift = static_cast<int32>(FMath::FloorLog2_64(InValue)) - SubBucketBits;
+	return (Shift + 1) * NumSubBuckets + static_cast<int32>(InValue >> Shift) - NumSubBuckets;
+}
+
+uint64 FRCMetricsHistogram::GetBucketValue(int32 InBucketIndex)
+{
+	if (InBucketIndex < NumSubBuckets)
+	{
+		return InBucketIndex;
+	}
+
+	const int32 Shift = InBucketIndex / NumSubBuckets - 1;
+	const uint64 LowerBound = static_cast<uint64>(InBucketIndex % NumSubBuckets + NumSubBuckets) << Shift;
+	return LowerBound + ((uint64(1) << Shift) >> 1);
+}
+
+FWebRemoteControlMetrics& FWebRemoteControlMetrics::Get()
+{
+	static FWebRemoteControlMetrics Metrics;
+	return Metrics;
+}
+
+FWebRemoteControlMetrics::FRouteMetrics& FWebRemoteControlMetrics::FindOrAddHttpRoute(const FString& InRouteName)
+{
+	return FindOrAddRoute(HttpRoutes, InRouteName);
+}
+
+FWebRemoteControlMetrics::FRouteMetrics& FWebRemoteControlMetrics::FindOrAddWebSocketRoute(const FString& InMessageName)
+{
+	return FindOrAddRoute(WebSocketRoutes, InMessageName);
+}
+
+FWebRemoteControlMetrics::FRouteMetrics& FWebRemoteControlMetrics::FindOrAddRoute(TMap<FString, TUniquePtr<FRouteMetrics>>& InRoutes, const FString& InName)
+{
+	FWriteScopeLock Lock(RoutesLock);
+
+	TUniquePtr<FRouteMetrics>& RouteMetrics = InRoutes.FindOrAdd(InName);
+	if (!RouteMetrics)
+	{
+		RouteMetrics = MakeUnique<FRouteMetrics>();
+	}
+	return *RouteMetrics;
+}
+
+void FWebRemoteControlMetrics::WritePrometheus(FStringBuilderBase& OutText) const
+{
+	using namespace WebRemoteControlMetricsUtils;
+
+	{
+		FReadScopeLock Lock(RoutesLock);
+		WriteRoutes(OutText, TEXT("webrc_http"), TEXT("route"), HttpRoutes, true);
+		WriteRoutes(OutText, TEXT("webrc_websocket"), TEXT("message"), WebSocketRoutes, false);
+	}
+
+	WriteHeader(OutText, TEXT("webrc_serialization_duration_seconds"), TEXT("summary"), TEXT("Time spent serializing messages to JSON."));
+	WriteSummary(OutText, TEXT("webrc_serialization_duration_seconds"), nullptr, nullptr, SerializationTime, 1e-6);
+
+	WriteHeader(OutText, TEXT("webrc_event_fanout_clients"), TEXT("summary"), TEXT("Number of clients a websocket event is sent to."));
+	WriteSummary(OutText, TEXT("webrc_event_fanout_clients"), nullptr, nullptr, EventFanOut, 1.0);
+
+	WriteHeader(OutText, TEXT("webrc_websocket_compression_ratio"), TEXT("summary"), TEXT("Size of compressed websocket messages relative to their uncompressed size."));
+	WriteSummary(OutText, TEXT("webrc_websocket_compression_ratio"), nullptr, nullptr, CompressionRatio, 1e-3);
+
+	WriteHeader(OutText, TEXT("webrc_websocket_uncompressed_bytes_total"), TEXT("counter"), TEXT("Size of the websocket messages sent to clients using compression, before compressing them."));
+	WriteCounter(OutText, TEXT("webrc_websocket_uncompressed_bytes_total"), nullptr, nullptr, UncompressedBytes.load(std::memory_order_relaxed));
+
+	WriteHeader(OutText, TEXT("webrc_websocket_compressed_bytes_total"), TEXT("counter"), TEXT("Size of the websocket messages sent to clients using compression, after compressing them."));
+	WriteCounter(OutText, TEXT("webrc_websocket_compressed_bytes_total"), nullptr, nullptr, CompressedBytes.load(std::memory_order_relaxed));
+
+	WriteHeader(OutText, TEXT("webrc_end_frame_duration_seconds"), TEXT("summary"), TEXT("Time spent sending websocket events at the end of a frame."));
+	WriteSummary(OutText, TEXT("webrc_end_frame_duration_seconds"), nullptr, nullptr, EndFrameTime, 1e-6);
+
+	WriteHeader(OutText, TEXT("webrc_websocket_server_tick_duration_seconds"), TEXT("summary"), TEXT("Time spent ticking the websocket server in a frame."));
+	WriteSummary(OutText, TEXT("webrc_websocket_server_tick_duration_seconds"), nullptr, nullptr, WebSocketServerTickTime, 1e-6);
+
+	WriteHeader(OutText, TEXT("webrc_pooled_buffer_hits_total"), TEXT("counter"), TEXT("Number of payload buffers reused from a thread's pool."));
+	WriteCounter(OutText, TEXT("webrc_pooled_buffer_hits_total"), nullptr, nullptr, PooledBufferHits.load(std::memory_order_relaxed));
+
+	WriteHeader(OutText, TEXT("webrc_pooled_buffer_misses_total"), TEXT("counter"), TEXT("Number of payload buffers allocated because a thread's pool had none."));
+	WriteCounter(OutText, TEXT("webrc_pooled_buffer_misses_total"), nullptr, nullptr, PooledBufferMisses.load(std::memory_order_relaxed));
+
+	WriteHeader(OutText, TEXT("webrc_pooled_buffer_bytes"), TEXT("gauge"), TEXT("Capacity of the pooled payload buffers currently in use."));
+	WriteCounter(OutText, TEXT("webrc_pooled_buffer_bytes"), nullptr, nullptr, PooledBufferBytesInUse.load(std::memory_order_relaxed));
+
+	WriteHeader(OutText, TEXT("webrc_pooled_buffer_peak_bytes"), TEXT("gauge"), TEXT("Most capacity of pooled payload buffers in use at once."));
+	WriteCounter(OutText, TEXT("webrc_pooled_buffer_peak_bytes"), nullptr, nullptr, PooledBufferPeakBytes.load(std::memory_order_relaxed));
+
+	WriteHeader(OutText, TEXT("webrc_pooled_buffer_idle_bytes"), TEXT("gauge"), TEXT("Capacity of the free payload buffers kept in the threads' pools."));
+	WriteCounter(OutText, TEXT("webrc_pooled_buffer_idle_bytes"), nullptr, nullptr, PooledBufferIdleBytes.load(std::memory_order_relaxed));
+}
+
+void FWebRemoteControlMetrics::Reset()
+{
+	{
+		FReadScopeLock Lock(RoutesLock);
+		for (TMap<FString, TUniquePtr<FRouteMetrics>>* Routes : { &HttpRoutes, &WebSocketRoutes })
+		{
+			for (TPair<FString, TUniquePtr<FRouteMetrics>>& Pair : *Routes)
+			{
+				Pair.Value->Requests.store(0, std::memory_order_relaxed);
+				Pair.Value->Errors.store(0, std::memory_order_relaxed);
+				Pair.Value->Latency.Reset();
+				Pair.Value->RequestSize.Reset();
+				Pair.Value->ResponseSize.Reset();
+			}
+		}
+	}
+
+	SerializationTime.Reset();
+	EventFanOut.Reset();
+	CompressionRatio.Reset();
+	UncompressedBytes.store(0, std::memory_order_relaxed);
+	CompressedBytes.store(0, std::memory_order_relaxed);
+	EndFrameTime.Reset();
+	WebSocketServerTickTime.Reset();
+	PooledBufferHits.store(0, std::memory_order_relaxed);
+	PooledBufferMisses.store(0, std::memory_order_relaxed);
+	PooledBufferPeakBytes.store(PooledBufferBytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
@@ -0,0 +1,365 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlRequestLog.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "INetworkingWebSocket.h"
+#include "Misc/Crc.h"
+#include "WebRemoteControlUtils.h"
+#include "WebSocketNetworkingDelegates.h"
+
+static TAutoConsoleVariable<bool> CVarWebRemoteControlRequestLogEnable(
+	TEXT("WebControl.RequestLog.Enable"),
+	false,
+	TEXT("Record requests in the request log even when it isn't streamed, so the latest ones can be dumped with WebControl.RequestLog.StartFile.")
+);
+
+static TAutoConsoleVariable<float> CVarWebRemoteControlRequestLogSampleRate(
+	TEXT("WebControl.RequestLog.SampleRate"),
+	1.0f,
+	TEXT("Fraction of the requests recorded in the request log, between 0 and 1.")
+);
+
+static TAutoConsoleVariable<int32> CVarWebRemoteControlRequestLogCapacity(
+	TEXT("WebControl.RequestLog.Capacity"),
+	8192,
+	TEXT("Number of records held by the request log ring buffer, rounded up to a power of two. Read when the module starts."),
+	ECVF_ReadOnly
+);
+
+namespace WebRemoteControlRequestLogUtils
+{
+	void WriteChunkHeader(FWebRemoteControlRequestLog::EChunkType ChunkType, uint32 Count, TArray<uint8>& OutChunk)
+	{
+		uint32 Header[2] = { static_cast<uint32>(ChunkType), Count };
+		OutChunk.Append(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+	}
+}
+
+FWebRemoteControlRequestLog::FWebRemoteControlRequestLog()
+{
+	const uint64 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(CVarWebRemoteControlRequestLogCapacity.GetValueOnAnyThread(), 64));
+	Slots = MakeUnique<FSlot[]>(Capacity);
+	SlotMask = Capacity - 1;
+}
+
+FWebRemoteControlRequestLog::~FWebRemoteControlRequestLog()
+{
+	FTSTicker::RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	StopFile();
+	FilePipe.WaitUntilEmpty();
+}
+
+bool FWebRemoteControlRequestLog::ShouldLogRequest(const FGuid& InClientId, int32 InRequestId) const
+{
+	if (!CVarWebRemoteControlRequestLogEnable.GetValueOnAnyThread() && !HasStreams())
+	{
+		return false;
+	}
+
+	const float SampleRate = CVarWebRemoteControlRequestLogSampleRate.GetValueOnAnyThread();
+	if (SampleRate >= 1.0f)
+	{
+		return true;
+	}
+
+	// Hash the request rather than drawing a random number so every stage of a request gets the same decision.
+	const uint32 Hash = HashCombineFast(GetTypeHash(InClientId), ::GetTypeHash(InRequestId) * 0x9E3779B1u);
+	return Hash < static_cast<uint32>(FMath::Clamp(SampleRate, 0.0f, 1.0f) * static_cast<float>(MAX_uint32));
+}
+
+uint32 FWebRemoteControlRequestLog::GetRouteId(FStringView InRoute)
+{
+	int32 QueryParamsIndex = INDEX_NONE;
+	if (InRoute.FindChar(TCHAR('?'), QueryParamsIndex))
+	{
+		InRoute.LeftInline(QueryParamsIndex);
+	}
+
+	const uint32 RouteId = FCrc::MemCrc32(InRoute.GetData(), InRoute.Len() * sizeof(TCHAR));
+	if (!RouteNames.Contains(RouteId))
+	{
+		RouteNames.Add(RouteId, FString(InRoute));
+		PendingRouteNames.Add(RouteId);
+	}
+	return RouteId;
+}
+
+void FWebRemoteControlRequestLog::Log(ERCRequestLogStage InStage, uint32 InRouteId, const FGuid& InClientId, int32 InRequestId, uint32 InDurationMicroseconds, uint32 InPayloadSize)
+{
+	const uint64 Index = WriteIndex.fetch_add(1, std::memory_order_relaxed);
+	FSlot& Slot = Slots[Index & SlotMask];
+
+	// Mark the slot as being written so a concurrent drain doesn't read a partial record.
+	Slot.Sequence.store(Index * 2 + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	FRCRequestLogRecord& Record = Slot.Record;
+	Record.Timestamp = FPlatformTime::Seconds();
+	Record.ClientId = InClientId;
+	Record.RouteId = InRouteId;
+	Record.RequestId = InRequestId;
+	Record.Frame = GFrameNumber;
+	Record.DurationMicroseconds = InDurationMicroseconds;
+	Record.PayloadSize = InPayloadSize;
+	Record.Stage = InStage;
+
+	Slot.Sequence.store(Index * 2 + 2, std::memory_order_release);
+}
+
+void FWebRemoteControlRequestLog::SetWebSocketConnection(TSharedPtr<INetworkingWebSocket> InWebSocketConnection)
+{
+	WebSocketConnection = MoveTemp(InWebSocketConnection);
+	bIsWebSocketConnected = false;
+
+	if (WebSocketConnection)
+	{
+		FWebSocketInfoCallBack ConnectedCallback;
+		ConnectedCallback.BindLambda([this]()
+		{
+			bIsWebSocketConnected = true;
+
+			// The server needs the names of the routes that were sent before it connected.
+			TArray<uint8> RouteNamesChunk;
+			WriteRouteNamesChunk(true, RouteNamesChunk);
+			WebSocketConnection->Send(RouteNamesChunk.GetData(), RouteNamesChunk.Num(), false);
+		});
+		WebSocketConnection->SetConnectedCallBack(ConnectedCallback);
+
+		FWebSocketInfoCallBack ClosedCallback;
+		ClosedCallback.BindLambda([this]()
+		{
+			bIsWebSocketConnected = false;
+		});
+		WebSocketConnection->SetSocketClosedCallBack(ClosedCallback);
+	}
+
+	UpdateTicker();
+}
+
+bool FWebRemoteControlRequestLog::StartFile(const FString& InFilename)
+{
+	StopFile();
+
+	// Without streams the ring buffer isn't drained, skip the records that have since been overwritten.
+	if (!HasStreams())
+	{
+		const uint64 Capacity = SlotMask + 1;
+		const uint64 CurrentWriteIndex = WriteIndex.load(std::memory_order_acquire);
+		if (CurrentWriteIndex - ReadIndex > Capacity)
+		{
+			ReadIndex = CurrentWriteIndex - Capacity;
+		}
+	}
+
+	TSharedPtr<FArchive> NewFileWriter = MakeShareable(IFileManager::Get().CreateFileWriter(*InFilename));
+	if (!NewFileWriter)
+	{
+		return false;
+	}
+
+	uint32 FileHeader[2] = { FileMagic, FileVersion };
+	NewFileWriter->Serialize(FileHeader, sizeof(FileHeader));
+
+	TArray<uint8> RouteNamesChunk;
+	WriteRouteNamesChunk(true, RouteNamesChunk);
+
+	FilePipe.Launch(UE_SOURCE_LOCATION, [this, NewFileWriter, RouteNamesChunk = MoveTemp(RouteNamesChunk)]() mutable
+	{
+		FileWriter = MoveTemp(NewFileWriter);
+		WriteToFile(MoveTemp(RouteNamesChunk));
+	});
+	bIsWritingFile = true;
+
+	// Records still held in the ring buffer are drained to the file on the next tick.
+	UpdateTicker();
+	return true;
+}
+
+void FWebRemoteControlRequestLog::StopFile()
+{
+	if (!bIsWritingFile)
+	{
+		return;
+	}
+
+	Drain();
+	bIsWritingFile = false;
+
+	FilePipe.Launch(UE_SOURCE_LOCATION, [this]()
+	{
+		if (FileWriter)
+		{
+			FileWriter->Close();
+			FileWriter.Reset();
+		}
+	});
+
+	UpdateTicker();
+}
+
+bool FWebRemoteControlRequestLog::OnTick(float DeltaSeconds)
+{
+	if (WebSocketConnection)
+	{
+		WebSocketConnection->Tick();
+	}
+
+	Drain();
+	return true;
+}
+
+void FWebRemoteControlRequestLog::Drain()
+{
+	using namespace WebRemoteControlRequestLogUtils;
+
+	const uint64 Capacity = SlotMask + 1;
+	const uint64 EndIndex = WriteIndex.load(std::memory_order_acquire);
+
+	uint32 DroppedRecords = 0;
+	if (EndIndex - ReadIndex > Capacity)
+	{
+		DroppedRecords = static_cast<uint32>(FMath::Min<uint64>(EndIndex - Capacity - ReadIndex, MAX_uint32));
+		ReadIndex = EndIndex - Capacity;
+	}
+
+	if (!HasStreams())
+	{
+		// Nothing to send to, leave the records in the ring buffer in case a file is started.
+		return;
+	}
+
+	if (PendingRouteNames.Num())
+	{
+		TArray<uint8> RouteNamesChunk;
+		WriteRouteNamesChunk(false, RouteNamesChunk);
+		SendChunk(MoveTemp(RouteNamesChunk));
+	}
+
+	if (ReadIndex == EndIndex && DroppedRecords == 0)
+	{
+		return;
+	}
+
+	TArray<uint8> RecordsChunk;
+	RecordsChunk.Reserve(sizeof(uint32) * 2 + (EndIndex - ReadIndex) * sizeof(FRCRequestLogRecord));
+	WriteChunkHeader(EChunkType::Records, 0, RecordsChunk);
+
+	uint32 NumRecords = 0;
+	for (; ReadIndex < EndIndex; ++ReadIndex)
+	{
+		const FSlot& Slot = Slots[ReadIndex & SlotMask];
+		const uint64 WrittenSequence = ReadIndex * 2 + 2;
+		const uint64 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+		if (Sequence < WrittenSequence)
+		{
+			// The slot still holds the previous lap or the record is being written, pick it up on the next drain.
+			break;
+		}
+
+		if (Sequence > WrittenSequence)
+		{
+			// A writer lapped the drain and overwrote the record.
+			DroppedRecords++;
+			continue;
+		}
+
+		const FRCRequestLogRecord Record = Slot.Record;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Sequence.load(std::memory_order_relaxed) != Sequence)
+		{
+			// Overwritten by a newer record while being read.
+			DroppedRecords++;
+			continue;
+		}
+
+		RecordsChunk.Append(reinterpret_cast<const uint8*>(&Record), sizeof(Record));
+		NumRecords++;
+	}
+
+	if (NumRecords)
+	{
+		FMemory::Memcpy(RecordsChunk.GetData() + sizeof(uint32), &NumRecords, sizeof(NumRecords));
+		SendChunk(MoveTemp(RecordsChunk));
+	}
+
+	if (DroppedRecords)
+	{
+		TArray<uint8> DroppedChunk;
+		WriteChunkHeader(EChunkType::Dropped, DroppedRecords, DroppedChunk);
+		SendChunk(MoveTemp(DroppedChunk));
+	}
+}
+
+void FWebRemoteControlRequestLog::WriteRouteNamesChunk(bool bAllRoutes, TArray<uint8>& OutChunk)
+{
+	using namespace WebRemoteControlRequestLogUtils;
+
+	TArray<uint32> RouteIds;
+	if (bAllRoutes)
+	{
+		RouteNames.GetKeys(RouteIds);
+	}
+	else
+	{
+		RouteIds = MoveTemp(PendingRouteNames);
+	}
+	PendingRouteNames.Reset();
+
+	WriteChunkHeader(EChunkType::RouteNames, RouteIds.Num(), OutChunk);
+	for (uint32 RouteId : RouteIds)
+	{
+		TArray<uint8> UTF8Name;
+		WebRemoteControlUtils::ConvertToUTF8(RouteNames.FindChecked(RouteId), UTF8Name);
+
+		uint32 RouteHeader[2] = { RouteId, static_cast<uint32>(UTF8Name.Num()) };
+		OutChunk.Append(reinterpret_cast<const uint8*>(RouteHeader), sizeof(RouteHeader));
+		OutChunk.Append(UTF8Name);
+	}
+}
+
+void FWebRemoteControlRequestLog::SendChunk(TArray<uint8>&& InChunk)
+{
+	if (WebSocketConnection && bIsWebSocketConnected)
+	{
+		WebSocketConnection->Send(InChunk.GetData(), InChunk.Num(), false);
+	}
+
+	if (bIsWritingFile)
+	{
+		FilePipe.Launch(UE_SOURCE_LOCATION, [this, Chunk = MoveTemp(InChunk)]() mutable
+		{
+			WriteToFile(MoveTemp(Chunk));
+		});
+	}
+}
+
+void FWebRemoteControlRequestLog::WriteToFile(TArray<uint8>&& InChunk)
+{
+	if (FileWriter)
+	{
+		FileWriter->Serialize(InChunk.GetData(), InChunk.Num());
+	}
+}
+
+bool FWebRemoteControlRequestLog::HasStreams() const
+{
+	return WebSocketConnection.IsValid() || bIsWritingFile;
+}
+
+void FWebRemoteControlRequestLog::UpdateTicker()
+{
+	if (HasStreams() && !TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FWebRemoteControlRequestLog::OnTick));
+	}
+	else if (!HasStreams() && TickerHandle.IsValid())
+	{
+		FTSTicker::RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
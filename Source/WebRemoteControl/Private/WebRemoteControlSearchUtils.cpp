@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlSearchUtils.h"
+
+namespace WebRemoteControlSearchUtils
+{
+	constexpr int32 ExactMatchScore = 1000;
+	constexpr int32 PrefixMatchScore = 800;
+	constexpr int32 TokenPrefixMatchScore = 600;
+	constexpr int32 SubstringMatchScore = 400;
+	constexpr int32 FuzzyMatchScore = 300;
+	constexpr int32 MaxLengthPenalty = 99;
+
+	int32 ApplyLengthPenalty(int32 InScore, const FString& InName, const FString& InQuery)
+	{
+		return FMath::Max(InScore - FMath::Clamp(InName.Len() - InQuery.Len(), 0, MaxLengthPenalty), 1);
+	}
+}
+
+bool WebRemoteControlSearchUtils::IsTokenStart(const FString& InName, int32 InIndex)
+{
+	if (InIndex == 0)
+	{
+		return true;
+	}
+
+	const TCHAR Previous = InName[InIndex - 1];
+	const TCHAR Current = InName[InIndex];
+	if (Previous == TEXT('_') || Previous == TEXT('-') || Previous == TEXT(' ') || Previous == TEXT('.'))
+	{
+		return true;
+	}
+
+	return (FChar::IsUpper(Current) && FChar::IsLower(Previous))
+		|| (FChar::IsDigit(Current) && !FChar::IsDigit(Previous))
+		|| (FChar::IsAlpha(Current) && FChar::IsDigit(Previous));
+}
+
+void WebRemoteControlSearchUtils::GetTrigrams(const FString& InName, TArray<uint64>& OutTrigrams)
+{
+	auto ToKey = [](TCHAR Character) { return (uint64)(FChar::ToLower(Character) & 0x1FFFFF); };
+
+	for (int32 Index = 0; Index + 2 < InName.Len(); ++Index)
+	{
+		OutTrigrams.AddUnique((ToKey(InName[Index]) << 42) | (ToKey(InName[Index + 1]) << 21) | ToKey(InName[Index + 2]));
+	}
+}
+
+int32 WebRemoteControlSearchUtils::ScoreName(const FString& InName, const FString& InQuery, bool bPrefixOnly)
+{
+	if (InQuery.IsEmpty())
+	{
+		return SubstringMatchScore;
+	}
+
+	if (InName.Equals(InQuery, ESearchCase::IgnoreCase))
+	{
+		return ExactMatchScore;
+	}
+
+	int32 BestScore = 0;
+	int32 MatchIndex = InName.Find(InQuery, ESearchCase::IgnoreCase);
+	while (MatchIndex != INDEX_NONE)
+	{
+		int32 Score = SubstringMatchScore;
+		if (MatchIndex == 0)
+		{
+			Score = PrefixMatchScore;
+		}
+		else if (IsTokenStart(InName, MatchIndex))
+		{
+			Score = TokenPrefixMatchScore;
+		}
+		else if (bPrefixOnly)
+		{
+			Score = 0;
+		}
+
+		BestScore = FMath::Max(BestScore, Score);
+		if (BestScore == PrefixMatchScore)
+		{
+			break;
+		}
+
+		MatchIndex = InName.Find(InQuery, ESearchCase::IgnoreCase, ESearchDir::FromStart, MatchIndex + 1);
+	}
+
+	return BestScore > 0 ? ApplyLengthPenalty(BestScore, InName, InQuery) : 0;
+}
+
+int32 WebRemoteControlSearchUtils::ScoreFuzzyName(const FString& InName, const FString& InQuery, int32 InSharedTrigrams, int32 InQueryTrigrams)
+{
+	if (InQueryTrigrams <= 0 || InSharedTrigrams * 2 < InQueryTrigrams)
+	{
+		return 0;
+	}
+
+	return ApplyLengthPenalty(FuzzyMatchScore * InSharedTrigrams / InQueryTrigrams, InName, InQuery);
+}
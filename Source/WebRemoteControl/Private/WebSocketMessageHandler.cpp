@@ -16,7 +16,9 @@
 #include "RemoteControlReflectionUtils.h"
 #include "RemoteControlWebsocketRoute.h"
 #include "WebRemoteControl.h"
+#include "WebRemoteControlBufferPool.h"
 #include "WebRemoteControlInternalUtils.h"
+#include "WebRemoteControlMetrics.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -57,6 +59,12 @@ namespace WebSocketMessageHandlerStructUtils
 	FName Prop_ChangedFields = "ChangedFields";
 	FName Prop_SequenceNumber = "SequenceNumber";
 
+	FName Struct_PropertyValueByHandle = "WEBRC_PropertyValueByHandle";
+	FName Prop_FieldHandle = "FieldHandle";
+
+	FName Struct_PresetFieldsChangedByHandle = "WEBRC_PresetFieldsChangedByHandle";
+	FName Prop_PresetHandle = "PresetHandle";
+
 	FName Struct_ActorPropertyValue= "WEBRC_ActorPropertyValue";
 	FName Prop_PropertyName = "PropertyName";
 
@@ -107,6 +115,41 @@ namespace WebSocketMessageHandlerStructUtils
 		return GenerateStruct(*StructName, Args);
 	}
 
+	UScriptStruct* CreatePropertyValueByHandleContainer(FProperty* InValueProperty)
+	{
+		check(InValueProperty);
+
+		static FGuid PropertyValueByHandleGuid = FGuid::NewGuid();
+
+		FWebRCGenerateStructArgs Args;
+		Args.StringProperties =
+		{
+			Prop_FieldHandle
+		};
+
+		Args.GenericProperties.Emplace(Prop_PropertyValue, InValueProperty);
+
+		const FString StructName = FString::Format(TEXT("{0}_{1}_{2}_{3}"), { *Struct_PropertyValueByHandle.ToString(), *InValueProperty->GetClass()->GetName(), *InValueProperty->GetName(), PropertyValueByHandleGuid.ToString() });
+
+		return GenerateStruct(*StructName, Args);
+	}
+
+	UScriptStruct* CreatePresetFieldsChangedByHandleStruct(UScriptStruct* PropertyValueStruct)
+	{
+		FWebRCGenerateStructArgs Args;
+		Args.StringProperties =
+		{
+			Prop_PresetHandle,
+			Prop_Type,
+			Prop_SequenceNumber
+		};
+
+		Args.ArrayProperties.Emplace(Prop_ChangedFields, PropertyValueStruct);
+		const FString StructName = FString::Format(TEXT("{0}_{1}"), { *Struct_PresetFieldsChangedByHandle.ToString(), *PropertyValueStruct->GetName() });
+
+		return GenerateStruct(*StructName, Args);
+	}
+
 	UScriptStruct* CreateActorPropertyValueContainer(FProperty* InValueProperty)
 	{
 		static FGuid ActorPropertyValueGuid = FGuid::NewGuid();
@@ -169,6 +212,33 @@ namespace WebSocketMessageHandlerStructUtils
 		return StructOnScope;
 	}
 	
+	FStructOnScope CreatePropertyValueByHandleOnScope(int32 FieldHandle, const FRCObjectReference& ObjectReference)
+	{
+		UScriptStruct* Struct = CreatePropertyValueByHandleContainer(ObjectReference.Property.Get());
+		FStructOnScope StructOnScope{ Struct };
+
+		SetStringPropertyValue(Prop_FieldHandle, StructOnScope, LexToString(FieldHandle));
+		CopyPropertyValue(Prop_PropertyValue, StructOnScope, ObjectReference);
+
+		return StructOnScope;
+	}
+
+	FStructOnScope CreatePresetFieldsChangedByHandleStructOnScope(int32 PresetHandle, const TCHAR* EventType, const TArray<FStructOnScope>& PropertyValuesOnScope, int64 SequenceNumber)
+	{
+		UScriptStruct* PropertyValueStruct = (UScriptStruct*)PropertyValuesOnScope[0].GetStruct();
+		check(PropertyValueStruct);
+
+		UScriptStruct* TopLevelStruct = CreatePresetFieldsChangedByHandleStruct(PropertyValueStruct);
+
+		FStructOnScope FieldsChangedOnScope{ TopLevelStruct };
+		SetStringPropertyValue(Prop_Type, FieldsChangedOnScope, EventType);
+		SetStringPropertyValue(Prop_PresetHandle, FieldsChangedOnScope, LexToString(PresetHandle));
+		SetStringPropertyValue(Prop_SequenceNumber, FieldsChangedOnScope, FString::Printf(TEXT("%lld"), SequenceNumber));
+		SetStructArrayPropertyValue(Prop_ChangedFields, FieldsChangedOnScope, PropertyValuesOnScope);
+
+		return FieldsChangedOnScope;
+	}
+
 	FStructOnScope CreatePresetControllerChangedStructOnScope(const URemoteControlPreset* Preset, const TArray<FStructOnScope*>& PropertyValuesOnScope, int64 SequenceNumber)
 	{
 		UScriptStruct* PropertyValueStruct = (UScriptStruct*)PropertyValuesOnScope[0]->GetStruct();
@@ -272,6 +342,52 @@ namespace WebSocketMessageHandlerMiscUtils
 		return nullptr;
 	}
 
+	URemoteControlPreset* ResolvePresetFromNameOrId(const FString& PresetNameOrId)
+	{
+		FGuid PresetId;
+		if (FGuid::ParseExact(PresetNameOrId, EGuidFormats::Digits, PresetId))
+		{
+			return IRemoteControlModule::Get().ResolvePreset(PresetId);
+		}
+
+		return IRemoteControlModule::Get().ResolvePreset(*PresetNameOrId);
+	}
+
+	void ResolvePresetFromNameOrIdAsync(const FString& PresetNameOrId, FOnPresetResolved OnResolved)
+	{
+		FGuid PresetId;
+		if (FGuid::ParseExact(PresetNameOrId, EGuidFormats::Digits, PresetId))
+		{
+			IRemoteControlModule::Get().ResolvePresetAsync(PresetId, MoveTemp(OnResolved));
+		}
+		else
+		{
+			IRemoteControlModule::Get().ResolvePresetAsync(*PresetNameOrId, MoveTemp(OnResolved));
+		}
+	}
+
+	bool GetAccessForTransactionMode(ERCTransactionMode TransactionMode, ERCAccess& OutAccess)
+	{
+		switch (TransactionMode)
+		{
+		case ERCTransactionMode::NONE:
+			OutAccess = ERCAccess::WRITE_ACCESS;
+			return true;
+
+		case ERCTransactionMode::AUTOMATIC:
+			OutAccess = ERCAccess::WRITE_TRANSACTION_ACCESS;
+			return true;
+
+		case ERCTransactionMode::MANUAL:
+			OutAccess = ERCAccess::WRITE_MANUAL_TRANSACTION_ACCESS;
+			return true;
+
+		default:
+			UE_LOG(LogRemoteControl, Warning, TEXT("Unknown transaction mode %d"), int(TransactionMode));
+			return false;
+		}
+	}
+
 	void* GetPresetControllerClassPointer(URemoteControlPreset* Preset, const FGuid& ControllerId)
 	{
 		if (const URCVirtualPropertyBase* Controller = Preset->GetController(ControllerId))
@@ -355,6 +471,24 @@ void FWebSocketMessageHandler::RegisterRoutes(FWebRemoteControlModule* WebRemote
 		FWebSocketMessageDelegate::CreateRaw(this, &FWebSocketMessageHandler::HandleWebSocketPresetModifyProperty)
 	));
 
+	RegisterRoute(WebRemoteControl, MakeUnique<FRemoteControlWebsocketRoute>(
+		TEXT("Get numeric handles for a preset and its exposed properties, to be used with the handle-based preset messages"),
+		TEXT("preset.handles"),
+		FWebSocketMessageDelegate::CreateRaw(this, &FWebSocketMessageHandler::HandleWebSocketPresetFieldHandles)
+	));
+
+	RegisterRoute(WebRemoteControl, MakeUnique<FRemoteControlWebsocketRoute>(
+		TEXT("Modify the value of a property exposed on a preset, using the handles returned by preset.handles"),
+		TEXT("preset.property.modify.handle"),
+		FWebSocketMessageDelegate::CreateRaw(this, &FWebSocketMessageHandler::HandleWebSocketPresetModifyPropertyByHandle)
+	));
+
+	RegisterRoute(WebRemoteControl, MakeUnique<FRemoteControlWebsocketRoute>(
+		TEXT("Get the value of a property exposed on a preset, using the handles returned by preset.handles"),
+		TEXT("preset.property.get.handle"),
+		FWebSocketMessageDelegate::CreateRaw(this, &FWebSocketMessageHandler::HandleWebSocketPresetGetPropertyByHandle)
+	));
+
 	RegisterRoute(WebRemoteControl, MakeUnique<FRemoteControlWebsocketRoute>(
 		TEXT("Call a function on an object"),
 		TEXT("object.call"),
@@ -482,27 +616,19 @@ void FWebSocketMessageHandler::HandleWebSocketPresetRegister(const FRemoteContro
 		return;
 	}
 
-	URemoteControlPreset* Preset = nullptr;
-
-	FGuid PresetId;
-
-	if (FGuid::ParseExact(Body.PresetName, EGuidFormats::Digits, PresetId))
-	{
-		
-		Preset = IRemoteControlModule::Get().ResolvePreset(PresetId);
-	}
-	else
-	{
-		Preset = IRemoteControlModule::Get().ResolvePreset(*Body.PresetName);
-	}
-
+	// Registration is usually the first message referencing a preset, so avoid blocking on its load here.
+	WebSocketMessageHandlerMiscUtils::ResolvePresetFromNameOrIdAsync(Body.PresetName, FOnPresetResolved::CreateSP(this, &FWebSocketMessageHandler::RegisterClientToPreset, WebSocketMessage.ClientId, Body.IgnoreRemoteChanges));
+}
 
-	if (Preset == nullptr)
+void FWebSocketMessageHandler::RegisterClientToPreset(URemoteControlPreset* Preset, FGuid ClientId, bool bIgnoreRemoteChanges)
+{
+	// The client may have disconnected while the preset was loading.
+	if (Preset == nullptr || !Server->IsConnected(ClientId))
 	{
 		return;
 	}
 
-	ClientConfigMap.FindOrAdd(WebSocketMessage.ClientId).bIgnoreRemoteChanges = Body.IgnoreRemoteChanges;
+	ClientConfigMap.FindOrAdd(ClientId).bIgnoreRemoteChanges = bIgnoreRemoteChanges;
 	
 	TArray<FGuid>* ClientIds = PresetNotificationMap.Find(Preset->GetPresetId());
 
@@ -515,6 +641,8 @@ void FWebSocketMessageHandler::HandleWebSocketPresetRegister(const FRemoteContro
 		Preset->OnExposedPropertiesModified().AddRaw(this, &FWebSocketMessageHandler::OnPresetExposedPropertiesModified);
 		Preset->OnEntityExposed().AddRaw(this, &FWebSocketMessageHandler::OnPropertyExposed);
 		Preset->OnEntityUnexposed().AddRaw(this, &FWebSocketMessageHandler::OnPropertyUnexposed);
+		Preset->OnEntitiesExposed().AddRaw(this, &FWebSocketMessageHandler::OnPropertiesExposed);
+		Preset->OnEntitiesUnexposed().AddRaw(this, &FWebSocketMessageHandler::OnPropertiesUnexposed);
 		Preset->OnFieldRenamed().AddRaw(this, &FWebSocketMessageHandler::OnFieldRenamed);
 		Preset->OnMetadataModified().AddRaw(this, &FWebSocketMessageHandler::OnMetadataModified);
 		Preset->OnActorPropertyModified().AddRaw(this, &FWebSocketMessageHandler::OnActorPropertyChanged);
@@ -526,7 +654,7 @@ void FWebSocketMessageHandler::HandleWebSocketPresetRegister(const FRemoteContro
 		Preset->OnControllerModified().AddRaw(this, &FWebSocketMessageHandler::OnControllerModified);
 	}
 
-	ClientIds->AddUnique(WebSocketMessage.ClientId);
+	ClientIds->AddUnique(ClientId);
 }
 
 
@@ -720,6 +848,96 @@ void FWebSocketMessageHandler::HandleWebSocketPresetModifyProperty(const FRemote
 	WebRemoteControlInternalUtils::ModifyPropertyUsingPayload(*RemoteControlProperty.Get(), Body, WebSocketMessage.RequestPayload, WebSocketMessage.ClientId, *this, Access);
 }
 
+void FWebSocketMessageHandler::HandleWebSocketPresetFieldHandles(const FRemoteControlWebSocketMessage& WebSocketMessage)
+{
+	FRCWebSocketPresetFieldHandlesBody Body;
+	if (!WebRemoteControlInternalUtils::DeserializeRequestPayload(WebSocketMessage.RequestPayload, nullptr, Body))
+	{
+		return;
+	}
+
+	URemoteControlPreset* Preset = WebSocketMessageHandlerMiscUtils::ResolvePresetFromNameOrId(Body.PresetName);
+	if (Preset == nullptr)
+	{
+		return;
+	}
+
+	FindOrAddPresetHandle(Preset);
+
+	FRCClientConfig& Config = ClientConfigMap.FindOrAdd(WebSocketMessage.ClientId);
+	if (Body.UseHandlesInEvents)
+	{
+		Config.PresetsUsingFieldHandles.Add(Preset->GetPresetId());
+	}
+	else
+	{
+		Config.PresetsUsingFieldHandles.Remove(Preset->GetPresetId());
+	}
+
+	SendPresetFieldHandles(Preset, WebSocketMessage.ClientId);
+}
+
+void FWebSocketMessageHandler::HandleWebSocketPresetModifyPropertyByHandle(const FRemoteControlWebSocketMessage& WebSocketMessage)
+{
+	FRCWebSocketPresetSetPropertyByHandleBody Body;
+	if (!WebRemoteControlInternalUtils::DeserializeRequestPayload(WebSocketMessage.RequestPayload, nullptr, Body))
+	{
+		return;
+	}
+
+	ERCAccess Access;
+	if (!WebSocketMessageHandlerMiscUtils::GetAccessForTransactionMode(Body.TransactionMode, Access))
+	{
+		return;
+	}
+
+#if WITH_EDITOR
+	// Indicate that we want to contribute to this transaction if it's active
+	if (Body.TransactionMode == ERCTransactionMode::MANUAL && GEditor && !ContributeToTransaction(WebSocketMessage.ClientId, Body.TransactionId))
+	{
+		return;
+	}
+#endif
+
+	URemoteControlPreset* Preset = nullptr;
+	TSharedPtr<FRemoteControlProperty> RemoteControlProperty = ResolvePropertyHandle(Body.PresetHandle, Body.FieldHandle, Preset);
+	if (!RemoteControlProperty.IsValid())
+	{
+		return;
+	}
+
+	UpdateSequenceNumber(WebSocketMessage.ClientId, Body.SequenceNumber);
+
+	WebRemoteControlInternalUtils::ModifyPropertyUsingPayload(*RemoteControlProperty.Get(), Body, WebSocketMessage.RequestPayload, WebSocketMessage.ClientId, *this, Access);
+}
+
+void FWebSocketMessageHandler::HandleWebSocketPresetGetPropertyByHandle(const FRemoteControlWebSocketMessage& WebSocketMessage)
+{
+	FRCWebSocketPresetGetPropertyByHandleBody Body;
+	if (!WebRemoteControlInternalUtils::DeserializeRequestPayload(WebSocketMessage.RequestPayload, nullptr, Body))
+	{
+		return;
+	}
+
+	URemoteControlPreset* Preset = nullptr;
+	TSharedPtr<FRemoteControlProperty> RemoteControlProperty = ResolvePropertyHandle(Body.PresetHandle, Body.FieldHandle, Preset);
+	if (!RemoteControlProperty.IsValid())
+	{
+		return;
+	}
+
+	const FPresetFieldHandleTable& FieldHandles = PresetFieldHandles.FindChecked(Preset->GetPresetId());
+
+	static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+	FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+	if (WritePropertyChangeByHandleEventPayload(Preset, FieldHandles, { RemoteControlProperty->GetId() }, GetSequenceNumber(WebSocketMessage.ClientId), WorkingBuffer.Get(), TEXT("PresetFieldValueByHandle")))
+	{
+		TArray<uint8> Payload;
+		WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Payload);
+		Server->Send(WebSocketMessage.ClientId, Payload);
+	}
+}
+
 void FWebSocketMessageHandler::HandleWebSocketFunctionCall(const FRemoteControlWebSocketMessage& WebSocketMessage)
 {
 	FRCWebSocketCallBody Body;
@@ -895,11 +1113,12 @@ void FWebSocketMessageHandler::ProcessChangedControllers()
 			{
 				const uint64 ClientSequenceNumber = GetSequenceNumber(ClientToModifications.Key);
 				
-				TArray<uint8> WorkingBuffer;
-				if (ClientToModifications.Value.Num() && WriteControllerChangeEventPayload(Preset, ClassToEventsPair.Value, ClientSequenceNumber, WorkingBuffer))
+				static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+				FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+				if (ClientToModifications.Value.Num() && WriteControllerChangeEventPayload(Preset, ClassToEventsPair.Value, ClientSequenceNumber, WorkingBuffer.Get()))
 				{
 					TArray<uint8> Payload;
-					WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Payload);
+					WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Payload);
 					Server->Send(ClientToModifications.Key, Payload);
 				}
 			}
@@ -1022,6 +1241,8 @@ void FWebSocketMessageHandler::ProcessChangedProperties()
 				PropertyIdsByType.FindOrAdd(ClassPointer).Emplace(Id);
 			}
 
+			const FPresetFieldHandleTable* FieldHandles = GetClientFieldHandles(ClientToEventsPair.Key, Entry.Key);
+
 			// Send a property change event for each property type
 			for (const TPair<void*, TSet<FGuid>>& ClassToEventsPair : PropertyIdsByType)
 			{
@@ -1030,15 +1251,20 @@ void FWebSocketMessageHandler::ProcessChangedProperties()
 				//Check if multiple booleans properties want to be sent and send them since multiple booleans have problem with the common workflow.
 				if (ClassToEventsPair.Key == FBoolProperty::StaticClass())
 				{
-					TrySendMultipleBoolProperties(Preset, ClientToEventsPair.Key, ClassToEventsPair.Value, SequenceNumber);
+					TrySendMultipleBoolProperties(Preset, ClientToEventsPair.Key, ClassToEventsPair.Value, SequenceNumber, FieldHandles);
 					continue;
 				}
 
-				TArray<uint8> WorkingBuffer;
-				if (ClientToEventsPair.Value.Num() && WritePropertyChangeEventPayload(Preset, { ClassToEventsPair.Value }, SequenceNumber, WorkingBuffer))
+				static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+				FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+				const bool bWritten = FieldHandles
+					? WritePropertyChangeByHandleEventPayload(Preset, *FieldHandles, ClassToEventsPair.Value, SequenceNumber, WorkingBuffer.Get())
+					: WritePropertyChangeEventPayload(Preset, ClassToEventsPair.Value, SequenceNumber, WorkingBuffer.Get());
+
+				if (ClientToEventsPair.Value.Num() && bWritten)
 				{
 					TArray<uint8> Payload;
-					WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Payload);
+					WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Payload);
 					Server->Send(ClientToEventsPair.Key, Payload);
 				}
 			}
@@ -1067,13 +1293,14 @@ void FWebSocketMessageHandler::ProcessChangedActorProperties()
 		// Each client will have a custom payload that doesnt contain the events it triggered.
 		for (const TPair<FGuid, TMap<FRemoteControlActor, TArray<FRCObjectReference>>>& ClientToModifications : Entry.Value)
 		{
-			TArray<uint8> WorkingBuffer;
-			FMemoryWriter Writer(WorkingBuffer);
+			static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+			FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+			FMemoryWriter Writer(WorkingBuffer.Get());
 
 			if (ClientToModifications.Value.Num() && WriteActorPropertyChangePayload(Preset, ClientToModifications.Value, Writer))
 			{
 				TArray<uint8> Payload;
-				WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer, Payload);
+				WebRemoteControlUtils::ConvertToUTF8(WorkingBuffer.Get(), Payload);
 				Server->Send(ClientToModifications.Key, Payload);
 			}
 		}
@@ -1108,6 +1335,15 @@ void FWebSocketMessageHandler::OnPropertyExposed(URemoteControlPreset* Owner, co
 		Entries.Value.AddUnique(FName(EntityId.ToString()));
 	}
 
+	// Assign a handle right away so handle-based clients can address the new field once they're notified.
+	if (FPresetFieldHandleTable* FieldHandles = PresetFieldHandles.Find(Owner->GetPresetId()))
+	{
+		if (Owner->GetExposedEntity<FRemoteControlProperty>(EntityId).IsValid())
+		{
+			FieldHandles->FindOrAddHandle(EntityId);
+		}
+	}
+
 	//Cache the property field that was removed for end of frame notification
 	PerFrameAddedProperties.FindOrAdd(Owner->GetPresetId()).AddUnique(EntityId);
 }
@@ -1166,6 +1402,15 @@ void FWebSocketMessageHandler::OnPropertyUnexposed(URemoteControlPreset* Owner,
 		return;
 	}
 
+	if (FPresetFieldHandleTable* FieldHandles = PresetFieldHandles.Find(Owner->GetPresetId()))
+	{
+		int32 FieldHandle = INDEX_NONE;
+		if (FieldHandles->HandlesById.RemoveAndCopyValue(EntityId, FieldHandle))
+		{
+			FieldHandles->Fields[FieldHandle].Invalidate();
+		}
+	}
+
 	const TSharedPtr<FRemoteControlEntity> Entity = Owner->GetExposedEntity(EntityId).Pin();
 	TPair<TArray<FGuid>, TArray<FName>>& Entries = PerFrameRemovedProperties.FindOrAdd(Owner->GetPresetId());
 
@@ -1200,6 +1445,23 @@ void FWebSocketMessageHandler::OnPropertyUnexposed(URemoteControlPreset* Owner,
 	}
 }
 
+void FWebSocketMessageHandler::OnPropertiesExposed(URemoteControlPreset* Owner, const TArray<FGuid>& EntityIds)
+{
+	// Entities exposed in bulk are reported in the same end of frame PresetFieldsAdded message.
+	for (const FGuid& EntityId : EntityIds)
+	{
+		OnPropertyExposed(Owner, EntityId);
+	}
+}
+
+void FWebSocketMessageHandler::OnPropertiesUnexposed(URemoteControlPreset* Owner, const TArray<FGuid>& EntityIds)
+{
+	for (const FGuid& EntityId : EntityIds)
+	{
+		OnPropertyUnexposed(Owner, EntityId);
+	}
+}
+
 void FWebSocketMessageHandler::OnFieldRenamed(URemoteControlPreset* Owner, FName OldFieldLabel, FName NewFieldLabel)
 {
 	if (Owner == nullptr)
@@ -1378,6 +1640,8 @@ void FWebSocketMessageHandler::OnConnectionClosedCallback(FGuid ClientId)
 
 void FWebSocketMessageHandler::OnEndFrame()
 {
+	FRCMetricsScopedTimer EndFrameTimer(FWebRemoteControlMetrics::Get().EndFrameTime);
+
 	PropertyNotificationFrameCounter++;
 
 	if (PropertyNotificationFrameCounter >= CVarWebRemoteControlFramesBetweenPropertyNotifications.GetValueOnGameThread())
@@ -1536,6 +1800,15 @@ void FWebSocketMessageHandler::ProcessAddedProperties()
 		TArray<uint8> Payload;
 		WebRemoteControlUtils::SerializeMessage(FRCPresetFieldsAddedEvent{ Preset->GetPresetName(), Preset->GetPresetId(), AddedPropertiesDescription }, Payload);
 		BroadcastToPresetListeners(Entry.Key, Payload);
+
+		// Clients using handles also need the handles of the new fields.
+		for (const FGuid& Listener : PresetNotificationMap.FindChecked(Entry.Key))
+		{
+			if (GetClientFieldHandles(Listener, Entry.Key))
+			{
+				SendPresetFieldHandles(Preset, Listener);
+			}
+		}
 	}
 
 	PerFrameAddedProperties.Empty();
@@ -1798,6 +2071,8 @@ void FWebSocketMessageHandler::GatherActorChangesForDeletedClass(const FWebSocke
 void FWebSocketMessageHandler::BroadcastToPresetListeners(const FGuid& TargetPresetId, const TArray<uint8>& Payload)
 {
 	const TArray<FGuid>& Listeners = PresetNotificationMap.FindChecked(TargetPresetId);
+	FWebRemoteControlMetrics::Get().EventFanOut.Record(Listeners.Num());
+
 	for (const FGuid& Listener : Listeners)
 	{
 		Server->Send(Listener, Payload);
@@ -1870,8 +2145,160 @@ bool FWebSocketMessageHandler::WritePropertyChangeEventPayload(URemoteControlPre
 	return bHasProperty;
 }
 
+bool FWebSocketMessageHandler::WritePropertyChangeByHandleEventPayload(URemoteControlPreset* InPreset, const FPresetFieldHandleTable& InFieldHandles, const TSet<FGuid>& InModifiedPropertyIds, int64 InSequenceNumber, TArray<uint8>& OutBuffer, const TCHAR* InEventType)
+{
+	const int32 PresetHandle = PresetHandles.IndexOfByKey(InPreset->GetPresetId());
+	if (PresetHandle == INDEX_NONE)
+	{
+		return false;
+	}
+
+	bool bHasProperty = false;
+
+	TArray<FStructOnScope> PropValuesOnScope;
+	for (const FGuid& RCPropertyId : InModifiedPropertyIds)
+	{
+		const int32* FieldHandle = InFieldHandles.HandlesById.Find(RCPropertyId);
+		if (!FieldHandle)
+		{
+			continue;
+		}
+
+		FRCObjectReference ObjectRef;
+		if (TSharedPtr<FRemoteControlProperty> RCProperty = InPreset->GetExposedEntity<FRemoteControlProperty>(RCPropertyId).Pin())
+		{
+			if (RCProperty->IsBound())
+			{
+				if (IRemoteControlModule::Get().ResolveObjectProperty(ERCAccess::READ_ACCESS, RCProperty->GetBoundObjects()[0], RCProperty->FieldPathInfo.ToString(), ObjectRef))
+				{
+					bHasProperty = true;
+					PropValuesOnScope.Add(WebSocketMessageHandlerStructUtils::CreatePropertyValueByHandleOnScope(*FieldHandle, ObjectRef));
+				}
+			}
+		}
+	}
+
+	if (PropValuesOnScope.Num())
+	{
+		FStructOnScope FieldsChangedEventOnScope = WebSocketMessageHandlerStructUtils::CreatePresetFieldsChangedByHandleStructOnScope(PresetHandle, InEventType, PropValuesOnScope, InSequenceNumber);
+
+		FMemoryWriter Writer(OutBuffer);
+		WebRemoteControlInternalUtils::SerializeStructOnScope(FieldsChangedEventOnScope, Writer);
+	}
+
+	return bHasProperty;
+}
+
+int32 FWebSocketMessageHandler::FPresetFieldHandleTable::FindOrAddHandle(const FGuid& FieldId)
+{
+	if (const int32* Handle = HandlesById.Find(FieldId))
+	{
+		return *Handle;
+	}
+
+	const int32 NewHandle = Fields.Add(FieldId);
+	HandlesById.Add(FieldId, NewHandle);
+	return NewHandle;
+}
+
+int32 FWebSocketMessageHandler::FindOrAddPresetHandle(URemoteControlPreset* InPreset)
+{
+	check(InPreset);
+
+	const FGuid PresetId = InPreset->GetPresetId();
+
+	int32 PresetHandle = PresetHandles.IndexOfByKey(PresetId);
+	if (PresetHandle == INDEX_NONE)
+	{
+		PresetHandle = PresetHandles.Add(PresetId);
+	}
+
+	// Synchronize the table in case fields were exposed or unexposed while nobody was listening to the preset.
+	FPresetFieldHandleTable& FieldHandles = PresetFieldHandles.FindOrAdd(PresetId);
+	for (const TWeakPtr<FRemoteControlProperty>& WeakProperty : InPreset->GetExposedEntities<FRemoteControlProperty>())
+	{
+		if (TSharedPtr<FRemoteControlProperty> Property = WeakProperty.Pin())
+		{
+			FieldHandles.FindOrAddHandle(Property->GetId());
+		}
+	}
+
+	for (auto It = FieldHandles.HandlesById.CreateIterator(); It; ++It)
+	{
+		if (!InPreset->GetExposedEntity<FRemoteControlProperty>(It.Key()).IsValid())
+		{
+			FieldHandles.Fields[It.Value()].Invalidate();
+			It.RemoveCurrent();
+		}
+	}
+
+	return PresetHandle;
+}
+
+TSharedPtr<FRemoteControlProperty> FWebSocketMessageHandler::ResolvePropertyHandle(int32 InPresetHandle, int32 InFieldHandle, URemoteControlPreset*& OutPreset) const
+{
+	if (!PresetHandles.IsValidIndex(InPresetHandle))
+	{
+		return nullptr;
+	}
+
+	const FPresetFieldHandleTable* FieldHandles = PresetFieldHandles.Find(PresetHandles[InPresetHandle]);
+	if (!FieldHandles || !FieldHandles->Fields.IsValidIndex(InFieldHandle) || !FieldHandles->Fields[InFieldHandle].IsValid())
+	{
+		return nullptr;
+	}
+
+	OutPreset = IRemoteControlModule::Get().ResolvePreset(PresetHandles[InPresetHandle]);
+	if (!OutPreset)
+	{
+		return nullptr;
+	}
+
+	return OutPreset->GetExposedEntity<FRemoteControlProperty>(FieldHandles->Fields[InFieldHandle]).Pin();
+}
+
+const FWebSocketMessageHandler::FPresetFieldHandleTable* FWebSocketMessageHandler::GetClientFieldHandles(const FGuid& ClientId, const FGuid& PresetId) const
+{
+	if (const FRCClientConfig* Config = ClientConfigMap.Find(ClientId))
+	{
+		if (Config->PresetsUsingFieldHandles.Contains(PresetId))
+		{
+			return PresetFieldHandles.Find(PresetId);
+		}
+	}
+
+	return nullptr;
+}
+
+void FWebSocketMessageHandler::SendPresetFieldHandles(URemoteControlPreset* InPreset, const FGuid& InTargetClientId)
+{
+	const FPresetFieldHandleTable* FieldHandles = PresetFieldHandles.Find(InPreset->GetPresetId());
+	if (!FieldHandles)
+	{
+		return;
+	}
+
+	FRCPresetFieldHandlesEvent Event;
+	Event.PresetName = InPreset->GetPresetName();
+	Event.PresetId = InPreset->GetPresetId().ToString();
+	Event.PresetHandle = PresetHandles.IndexOfByKey(InPreset->GetPresetId());
+	Event.Fields.Reserve(FieldHandles->HandlesById.Num());
+
+	for (const TPair<FGuid, int32>& Entry : FieldHandles->HandlesById)
+	{
+		if (TSharedPtr<FRemoteControlProperty> Property = InPreset->GetExposedEntity<FRemoteControlProperty>(Entry.Key).Pin())
+		{
+			Event.Fields.Emplace(Entry.Value, Property->GetLabel(), Entry.Key);
+		}
+	}
+
+	TArray<uint8> Payload;
+	WebRemoteControlUtils::SerializeMessage(Event, Payload);
+	Server->Send(InTargetClientId, Payload);
+}
+
 bool FWebSocketMessageHandler::TrySendMultipleBoolProperties(URemoteControlPreset* InPreset,
-	const FGuid& InTargetClientId, const TSet<FGuid>& InModifiedPropertyIds, int64 InSequenceNumber)
+	const FGuid& InTargetClientId, const TSet<FGuid>& InModifiedPropertyIds, int64 InSequenceNumber, const FPresetFieldHandleTable* InFieldHandles)
 {
 	bool bFound = false;
 	int32 NumberSent = 0;
@@ -1886,11 +2313,16 @@ bool FWebSocketMessageHandler::TrySendMultipleBoolProperties(URemoteControlPrese
 					bFound = true;
 					for (FGuid ModifiedPropertyId : InModifiedPropertyIds)
 					{
-						TArray<uint8> BoolsWorkingBuffer;
-						if (WritePropertyChangeEventPayload(InPreset, { ModifiedPropertyId }, InSequenceNumber, BoolsWorkingBuffer))
+						static FWebRemoteControlBufferSizeHint BoolsWorkingBufferSizeHint;
+						FWebRemoteControlPooledBuffer BoolsWorkingBuffer(BoolsWorkingBufferSizeHint);
+						const bool bWritten = InFieldHandles
+							? WritePropertyChangeByHandleEventPayload(InPreset, *InFieldHandles, { ModifiedPropertyId }, InSequenceNumber, BoolsWorkingBuffer.Get())
+							: WritePropertyChangeEventPayload(InPreset, { ModifiedPropertyId }, InSequenceNumber, BoolsWorkingBuffer.Get());
+
+						if (bWritten)
 						{
 							TArray<uint8> Payload;
-							WebRemoteControlUtils::ConvertToUTF8(BoolsWorkingBuffer, Payload);
+							WebRemoteControlUtils::ConvertToUTF8(BoolsWorkingBuffer.Get(), Payload);
 							Server->Send(InTargetClientId, Payload);
 							++NumberSent;
 						}
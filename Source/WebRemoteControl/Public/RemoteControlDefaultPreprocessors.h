@@ -53,6 +53,14 @@ namespace UE::WebRemoteControl
 			return FPreprocessorResult();
 		}
 
+		/** Let request pass because it carries a valid session token, which was accepted in place of the other credentials. */
+		static FPreprocessorResult PassthroughWithSessionToken(const FString& InSessionToken)
+		{
+			FPreprocessorResult Result;
+			Result.AcceptedSessionToken = InSessionToken;
+			return Result;
+		}
+
 		/** Deny request and respond with error message. */
 		static FPreprocessorResult Deny(const FString& ErrorMessage)
 		{
@@ -70,6 +78,8 @@ namespace UE::WebRemoteControl
 		EPreprocessorResult Result = EPreprocessorResult::RequestPassthrough;
 		/** If denied, holds the response to be sent to the client. */
 		TUniquePtr<FHttpServerResponse> OptionalResponse;
+		/** If the request was let through because of its session token, holds that token. */
+		FString AcceptedSessionToken;
 
 	private:
 		FPreprocessorResult() = default;
@@ -363,6 +373,12 @@ namespace UE::WebRemoteControl
 
 				if (GetDefault<URemoteControlSettings>()->Passphrases.Num())
 				{
+					// Clients that already authenticated with a passphrase only need to present their session token.
+					if (const FString* SessionToken = WebRemoteControlInternalUtils::FindValidSessionToken(Request))
+					{
+						return FPreprocessorResult::PassthroughWithSessionToken(*SessionToken);
+					}
+
 					const TArray<FString>* PassphraseHeader = Request.Headers.Find(WebRemoteControlInternalUtils::PassphraseHeader);
 					if (!PassphraseHeader || PassphraseHeader->Num() == 0)
 					{
@@ -424,15 +440,13 @@ namespace UE::WebRemoteControl
 	/** Checks whether a request has a valid passphrase when passphrases are enabled for this editor. */
 	FPreprocessorResult PassphrasePreprocessor(const FHttpServerRequest& Request)
 	{
-		TUniquePtr<FHttpServerResponse> Response = WebRemoteControlInternalUtils::CreateHttpResponse();
-
-		TArray<FString> ValueArray = {};
-		if (Request.Headers.Find(WebRemoteControlInternalUtils::PassphraseHeader))
+		if (const FString* SessionToken = WebRemoteControlInternalUtils::FindValidSessionToken(Request))
 		{
-			ValueArray = Request.Headers[WebRemoteControlInternalUtils::PassphraseHeader];
+			return FPreprocessorResult::PassthroughWithSessionToken(*SessionToken);
 		}
-		
-		const FString Passphrase = !ValueArray.IsEmpty() ? ValueArray.Last() : "";
+
+		const TArray<FString>* ValueArray = Request.Headers.Find(WebRemoteControlInternalUtils::PassphraseHeader);
+		const FString Passphrase = ValueArray && !ValueArray->IsEmpty() ? ValueArray->Last() : FString();
 
 		if (!WebRemoteControlInternalUtils::CheckPassphrase(Passphrase))
 		{
@@ -57,6 +57,20 @@ enum class ERemoteControlEvent : uint8
 	EventCount,
 };
 
+/**
+ * How an asset search query is matched against asset names.
+ */
+UENUM()
+enum class ERCAssetSearchMode : uint8
+{
+	/** The name contains the query. */
+	Substring = 0,
+	/** The name, or one of the words in the name, starts with the query. */
+	Prefix,
+	/** The name contains the query or shares most of its trigrams with it, to tolerate typos. */
+	Fuzzy,
+};
+
 /**
  * Holds a request to create an event hook.
  */
@@ -357,6 +371,18 @@ struct FSearchAssetRequest : public FRCRequest
 	 */
 	UPROPERTY()
 	int32 Limit;
+
+	/**
+	 * How the query is matched against asset names.
+	 */
+	UPROPERTY()
+	ERCAssetSearchMode Mode = ERCAssetSearchMode::Substring;
+
+	/**
+	 * The number of ranked results to skip, used to page through the results.
+	 */
+	UPROPERTY()
+	int32 Offset = 0;
 };
 
 /**
@@ -389,6 +415,30 @@ struct FSearchActorRequest : public FRCRequest
 	 */
 	UPROPERTY()
 	int32 Limit;
+
+	/**
+	 * Tags that the actors must all have.
+	 */
+	UPROPERTY()
+	TArray<FName> Tags;
+
+	/**
+	 * The level the actors must be in, either its path, its package name or the map name.
+	 */
+	UPROPERTY()
+	FString Level;
+
+	/**
+	 * Whether to search the play in editor world when one is running.
+	 */
+	UPROPERTY()
+	bool AllowPIE = false;
+
+	/**
+	 * The number of ranked results to skip, used to page through the results.
+	 */
+	UPROPERTY()
+	int32 Offset = 0;
 };
 
 /**
@@ -531,6 +581,12 @@ struct FRCWebSocketRequest : public FRCRequest
 	 */
 	UPROPERTY()
 	FString ForwardedFor;
+
+	/**
+	 * (Optional) Session token obtained from the /remote/session route, accepted in place of the passphrase.
+	 */
+	UPROPERTY()
+	FString SessionToken;
 };
 
 /**
@@ -693,6 +749,131 @@ struct FRCWebSocketPresetSetPropertyBody : public FRCRequest
 	int64 SequenceNumber = -1;
 };
 
+/**
+ * Holds a request made via websocket to retrieve numeric handles for the fields of a preset.
+ */
+USTRUCT()
+struct FRCWebSocketPresetFieldHandlesBody : public FRCRequest
+{
+	GENERATED_BODY()
+
+	FRCWebSocketPresetFieldHandlesBody()
+	{
+		AddStructParameter(ParametersFieldLabel());
+	}
+
+	/**
+	 * Get the label for the property value struct.
+	 */
+	static FString ParametersFieldLabel() { return TEXT("Parameters"); }
+
+	/**
+	 * Name or ID of the preset for which to retrieve field handles.
+	 */
+	UPROPERTY()
+	FString PresetName;
+
+	/**
+	 * If true, PresetFieldsChanged events for this preset will be sent to this client using handles instead of labels.
+	 */
+	UPROPERTY()
+	bool UseHandlesInEvents = true;
+};
+
+/**
+ * Holds a request made via websocket to modify a property exposed in a preset, identified by handles obtained with preset.handles.
+ */
+USTRUCT()
+struct FRCWebSocketPresetSetPropertyByHandleBody : public FRCRequest
+{
+	GENERATED_BODY()
+
+	FRCWebSocketPresetSetPropertyByHandleBody()
+	{
+		AddStructParameter(PropertyValueLabel());
+	}
+
+	/**
+	 * Get the label for the PropertyValue struct.
+	 */
+	static FString PropertyValueLabel() { return TEXT("PropertyValue"); }
+
+	/**
+	 * The handle of the preset to which the property belongs.
+	 */
+	UPROPERTY()
+	int32 PresetHandle = INDEX_NONE;
+
+	/**
+	 * The handle of the property to modify.
+	 */
+	UPROPERTY()
+	int32 FieldHandle = INDEX_NONE;
+
+	/**
+	 * Which type of operation should be performed on the value of the property.
+	 * This will be ignored if ResetToDefault is true.
+	 */
+	UPROPERTY()
+	ERCModifyOperation Operation = ERCModifyOperation::EQUAL;
+
+	/**
+	 * How to handle generating transactions for this property change.
+	 * @see FRCWebSocketPresetSetPropertyBody::TransactionMode
+	 */
+	UPROPERTY()
+	ERCTransactionMode TransactionMode = ERCTransactionMode::NONE;
+
+	/**
+	 * The ID of the transaction with which to associate these changes. Must be provided if TransactionMode is Manual.
+	 */
+	UPROPERTY()
+	int32 TransactionId = -1;
+
+	/**
+	 * If true, ignore the other parameters and just reset the property to its default value.
+	 */
+	UPROPERTY()
+	bool ResetToDefault = false;
+
+	/**
+	 * The sequence number of this change.
+	 */
+	UPROPERTY()
+	int64 SequenceNumber = -1;
+};
+
+/**
+ * Holds a request made via websocket to read the value of a property exposed in a preset, identified by handles.
+ */
+USTRUCT()
+struct FRCWebSocketPresetGetPropertyByHandleBody : public FRCRequest
+{
+	GENERATED_BODY()
+
+	FRCWebSocketPresetGetPropertyByHandleBody()
+	{
+		AddStructParameter(ParametersFieldLabel());
+	}
+
+	/**
+	 * Get the label for the property value struct.
+	 */
+	static FString ParametersFieldLabel() { return TEXT("Parameters"); }
+
+	/**
+	 * The handle of the preset to which the property belongs.
+	 */
+	UPROPERTY()
+	int32 PresetHandle = INDEX_NONE;
+
+	/**
+	 * The handle of the property to read.
+	 */
+	UPROPERTY()
+	int32 FieldHandle = INDEX_NONE;
+};
+
 /**
  * Holds a request made via websocket to call an exposed function on an object.
  */
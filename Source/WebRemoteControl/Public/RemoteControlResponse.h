@@ -92,6 +92,27 @@ struct FCheckPassphraseResponse
 	bool keyCorrect = false;
 };
 
+USTRUCT()
+struct FCreateSessionResponse
+{
+	GENERATED_BODY()
+
+	FCreateSessionResponse() = default;
+
+	FCreateSessionResponse(FString InSessionToken, int32 InExpiresIn)
+		: SessionToken(MoveTemp(InSessionToken))
+		, ExpiresIn(InExpiresIn)
+	{}
+
+	/** Token to send in the session token header of subsequent requests. */
+	UPROPERTY()
+	FString SessionToken;
+
+	/** Number of seconds before the token expires. */
+	UPROPERTY()
+	int32 ExpiresIn = 0;
+};
+
 USTRUCT()
 struct FDescribeObjectResponse
 {
@@ -146,8 +167,18 @@ struct FSearchAssetResponse
 		Assets.Append(InAssets);
 	}
 
+	FSearchAssetResponse(const TArray<FAssetData>& InAssets, int32 InTotalCount)
+		: TotalCount(InTotalCount)
+	{
+		Assets.Append(InAssets);
+	}
+
 	UPROPERTY()
 	TArray<FRCAssetDescription> Assets;
+
+	/** The number of assets matching the search, before applying the offset and limit. */
+	UPROPERTY()
+	int32 TotalCount = 0;
 };
 
 
@@ -163,8 +194,18 @@ struct FSearchActorResponse
 		Actors.Append(InActors);
 	}
 
+	FSearchActorResponse(const TArray<AActor*>& InActors, int32 InTotalCount)
+		: TotalCount(InTotalCount)
+	{
+		Actors.Append(InActors);
+	}
+
 	UPROPERTY()
 	TArray<FRCObjectDescription> Actors;
+
+	/** The number of actors matching the search, before applying the offset and limit. */
+	UPROPERTY()
+	int32 TotalCount = 0;
 };
 
 USTRUCT()
@@ -637,3 +678,76 @@ struct FRCCompressionChangedEvent
 	ERCWebSocketCompressionMode Mode = ERCWebSocketCompressionMode::NONE;
 };
 
+/**
+ * Maps a numeric handle to an exposed field of a preset.
+ */
+USTRUCT()
+struct FRCPresetFieldHandle
+{
+	GENERATED_BODY()
+
+	FRCPresetFieldHandle() = default;
+
+	FRCPresetFieldHandle(int32 InHandle, FName InLabel, const FGuid& InId)
+		: Handle(InHandle)
+		, Label(InLabel)
+		, Id(InId.ToString())
+	{
+	}
+
+	/**
+	 * The handle to use when referring to this field in handle-based messages.
+	 */
+	UPROPERTY()
+	int32 Handle = INDEX_NONE;
+
+	/**
+	 * The label of the field.
+	 */
+	UPROPERTY()
+	FName Label;
+
+	/**
+	 * The ID of the field.
+	 */
+	UPROPERTY()
+	FString Id;
+};
+
+/**
+ * Event sent in response to a preset.handles message, or when the handle table of a preset changes.
+ */
+USTRUCT()
+struct FRCPresetFieldHandlesEvent
+{
+	GENERATED_BODY()
+
+	FRCPresetFieldHandlesEvent()
+	: Type(TEXT("PresetFieldHandles"))
+	{
+	}
+
+	/**
+	 * Type of the event.
+	 */
+	UPROPERTY()
+	FString Type;
+
+	UPROPERTY()
+	FName PresetName;
+
+	UPROPERTY()
+	FString PresetId;
+
+	/**
+	 * The handle to use when referring to this preset in handle-based messages.
+	 */
+	UPROPERTY()
+	int32 PresetHandle = INDEX_NONE;
+
+	/**
+	 * Handles of the preset's exposed properties. Handles of removed fields are never reused.
+	 */
+	UPROPERTY()
+	TArray<FRCPresetFieldHandle> Fields;
+};
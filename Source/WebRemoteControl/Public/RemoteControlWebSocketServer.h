@@ -109,6 +109,9 @@ public:
 	/** Returns whether the server is currently listening for messages. */
 	bool IsRunning() const;
 
+	/** Returns whether a client is currently connected to the server. */
+	bool IsConnected(const FGuid& ClientId) const;
+
 	/** Callback when a socket is opened */
 	FOnWebSocketConnectionOpened& OnConnectionOpened() { return OnConnectionOpenedDelegate; }
 	
@@ -13,6 +13,8 @@
 #include "RemoteControlRoute.h"
 #include "RemoteControlWebsocketRoute.h"
 #include "RemoteControlWebSocketServer.h"
+#include "WebRemoteControlActorSearchIndex.h"
+#include "WebRemoteControlAssetSearchIndex.h"
 #include "WebRemoteControlEditorRoutes.h"
 
 struct FHttpServerRequest;
@@ -91,9 +93,14 @@ public:
 	void StopWebSocketServer();
 
 private:
+	friend class FWebRemoteControlSessionTokenWebSocketTest;
+
 	/** Bind the route in the http router and add it to the list of active routes. */
 	void StartRoute(const FRemoteControlRoute& Route);
 
+	/** Dispatch a request to a route that references a preset, deferring it until the preset is loaded if needed. */
+	bool HandleDeferredPresetRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete, FHttpRequestHandler Handler);
+
 	/** Register HTTP and Websocket routes. */
 	void RegisterRoutes();
 
@@ -131,6 +138,9 @@ private:
 	bool HandleEntityMetadataOperationsRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleEntitySetLabelRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandlePassphraseRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleMetricsRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleCreateSessionRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleDeleteSessionRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleCreateTransientPresetRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleDeleteTransientPresetRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandlePresetSetControllerRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
@@ -149,6 +159,9 @@ private:
 	/** Register the external request preprocessors that were added using RegisterRequestPreprocessor in the HttpRouter.   */
 	void RegisterExternalPreprocesors();
 
+	/** Forget the cached access checks of a websocket client. */
+	void OnWebSocketConnectionClosed(FGuid ClientId);
+
 #if WITH_EDITOR
 	//~ Settings
 	void RegisterSettings();
@@ -156,7 +169,15 @@ private:
 	void OnSettingsModified(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
 #endif
 
-	void LogRequestExternally(int32 RequestId, const TCHAR* Stage);
+	/** Wrap a websocket route's delegate to record its metrics. */
+	FWebSocketMessageDelegate MakeMeasuredWebSocketDelegate(const FRemoteControlWebsocketRoute& Route);
+
+	/** Print the metrics to the log. */
+	void DumpMetrics();
+
+	//~ Request log console commands
+	void StartRequestLogFile(const TArray<FString>& Args);
+	void StopRequestLogFile();
 
 private:
 	/** Console commands handles. */
@@ -185,9 +206,15 @@ private:
 
 	/** Routes that are editor specific. */
 	FWebRemoteControlEditorRoutes EditorRoutes;
+
+	/** Index used to answer asset searches, built on the first search. */
+	TUniquePtr<FWebRemoteControlAssetSearchIndex> AssetSearchIndex;
+
+	/** Index used to answer actor searches, built on the first search. */
+	TUniquePtr<FWebRemoteControlActorSearchIndex> ActorSearchIndex;
 	
-	/** Handler processing websocket specific messages */
-	TUniquePtr<FWebSocketMessageHandler> WebSocketHandler;
+	/** Handler processing websocket specific messages, shared so asynchronous preset loads can check that it is still alive. */
+	TSharedPtr<FWebSocketMessageHandler> WebSocketHandler;
 	
 	/** Server that serves websocket requests. */
 	FRCWebSocketServer WebSocketServer;
@@ -198,6 +225,22 @@ private:
 	/** Holds the client currently making a request. */
 	FGuid ActingClientId;
 
+	/** Preprocessors a websocket client has passed, along with the settings version they were validated against. */
+	struct FValidatedWebSocketClient
+	{
+		uint32 ClientAccessVersion = 0;
+		/** One bit per default preprocessor, in registration order. */
+		uint32 PassedPreprocessors = 0;
+		/** Session token the client was authenticated with, if any. The client is validated again once it expires or is revoked. */
+		FString SessionToken;
+	};
+
+	/** Websocket clients that were authenticated, so following messages from the same connection skip the preprocessors. */
+	TMap<FGuid, FValidatedWebSocketClient> ValidatedWebSocketClients;
+
+	/** Whether wrapped requests are being invoked. Their response is written to a caller-owned buffer, so they can't be deferred. */
+	bool bIsInvokingWrappedRequest = false;
+
 	/** Whether the HTTP server has been started and has not been stopped. */
 	bool bIsHttpServerRunning = false;
 
@@ -214,8 +257,8 @@ private:
 	 */
 	TArray<FDelegateHandle> AllRegisteredPreprocessorHandlers;
 
-	/** An external web socket logger*/
-	TUniquePtr<class FWebRemoteControlExternalLogger> ExternalLogger;
+	/** Log of the requests, streamed to the external logger server and on demand to a file. */
+	TUniquePtr<class FWebRemoteControlRequestLog> RequestLog;
 
 	//~ Server started stopped delegates.
 	FOnWebServerStarted OnHttpServerStartedDelegate;
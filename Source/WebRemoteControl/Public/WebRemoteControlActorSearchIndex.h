@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SparseArray.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+struct FSearchActorRequest;
+
+/**
+ * Per-world index of actors used to answer actor searches without iterating every actor in the world.
+ * Actors are indexed by class, name and label trigrams, tags and level, and the index is kept up to date from actor spawn and destroy events.
+ */
+class FWebRemoteControlActorSearchIndex
+{
+public:
+	FWebRemoteControlActorSearchIndex();
+	~FWebRemoteControlActorSearchIndex();
+
+	/**
+	 * Search a world for the actors matching a request.
+	 * @param InWorld The world to search.
+	 * @param InRequest The query, class, tags and level the actors must match.
+	 * @param OutActors The matching actors, best match first, then ordered by path.
+	 * @return The total number of matching actors, ignoring the request's offset and limit.
+	 */
+	int32 Search(UWorld* InWorld, const FSearchActorRequest& InRequest, TArray<AActor*>& OutActors);
+
+private:
+	/** An indexed actor, along with the keys it was indexed with. */
+	struct FActorEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<UClass> Class;
+		TObjectKey<ULevel> Level;
+		TArray<FName> Tags;
+		TArray<uint64> Trigrams;
+	};
+
+	/** Index of the actors of a single world. */
+	struct FWorldIndex
+	{
+		TSparseArray<FActorEntry> Entries;
+		TMap<TObjectKey<AActor>, int32> EntryIndices;
+		TMap<TObjectKey<UClass>, TArray<int32>> ClassEntries;
+		TMap<TObjectKey<ULevel>, TArray<int32>> LevelEntries;
+		TMap<FName, TArray<int32>> TagEntries;
+		TMap<uint64, TArray<int32>> TrigramEntries;
+
+		FDelegateHandle ActorSpawnedHandle;
+		FDelegateHandle ActorDestroyedHandle;
+
+		/** Set when the world's actor list changed in a way that can't be tracked incrementally. */
+		bool bIsDirty = false;
+	};
+
+	/** Get the index of a world, building it if needed. */
+	FWorldIndex& GetWorldIndex(UWorld* InWorld);
+
+	/** Index every actor of a world. */
+	void PopulateWorldIndex(UWorld* InWorld, FWorldIndex& InOutIndex);
+
+	/** Stop listening to a world's events and drop its index. */
+	void RemoveWorldIndex(UWorld* InWorld);
+
+	void AddActor(FWorldIndex& InOutIndex, AActor* InActor);
+	void RemoveActor(FWorldIndex& InOutIndex, const AActor* InActor);
+	void ReindexActor(AActor* InActor);
+
+	/** Find the index of the world an actor lives in, if it has been built. */
+	FWorldIndex* FindWorldIndex(const AActor* InActor);
+
+	//~ Engine callbacks.
+	void OnActorSpawned(AActor* InActor);
+	void OnActorDestroyed(AActor* InActor);
+	void OnLevelActorListChanged();
+	void OnLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld);
+	void OnLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld);
+	void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+#if WITH_EDITOR
+	void OnObjectPropertyChanged(UObject* InObject, struct FPropertyChangedEvent& InEvent);
+	void OnObjectTransacted(UObject* InObject, const class FTransactionObjectEvent& InTransactionEvent);
+#endif
+
+private:
+	/** Actor indices of the worlds that have been searched. */
+	TMap<TObjectKey<UWorld>, FWorldIndex> WorldIndices;
+
+	/** Handle to the engine's actor list changed delegate. */
+	FDelegateHandle OnLevelActorListChangedHandle;
+};
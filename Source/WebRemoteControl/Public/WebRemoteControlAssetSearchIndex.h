@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/SparseArray.h"
+#include "RemoteControlRequest.h"
+
+struct FARCompiledFilter;
+
+/**
+ * In-memory index of the asset registry used to answer asset searches by name
+ * without scanning the registry on every request.
+ * Names are indexed by trigrams and the index is kept up to date from the asset registry callbacks.
+ */
+class FWebRemoteControlAssetSearchIndex
+{
+public:
+	FWebRemoteControlAssetSearchIndex() = default;
+	~FWebRemoteControlAssetSearchIndex();
+
+	/**
+	 * Search the index for assets whose name matches the query.
+	 * @param InQuery The text to look for in asset names.
+	 * @param InMode How the query is matched against the asset names.
+	 * @param InFilter Compiled asset registry filter the results must pass.
+	 * @param InPredicate Additional filter the results must pass.
+	 * @param InOffset Number of ranked results to skip.
+	 * @param InLimit Maximum number of results to return.
+	 * @param OutAssets The matching assets, best match first.
+	 * @return The total number of matching assets, ignoring the offset and limit.
+	 */
+	int32 Search(const FString& InQuery, ERCAssetSearchMode InMode, const FARCompiledFilter& InFilter, TFunctionRef<bool(const FAssetData&)> InPredicate, int32 InOffset, int32 InLimit, TArray<FAssetData>& OutAssets);
+
+private:
+	/** An indexed asset. */
+	struct FEntry
+	{
+		FAssetData AssetData;
+		/** Asset name, cached for matching. */
+		FString Name;
+	};
+
+	/** A candidate result and its rank. */
+	struct FScoredEntry
+	{
+		int32 EntryIndex = INDEX_NONE;
+		int32 Score = 0;
+	};
+
+	/** Populate the index from the asset registry and start listening for changes. */
+	void Build();
+
+	/** Stop listening for changes and release the indexed data. */
+	void Reset();
+
+	void AddAsset(const FAssetData& InAssetData);
+	void RemoveAsset(const FSoftObjectPath& InObjectPath);
+
+	//~ Asset registry callbacks.
+	void OnAssetAdded(const FAssetData& InAssetData);
+	void OnAssetRemoved(const FAssetData& InAssetData);
+	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+	void OnAssetUpdated(const FAssetData& InAssetData);
+
+	/** Compute the rank of an entry for a query, returns 0 if it doesn't match. */
+	int32 ScoreEntry(const FEntry& InEntry, const FString& InQuery, ERCAssetSearchMode InMode, int32 InSharedTrigrams, int32 InQueryTrigrams) const;
+
+private:
+	/** Indexed assets. */
+	TSparseArray<FEntry> Entries;
+
+	/** Index of the entry of an asset. */
+	TMap<FSoftObjectPath, int32> EntryIndices;
+
+	/** Entries containing a given trigram. */
+	TMap<uint64, TArray<int32>> TrigramEntries;
+
+	/** Whether the index has been built and is listening for asset registry changes. */
+	bool bIsBuilt = false;
+};
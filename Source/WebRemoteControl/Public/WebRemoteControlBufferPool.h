@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Per thread pools of the byte buffers used to serialize and convert request and response payloads.
+ * Buffers are binned in power of two size classes by capacity, so sustained traffic keeps reusing the same allocations
+ * instead of allocating and freeing a buffer for every payload. Pools are never shared between threads, so no locking is needed.
+ */
+class WEBREMOTECONTROL_API FWebRemoteControlBufferPool
+{
+public:
+	/** Capacity of the smallest size class. */
+	static constexpr int32 MinSizeClassBits = 8;
+	/** Capacity of the largest size class, larger buffers are freed instead of being pooled. */
+	static constexpr int32 MaxSizeClassBits = 24;
+	static constexpr int32 NumSizeClasses = MaxSizeClassBits - MinSizeClassBits + 1;
+	/** Number of free buffers kept by each size class of a thread. */
+	static constexpr int32 MaxFreeBuffersPerSizeClass = 8;
+	/** Total capacity of the free buffers kept by a thread, buffers released past it are freed. */
+	static constexpr int64 MaxIdleBytesPerThread = 16 * 1024 * 1024;
+
+	/**
+	 * Take an empty buffer from the calling thread's pool.
+	 * @param InMinCapacity Capacity the buffer is guaranteed to have.
+	 */
+	static TArray<uint8> Acquire(int32 InMinCapacity = 0);
+
+	/**
+	 * Give a buffer back to the calling thread's pool, it is emptied but keeps its allocation.
+	 * @param InAcquiredCapacity Capacity of the buffer when it was acquired, the buffer may have grown since.
+	 */
+	static void Release(TArray<uint8>&& InBuffer, int32 InAcquiredCapacity);
+};
+
+/**
+ * Size of the last payload written by a call site, used to acquire its next buffer with enough capacity up front
+ * instead of growing it while the payload is written. Call sites keep one as a function local static.
+ */
+struct FWebRemoteControlBufferSizeHint
+{
+	std::atomic<int32> LastSize = 0;
+};
+
+/**
+ * Buffer taken from the calling thread's pool for the duration of a scope.
+ * Giving it back is O(1), the buffer just goes back on the free list of its size class.
+ */
+class FWebRemoteControlPooledBuffer
+{
+public:
+	explicit FWebRemoteControlPooledBuffer(int32 InMinCapacity = 0)
+		: Buffer(FWebRemoteControlBufferPool::Acquire(InMinCapacity))
+		, AcquiredCapacity(Buffer.Max())
+	{
+	}
+
+	/** Acquire a buffer large enough for the last payload written with this size hint, which is updated on release. */
+	explicit FWebRemoteControlPooledBuffer(FWebRemoteControlBufferSizeHint& InSizeHint)
+		: Buffer(FWebRemoteControlBufferPool::Acquire(InSizeHint.LastSize.load(std::memory_order_relaxed)))
+		, AcquiredCapacity(Buffer.Max())
+		, SizeHint(&InSizeHint)
+	{
+	}
+
+	~FWebRemoteControlPooledBuffer()
+	{
+		if (SizeHint)
+		{
+			SizeHint->LastSize.store(Buffer.Num(), std::memory_order_relaxed);
+		}
+
+		FWebRemoteControlBufferPool::Release(MoveTemp(Buffer), AcquiredCapacity);
+	}
+
+	FWebRemoteControlPooledBuffer(const FWebRemoteControlPooledBuffer&) = delete;
+	FWebRemoteControlPooledBuffer& operator=(const FWebRemoteControlPooledBuffer&) = delete;
+
+	TArray<uint8>& Get() { return Buffer; }
+	const TArray<uint8>& Get() const { return Buffer; }
+
+	operator TArray<uint8>&() { return Buffer; }
+	operator TConstArrayView<uint8>() const { return Buffer; }
+
+private:
+	TArray<uint8> Buffer;
+	int32 AcquiredCapacity;
+	FWebRemoteControlBufferSizeHint* SizeHint = nullptr;
+};
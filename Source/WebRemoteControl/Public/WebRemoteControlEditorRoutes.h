@@ -10,7 +10,6 @@
 #include "IRemoteControlModule.h"
 #include "HttpServerResponse.h"
 #include "RemoteControlRoute.h"
-#include "WebRemoteControlExternalLogger.h"
 
 struct FHttpServerRequest;
 class FWebRemoteControlModule;
@@ -83,11 +82,16 @@ private:
 	bool HandleObjectEventRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleGetThumbnailRoute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** LRU cache of encoded thumbnails, shared with the background encoding tasks. */
+	struct FThumbnailCache;
+
 private:
 	/** Remote event mechanism delegate handles. */
 	TArray<FRemoteEventDispatcher> EventDispatchers;
 	/** Holds all the editor routes. */
 	TArray<FRemoteControlRoute> Routes;
+	/** Encoded thumbnails keyed by asset path, invalidated when the package is saved. */
+	TSharedPtr<FThumbnailCache> ThumbnailCache;
 };
 #else
 class FWebRemoteControlEditorRoutes
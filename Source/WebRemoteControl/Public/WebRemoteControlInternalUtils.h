@@ -28,6 +28,11 @@ namespace RemotePayloadSerializer
 	 */
 	EHttpServerRequestVerbs ParseHttpVerb(FName InVerb);
 
+	/**
+	 * Converts a verb to its string representation.
+	 */
+	FName GetHttpVerbName(EHttpServerRequestVerbs InVerb);
+
 	/**
 	 * Unwrap a request wrapper, while copying headers and http version from a template request if available.
 	 */
@@ -53,6 +58,7 @@ namespace WebRemoteControlInternalUtils
 	static const TCHAR* OriginHeader = TEXT("Origin");
 	static const TCHAR* ForwardedIPHeader = TEXT("x-forwarded-for");
 	static const TCHAR* InvalidPassphraseError = TEXT("Given Passphrase is not correct!");
+	static const TCHAR* SessionTokenHeader = TEXT("Session-Token");
 
 	/**
 	 * Construct a default http response with CORS headers.
@@ -464,4 +470,23 @@ namespace WebRemoteControlInternalUtils
 
 	/** Checking ApiKey using Md5. */
 	bool CheckPassphrase(const FString& HashedPassphrase);
+
+	/**
+	 * Create a session token that can be used in place of the passphrase until it expires.
+	 * @param OutLifetimeSeconds Number of seconds the token stays valid for.
+	 * @return The new token, empty if no secure random bytes could be generated for it.
+	 */
+	FString CreateSessionToken(int32& OutLifetimeSeconds);
+
+	/** Revoke a session token before it expires. */
+	void RevokeSessionToken(const FString& SessionToken);
+
+	/** Whether a session token was issued, hasn't expired and was issued under the current access settings. */
+	bool CheckSessionToken(const FString& SessionToken);
+
+	/** Find the session token carried by a request, nullptr if it has none or it isn't valid. */
+	const FString* FindValidSessionToken(const FHttpServerRequest& Request);
+
+	/** Whether a request carries a valid session token. */
+	bool HasValidSessionToken(const FHttpServerRequest& Request);
 }
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+
+/**
+ * Lock-free histogram with logarithmic buckets, each power of two being split in linear sub-buckets.
+ * Values are recorded with a relative precision of 1 / 2^SubBucketBits, which is enough to report latency percentiles.
+ */
+class WEBREMOTECONTROL_API FRCMetricsHistogram
+{
+public:
+	/** Number of bits used for the sub-buckets of a power of two. */
+	static constexpr int32 SubBucketBits = 3;
+	static constexpr int32 NumSubBuckets = 1 << SubBucketBits;
+	/** Values are clamped to 2^MaxValueBits - 1. */
+	static constexpr int32 MaxValueBits = 40;
+	static constexpr int32 NumBuckets = (MaxValueBits - SubBucketBits + 1) * NumSubBuckets;
+
+	FRCMetricsHistogram() = default;
+	FRCMetricsHistogram(const FRCMetricsHistogram&) = delete;
+	FRCMetricsHistogram& operator=(const FRCMetricsHistogram&) = delete;
+
+	/** Record a value, can be called from any thread. */
+	void Record(uint64 InValue);
+
+	/** Number of values recorded. */
+	uint64 GetCount() const { return Count.load(std::memory_order_relaxed); }
+
+	/** Sum of the values recorded. */
+	uint64 GetSum() const { return Sum.load(std::memory_order_relaxed); }
+
+	/** Get an approximation of the value below which a fraction of the recorded values are. */
+	uint64 GetPercentile(double InFraction) const;
+
+	/** Discard the recorded values. */
+	void Reset();
+
+private:
+	static int32 GetBucketIndex(uint64 InValue);
+
+	/** Get the value reported for a bucket, the middle of its range. */
+	static uint64 GetBucketValue(int32 InBucketIndex);
+
+private:
+	std::atomic<uint64> Buckets[NumBuckets] = {};
+	std::atomic<uint64> Count{ 0 };
+	std::atomic<uint64> Sum{ 0 };
+};
+
+/** Records the time spent in a scope in microseconds. */
+class FRCMetricsScopedTimer
+{
+public:
+	explicit FRCMetricsScopedTimer(FRCMetricsHistogram& InHistogram)
+		: Histogram(InHistogram)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FRCMetricsScopedTimer()
+	{
+		Histogram.Record(static_cast<uint64>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0));
+	}
+
+private:
+	FRCMetricsHistogram& Histogram;
+	uint64 StartCycles;
+};
+
+/**
+ * Counters and histograms describing how Web Remote Control performs.
+ * Durations are recorded in microseconds and sizes in bytes. The metrics can be read in the Prometheus text format
+ * from the /remote/metrics route or with the WebControl.Metrics.Dump console command.
+ */
+class WEBREMOTECONTROL_API FWebRemoteControlMetrics
+{
+public:
+	/** Metrics of an http route or of a websocket message type. */
+	struct FRouteMetrics
+	{
+		/** Number of requests handled. */
+		std::atomic<uint64> Requests{ 0 };
+		/** Number of requests that were responded to with an error code. */
+		std::atomic<uint64> Errors{ 0 };
+		/** Time between receiving the request and responding to it. */
+		FRCMetricsHistogram Latency;
+		/** Size of the request payloads. */
+		FRCMetricsHistogram RequestSize;
+		/** Size of the response payloads, only recorded for http routes. */
+		FRCMetricsHistogram ResponseSize;
+	};
+
+	static FWebRemoteControlMetrics& Get();
+
+	/**
+	 * Get the metrics of an http route, the returned reference stays valid until shutdown.
+	 * @param InRouteName Name of the route, usually its verb followed by its path.
+	 */
+	FRouteMetrics& FindOrAddHttpRoute(const FString& InRouteName);
+
+	/** Get the metrics of a websocket message type, the returned reference stays valid until shutdown. */
+	FRouteMetrics& FindOrAddWebSocketRoute(const FString& InMessageName);
+
+	/** Write every metric in the Prometheus text exposition format. */
+	void WritePrometheus(FStringBuilderBase& OutText) const;
+
+	/** Discard all recorded values. */
+	void Reset();
+
+public:
+	/** Time spent serializing messages to JSON. */
+	FRCMetricsHistogram SerializationTime;
+
+	/** Number of clients a websocket event is sent to. */
+	FRCMetricsHistogram EventFanOut;
+
+	/** Size of compressed websocket messages relative to their uncompressed size, in per mille. */
+	FRCMetricsHistogram CompressionRatio;
+
+	/** Total size of the websocket messages sent to clients that requested compression, before and after compressing them. */
+	std::atomic<uint64> UncompressedBytes{ 0 };
+	std::atomic<uint64> CompressedBytes{ 0 };
+
+	/** Time spent sending websocket events at the end of each frame. */
+	FRCMetricsHistogram EndFrameTime;
+
+	/** Time spent ticking the websocket server each frame. */
+	FRCMetricsHistogram WebSocketServerTickTime;
+
+	/** Number of payload buffers reused from a thread's pool, and allocated because the pool had none. */
+	std::atomic<uint64> PooledBufferHits{ 0 };
+	std::atomic<uint64> PooledBufferMisses{ 0 };
+
+	/** Capacity of the pooled payload buffers currently in use, and the most that was in use at once. */
+	std::atomic<uint64> PooledBufferBytesInUse{ 0 };
+	std::atomic<uint64> PooledBufferPeakBytes{ 0 };
+
+	/** Capacity of the free buffers kept in the threads' pools for reuse. */
+	std::atomic<uint64> PooledBufferIdleBytes{ 0 };
+
+private:
+	FRouteMetrics& FindOrAddRoute(TMap<FString, TUniquePtr<FRouteMetrics>>& InRoutes, const FString& InName);
+
+private:
+	/** Protects the route maps, the metrics themselves are only updated atomically. */
+	mutable FRWLock RoutesLock;
+	TMap<FString, TUniquePtr<FRouteMetrics>> HttpRoutes;
+	TMap<FString, TUniquePtr<FRouteMetrics>> WebSocketRoutes;
+};
@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Pipe.h"
+#include "Templates/SharedPointer.h"
+#include <atomic>
+
+class FArchive;
+class INetworkingWebSocket;
+
+/** Stage of a request's handling at which a record was written. */
+enum class ERCRequestLogStage : uint8
+{
+	/** The request was received, the payload size is the request's size. */
+	Received,
+	/** The request was handled, the payload size is the response's size. */
+	Processed,
+	/** The response was sent back to the client. */
+	Sent
+};
+
+/** Fixed-size record of a request log, written as is to the log streams. */
+struct FRCRequestLogRecord
+{
+	/** Time the record was written at, in FPlatformTime::Seconds. */
+	double Timestamp = 0.0;
+	/** Client that made the request. */
+	FGuid ClientId;
+	/** Id of the route targeted by the request, its name is sent in the stream before any record using it. */
+	uint32 RouteId = 0;
+	/** Id given to the request by the client. */
+	int32 RequestId = INDEX_NONE;
+	/** Engine frame the record was written on. */
+	uint32 Frame = 0;
+	/** Time spent since the previous stage of the request, in microseconds. */
+	uint32 DurationMicroseconds = 0;
+	/** Size of the request or response payload, in bytes. */
+	uint32 PayloadSize = 0;
+	ERCRequestLogStage Stage = ERCRequestLogStage::Received;
+	uint8 Padding[3] = {};
+};
+
+static_assert(sizeof(FRCRequestLogRecord) == 48, "The request log record layout is part of the stream format.");
+
+/**
+ * Structured request log with a low overhead, so it can stay enabled on production servers.
+ * Records are written to a fixed-size ring buffer without any formatting and are drained on tick
+ * to the external logger websocket and, on demand, to a file.
+ *
+ * The streams are made of chunks, each starting with a uint32 chunk type and a uint32 count:
+ *   - Records: the count is followed by that many FRCRequestLogRecord.
+ *   - RouteNames: the count is followed by that many route definitions (uint32 route id, uint32 byte length, UTF-8 route).
+ *   - Dropped: the count is the number of records that were overwritten before they could be drained.
+ * Files additionally start with the FileMagic and FileVersion uint32s. All values are little-endian.
+ */
+class FWebRemoteControlRequestLog
+{
+public:
+	enum class EChunkType : uint32
+	{
+		Records = 1,
+		RouteNames = 2,
+		Dropped = 3
+	};
+
+	static constexpr uint32 FileMagic = 0x4c524352; // "RCRL"
+	static constexpr uint32 FileVersion = 1;
+
+	FWebRemoteControlRequestLog();
+	~FWebRemoteControlRequestLog();
+
+	/**
+	 * Whether a request's records should be written, according to the sample rate.
+	 * Requests are sampled as a whole so their stages can be matched in the log.
+	 */
+	bool ShouldLogRequest(const FGuid& InClientId, int32 InRequestId) const;
+
+	/**
+	 * Get the id of a route, query parameters excluded.
+	 * Must be called on the game thread.
+	 */
+	uint32 GetRouteId(FStringView InRoute);
+
+	/** Write a record to the ring buffer, can be called from any thread. */
+	void Log(ERCRequestLogStage InStage, uint32 InRouteId, const FGuid& InClientId, int32 InRequestId, uint32 InDurationMicroseconds, uint32 InPayloadSize);
+
+	/** Stream the log to an external logger server. Passing nullptr stops streaming. */
+	void SetWebSocketConnection(TSharedPtr<INetworkingWebSocket> InWebSocketConnection);
+
+	/**
+	 * Start writing the log to a file, beginning with the records still held in the ring buffer.
+	 * @return Whether the file could be opened.
+	 */
+	bool StartFile(const FString& InFilename);
+
+	/** Flush the log and close the file. */
+	void StopFile();
+
+private:
+	/**
+	 * A slot of the ring buffer. The sequence is odd while a record is being written and even once it's written,
+	 * it's 2 * Index + 1 then 2 * Index + 2 for the record of a given index, so a drain can tell which lap the slot holds.
+	 */
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence{ 0 };
+		FRCRequestLogRecord Record;
+	};
+
+	bool OnTick(float DeltaSeconds);
+
+	/** Copy the records written since the last drain and send them to the streams. */
+	void Drain();
+
+	/** Serialize the route names registered since the last drain, or all of them. */
+	void WriteRouteNamesChunk(bool bAllRoutes, TArray<uint8>& OutChunk);
+
+	/** Send a chunk to the websocket connection and the file. */
+	void SendChunk(TArray<uint8>&& InChunk);
+
+	/** Append a chunk to the file from the file writing pipe. */
+	void WriteToFile(TArray<uint8>&& InChunk);
+
+	/** Whether the log has anywhere to stream to. */
+	bool HasStreams() const;
+
+	/** Start or stop ticking depending on whether there are streams. */
+	void UpdateTicker();
+
+private:
+	/** Ring buffer of records, its size is a power of two. */
+	TUniquePtr<FSlot[]> Slots;
+	uint64 SlotMask = 0;
+
+	/** Index of the next record to write. */
+	std::atomic<uint64> WriteIndex{ 0 };
+
+	/** Index of the next record to drain. */
+	uint64 ReadIndex = 0;
+
+	/** Names of the routes seen so far. */
+	TMap<uint32, FString> RouteNames;
+
+	/** Routes whose names haven't been sent yet. */
+	TArray<uint32> PendingRouteNames;
+
+	/** Connection to the external logger server. */
+	TSharedPtr<INetworkingWebSocket> WebSocketConnection;
+	bool bIsWebSocketConnected = false;
+
+	/** File the log is being written to, only accessed from the file writing pipe. */
+	TSharedPtr<FArchive> FileWriter;
+	bool bIsWritingFile = false;
+
+	/** Serializes the file writes off the game thread. */
+	UE::Tasks::FPipe FilePipe{ TEXT("WebRemoteControlRequestLog") };
+
+	/** A handle to the ticker callback. */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Name matching shared by the asset and actor search indices.
+ */
+namespace WebRemoteControlSearchUtils
+{
+	/**
+	 * Whether a character starts a new word in a name, ie. SM_RockLarge01 has the tokens SM, Rock, Large and 01.
+	 */
+	bool IsTokenStart(const FString& InName, int32 InIndex);
+
+	/**
+	 * Append the case-insensitive trigrams of a name that are not already in the array.
+	 */
+	void GetTrigrams(const FString& InName, TArray<uint64>& OutTrigrams);
+
+	/**
+	 * Rank a name against a query, ignoring case.
+	 * Exact matches rank highest, then prefixes, word prefixes and substrings. A shorter name ranks higher within the same kind of match.
+	 * @param bPrefixOnly Only accept names that start with the query or where a word starts with it.
+	 * @return The rank of the name, or 0 if it doesn't match.
+	 */
+	int32 ScoreName(const FString& InName, const FString& InQuery, bool bPrefixOnly);
+
+	/**
+	 * Rank a name that doesn't contain the query but shares some of its trigrams.
+	 * @return The rank of the name, or 0 if it shares less than half of the query's trigrams.
+	 */
+	int32 ScoreFuzzyName(const FString& InName, const FString& InQuery, int32 InSharedTrigrams, int32 InQueryTrigrams);
+}
@@ -8,6 +8,8 @@
 #include "Serialization/MemoryWriter.h"
 #include "StructDeserializer.h"
 #include "StructSerializer.h"
+#include "WebRemoteControlBufferPool.h"
+#include "WebRemoteControlMetrics.h"
 
 struct FBlockDelimiters;
 
@@ -52,11 +54,14 @@ namespace WebRemoteControlUtils
 	template <typename MessageType>
 	void SerializeMessage(const MessageType& InMessageObject, TArray<uint8>& OutMessagePayload)
 	{
-		TArray<uint8> WorkingBuffer;
-		FMemoryWriter Writer(WorkingBuffer);
+		FRCMetricsScopedTimer SerializationTimer(FWebRemoteControlMetrics::Get().SerializationTime);
+
+		static FWebRemoteControlBufferSizeHint WorkingBufferSizeHint;
+		FWebRemoteControlPooledBuffer WorkingBuffer(WorkingBufferSizeHint);
+		FMemoryWriter Writer(WorkingBuffer.Get());
 		TSharedRef<IStructSerializerBackend> SerializerBackend = CreateJsonSerializerBackend(Writer);
 		FStructSerializer::Serialize(InMessageObject, SerializerBackend.Get(), FStructSerializerPolicies());
-		ConvertToUTF8(WorkingBuffer, OutMessagePayload);
+		ConvertToUTF8(WorkingBuffer.Get(), OutMessagePayload);
 	}
 
 	/**
@@ -24,7 +24,7 @@ class FWebRemoteControlModule;
 /**
   * Class handling web socket message. Registers to required callbacks.
  */
-class FWebSocketMessageHandler
+class FWebSocketMessageHandler : public TSharedFromThis<FWebSocketMessageHandler>
 {
 public: 
 	FWebSocketMessageHandler(FRCWebSocketServer* InServer, const FGuid& InActingClientId);
@@ -79,6 +79,21 @@ private:
 		TArray<FRCActorDescription> Actors;
 	};
 
+	/**
+	 * Numeric handles assigned to the exposed properties of a preset.
+	 */
+	struct FPresetFieldHandleTable
+	{
+		/** Exposed property IDs indexed by handle. Unexposed properties leave an invalid ID behind so other handles stay stable. */
+		TArray<FGuid> Fields;
+
+		/** Reverse lookup from an exposed property ID to its handle. */
+		TMap<FGuid, int32> HandlesById;
+
+		/** Get the handle of a field, assigning a new one if needed. */
+		int32 FindOrAddHandle(const FGuid& FieldId);
+	};
+
 
 	/** Register a WebSocket route */
 	void RegisterRoute(FWebRemoteControlModule* WebRemoteControl, TUniquePtr<FRemoteControlWebsocketRoute> Route);
@@ -89,6 +104,9 @@ private:
 	/** Handles registration to callbacks to a given preset */
 	void HandleWebSocketPresetRegister(const FRemoteControlWebSocketMessage& WebSocketMessage);
 
+	/** Registers a client to the callbacks of a preset once it has been resolved */
+	void RegisterClientToPreset(URemoteControlPreset* Preset, FGuid ClientId, bool bIgnoreRemoteChanges);
+
 	/** Handles unregistration to callbacks to a given preset */
 	void HandleWebSocketPresetUnregister(const FRemoteControlWebSocketMessage& WebSocketMessage);
 
@@ -104,6 +122,15 @@ private:
 	/** Handles property modification for a given preset */
 	void HandleWebSocketPresetModifyProperty(const FRemoteControlWebSocketMessage& WebSocketMessage);
 
+	/** Handles the handshake returning numeric handles for a preset's exposed properties */
+	void HandleWebSocketPresetFieldHandles(const FRemoteControlWebSocketMessage& WebSocketMessage);
+
+	/** Handles property modification for a property identified by handles */
+	void HandleWebSocketPresetModifyPropertyByHandle(const FRemoteControlWebSocketMessage& WebSocketMessage);
+
+	/** Handles reading the value of a property identified by handles */
+	void HandleWebSocketPresetGetPropertyByHandle(const FRemoteControlWebSocketMessage& WebSocketMessage);
+
 	/** Handles calling a Blueprint function */
 	void HandleWebSocketFunctionCall(const FRemoteControlWebSocketMessage& WebSocketMessage);
 
@@ -120,6 +147,8 @@ private:
 	void OnPresetExposedPropertiesModified(URemoteControlPreset* Owner, const TSet<FGuid>& ModifiedPropertyIds);
 	void OnPropertyExposed(URemoteControlPreset* Owner,  const FGuid& EntityId);
 	void OnPropertyUnexposed(URemoteControlPreset* Owner, const FGuid& EntityId);
+	void OnPropertiesExposed(URemoteControlPreset* Owner, const TArray<FGuid>& EntityIds);
+	void OnPropertiesUnexposed(URemoteControlPreset* Owner, const TArray<FGuid>& EntityIds);
 	void OnFieldRenamed(URemoteControlPreset* Owner, FName OldFieldLabel, FName NewFieldLabel);
 	void OnMetadataModified(URemoteControlPreset* Owner);
 	void OnActorPropertyChanged(URemoteControlPreset* Owner, FRemoteControlActor& Actor, UObject* ModifiedObject, FProperty* ModifiedProperty);
@@ -217,10 +246,37 @@ private:
 	 * @param InTargetClientId Client Id to send the message
 	 * @param InModifiedPropertyIds Set of modified properties already divided by type
 	 * @param InSequenceNumber SequenceNumber of the client
+	 * @param InFieldHandles If set, events are written using the preset's field handles instead of labels.
 	 * @return True if multiple booleans property are found and sent, false if they are not found or if not all of them are sent.
 	 */
-	bool TrySendMultipleBoolProperties(URemoteControlPreset* InPreset, const FGuid& InTargetClientId, const TSet<FGuid>& InModifiedPropertyIds, int64 InSequenceNumber);
+	bool TrySendMultipleBoolProperties(URemoteControlPreset* InPreset, const FGuid& InTargetClientId, const TSet<FGuid>& InModifiedPropertyIds, int64 InSequenceNumber, const FPresetFieldHandleTable* InFieldHandles = nullptr);
 	
+	/**
+	 * Write the provided list of events to a buffer, identifying the preset and its properties with numeric handles.
+	 */
+	bool WritePropertyChangeByHandleEventPayload(URemoteControlPreset* InPreset, const FPresetFieldHandleTable& InFieldHandles, const TSet<FGuid>& InModifiedPropertyIds, int64 InSequenceNumber, TArray<uint8>& OutBuffer, const TCHAR* InEventType = TEXT("PresetFieldsChangedByHandle"));
+
+	/**
+	 * Get the handle of a preset, assigning one and synchronizing its field handle table if needed.
+	 */
+	int32 FindOrAddPresetHandle(URemoteControlPreset* InPreset);
+
+	/**
+	 * Resolve a property from its preset and field handles.
+	 * @return The property, or an invalid pointer if either handle is stale or unknown.
+	 */
+	TSharedPtr<FRemoteControlProperty> ResolvePropertyHandle(int32 InPresetHandle, int32 InFieldHandle, URemoteControlPreset*& OutPreset) const;
+
+	/**
+	 * Returns the field handle table to use for events sent to a client about a preset, or nullptr if the client uses labels.
+	 */
+	const FPresetFieldHandleTable* GetClientFieldHandles(const FGuid& ClientId, const FGuid& PresetId) const;
+
+	/**
+	 * Send the field handle table of a preset to a client.
+	 */
+	void SendPresetFieldHandles(URemoteControlPreset* InPreset, const FGuid& InTargetClientId);
+
 	/**
 	 * Write the provided list of controller events to a buffer.
 	 */
@@ -361,11 +417,20 @@ private:
 	{
 		/** Whether the client ignores events that were initiated remotely. */
 		bool bIgnoreRemoteChanges = false;	
+
+		/** Presets for which the client wants property change events to use field handles. */
+		TSet<FGuid> PresetsUsingFieldHandles;
 	};
 
 	/** Holds client-specific config if any. */
 	TMap<FGuid, FRCClientConfig> ClientConfigMap;
 
+	/** Preset IDs indexed by preset handle. Handles are never reused while the server is running. */
+	TArray<FGuid> PresetHandles;
+
+	/** Field handle tables, per preset. */
+	TMap<FGuid, FPresetFieldHandleTable> PresetFieldHandles;
+
 	/** The largest sequence number received from each client. */
 	TMap<FGuid, int64> ClientSequenceNumbers;
 
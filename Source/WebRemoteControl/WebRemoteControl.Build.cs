@@ -20,6 +20,7 @@ public class WebRemoteControl : ModuleRules
 				"AssetRegistry",
 				"HTTP",
 				"Networking",
+				"PlatformCrypto",
 				"RemoteControl",
 				"RemoteControlCommon",
 				"RemoteControlLogic",
@@ -0,0 +1,651 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WebRemoteControlBenchmarkCommandlet.h"
+
+#include "Algo/AllOf.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HttpModule.h"
+#include "IRemoteControlModule.h"
+#include "IWebSocket.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/CommandLine.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "RemoteControlFieldPath.h"
+#include "RemoteControlPreset.h"
+#include "RemoteControlSettings.h"
+#include "Serialization/JsonWriter.h"
+#include "String/Find.h"
+#include "UObject/Package.h"
+#include "WebRemoteControl.h"
+#include "WebRemoteControlInternalUtils.h"
+#include "WebRemoteControlMetrics.h"
+#include "WebSocketsModule.h"
+
+namespace WebRemoteControlBenchmark
+{
+	/** Maximum time to wait for in-flight requests once a scenario is over. */
+	constexpr double DrainTimeout = 5.0;
+
+	/** Maximum time to wait for the websocket clients to connect. */
+	constexpr double ConnectTimeout = 10.0;
+
+	/** Maximum time to wait for every listener to receive an event before counting it as an error. */
+	constexpr double EventTimeout = 1.0;
+
+	/** Type of the exposed fields, one per property of URCBenchmarkTarget. */
+	enum class EFieldType : uint8
+	{
+		Float,
+		Int,
+		Vector,
+		Color,
+		String,
+		Array,
+		Count
+	};
+
+	const TCHAR* GetFieldPropertyName(EFieldType InType)
+	{
+		switch (InType)
+		{
+		case EFieldType::Float: return TEXT("FloatValue");
+		case EFieldType::Int: return TEXT("IntValue");
+		case EFieldType::Vector: return TEXT("VectorValue");
+		case EFieldType::Color: return TEXT("ColorValue");
+		case EFieldType::String: return TEXT("StringValue");
+		case EFieldType::Array: return TEXT("ArrayValue");
+		default: checkNoEntry(); return TEXT("");
+		}
+	}
+
+	/** Generate a JSON value for a field that changes with each iteration so every set modifies the property. */
+	FString MakeFieldValue(EFieldType InType, uint32 InIteration)
+	{
+		const double Value = static_cast<double>(InIteration % 1000) * 0.5;
+		switch (InType)
+		{
+		case EFieldType::Float: return FString::Printf(TEXT("%g"), Value);
+		case EFieldType::Int: return FString::Printf(TEXT("%u"), InIteration % 100000);
+		case EFieldType::Vector: return FString::Printf(TEXT("{\"X\":%g,\"Y\":%g,\"Z\":%g}"), Value, Value + 1.0, Value + 2.0);
+		case EFieldType::Color: return FString::Printf(TEXT("{\"R\":%g,\"G\":%g,\"B\":%g,\"A\":1}"), Value / 500.0, 1.0 - Value / 500.0, 0.5);
+		case EFieldType::String: return FString::Printf(TEXT("\"Value %u\""), InIteration);
+		case EFieldType::Array: return FString::Printf(TEXT("[%g,%g,%g,%g]"), Value, Value + 1.0, Value + 2.0, Value + 3.0);
+		default: checkNoEntry(); return FString();
+		}
+	}
+
+	struct FField
+	{
+		FString Label;
+		EFieldType Type;
+	};
+
+	struct FBenchmarkSettings
+	{
+		int32 NumFields = 60;
+		double Duration = 10.0;
+		int32 Concurrency = 8;
+		int32 NumListeners = 16;
+		int32 BatchSize = 16;
+		TArray<FString> Scenarios;
+		FString Passphrase;
+		FString OutputFile;
+		uint32 HttpPort = 30010;
+		uint32 WebSocketPort = 30020;
+	};
+
+	/** Description of the preset the scenarios run against. */
+	struct FBenchmarkPreset
+	{
+		FString Name;
+		TArray<FField> Fields;
+		TArray<FString> TargetPaths;
+	};
+
+	/** Outcome of a scenario, latencies are recorded in microseconds. */
+	struct FScenarioResult
+	{
+		FString Name;
+		/** Number of requests sent. */
+		uint64 Requests = 0;
+		/** Number of requests that failed or timed out. */
+		uint64 Errors = 0;
+		/** Time the scenario ran for, in seconds. */
+		double Duration = 0.0;
+		FRCMetricsHistogram Latency;
+	};
+
+	uint64 GetElapsedMicroseconds(uint64 InStartCycles)
+	{
+		return static_cast<uint64>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - InStartCycles) * 1000.0);
+	}
+
+	/**
+	 * Run engine frames until the predicate is satisfied or the timeout expires.
+	 * Commandlets don't run the engine loop, so tick what the servers and clients rely on.
+	 * @return Whether the predicate was satisfied.
+	 */
+	bool PumpFramesUntil(TFunctionRef<bool()> InPredicate, double InTimeout)
+	{
+		double LastTime = FPlatformTime::Seconds();
+		const double EndTime = LastTime + InTimeout;
+		while (!InPredicate())
+		{
+			const double Now = FPlatformTime::Seconds();
+			if (Now >= EndTime || IsEngineExitRequested())
+			{
+				return false;
+			}
+
+			FCoreDelegates::OnBeginFrame.Broadcast();
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTime));
+			FCoreDelegates::OnEndFrame.Broadcast();
+			++GFrameCounter;
+			LastTime = Now;
+
+			FPlatformProcess::SleepNoStats(0.0f);
+		}
+
+		return true;
+	}
+
+	void PumpFrames(double InDuration)
+	{
+		PumpFramesUntil([]() { return false; }, InDuration);
+	}
+
+	/** Http client sending a new request as soon as the previous one completes, until the scenario ends. */
+	class FHttpClientLoop : public TSharedFromThis<FHttpClientLoop>
+	{
+	public:
+		using FPrepareRequest = TFunction<void(uint32 /*Iteration*/, IHttpRequest& /*Request*/)>;
+
+		FHttpClientLoop(FScenarioResult& InResult, const FPrepareRequest& InPrepareRequest, const FBenchmarkSettings& InSettings, uint32 InClientIndex, double InEndTime)
+			: Result(InResult)
+			, PrepareRequest(InPrepareRequest)
+			, Passphrase(InSettings.Passphrase)
+			, Iteration(InClientIndex)
+			, IterationStep(InSettings.Concurrency)
+			, EndTime(InEndTime)
+		{
+		}
+
+		void SendNextRequest()
+		{
+			if (FPlatformTime::Seconds() >= EndTime)
+			{
+				bInFlight = false;
+				return;
+			}
+
+			TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+			Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+			if (!Passphrase.IsEmpty())
+			{
+				Request->SetHeader(WebRemoteControlInternalUtils::PassphraseHeader, Passphrase);
+			}
+
+			PrepareRequest(Iteration, *Request);
+			Iteration += IterationStep;
+
+			Request->OnProcessRequestComplete().BindSP(this, &FHttpClientLoop::OnRequestComplete, FPlatformTime::Cycles64());
+			bInFlight = true;
+			++Result.Requests;
+			Request->ProcessRequest();
+		}
+
+		bool IsInFlight() const { return bInFlight; }
+
+	private:
+		void OnRequestComplete(FHttpRequestPtr InRequest, FHttpResponsePtr InResponse, bool bConnectedSuccessfully, uint64 InStartCycles)
+		{
+			Result.Latency.Record(GetElapsedMicroseconds(InStartCycles));
+
+			if (!bConnectedSuccessfully || !InResponse || !EHttpResponseCodes::IsOk(InResponse->GetResponseCode()))
+			{
+				++Result.Errors;
+			}
+
+			SendNextRequest();
+		}
+
+	private:
+		FScenarioResult& Result;
+		FPrepareRequest PrepareRequest;
+		FString Passphrase;
+		uint32 Iteration;
+		uint32 IterationStep;
+		double EndTime;
+		bool bInFlight = false;
+	};
+
+	void RunHttpScenario(FScenarioResult& OutResult, const FBenchmarkSettings& InSettings, const FHttpClientLoop::FPrepareRequest& InPrepareRequest)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		TArray<TSharedRef<FHttpClientLoop>> Clients;
+		for (int32 ClientIndex = 0; ClientIndex < InSettings.Concurrency; ++ClientIndex)
+		{
+			TSharedRef<FHttpClientLoop> Client = MakeShared<FHttpClientLoop>(OutResult, InPrepareRequest, InSettings, ClientIndex, StartTime + InSettings.Duration);
+			Client->SendNextRequest();
+			Clients.Add(MoveTemp(Client));
+		}
+
+		PumpFramesUntil([&Clients]()
+		{
+			return Algo::AllOf(Clients, [](const TSharedRef<FHttpClientLoop>& Client) { return !Client->IsInFlight(); });
+		}, InSettings.Duration + DrainTimeout);
+
+		OutResult.Duration = FPlatformTime::Seconds() - StartTime;
+	}
+
+	FString GetPropertyUrl(const FBenchmarkSettings& InSettings, const FBenchmarkPreset& InPreset, const FField& InField)
+	{
+		return FString::Printf(TEXT("http://127.0.0.1:%u/remote/preset/%s/property/%s"), InSettings.HttpPort, *InPreset.Name, *InField.Label);
+	}
+
+	void RunGetScenario(FScenarioResult& OutResult, const FBenchmarkSettings& InSettings, const FBenchmarkPreset& InPreset)
+	{
+		RunHttpScenario(OutResult, InSettings, [&InSettings, &InPreset](uint32 Iteration, IHttpRequest& Request)
+		{
+			Request.SetVerb(TEXT("GET"));
+			Request.SetURL(GetPropertyUrl(InSettings, InPreset, InPreset.Fields[Iteration % InPreset.Fields.Num()]));
+		});
+	}
+
+	void RunSetScenario(FScenarioResult& OutResult, const FBenchmarkSettings& InSettings, const FBenchmarkPreset& InPreset)
+	{
+		RunHttpScenario(OutResult, InSettings, [&InSettings, &InPreset](uint32 Iteration, IHttpRequest& Request)
+		{
+			const FField& Field = InPreset.Fields[Iteration % InPreset.Fields.Num()];
+			Request.SetVerb(TEXT("PUT"));
+			Request.SetURL(GetPropertyUrl(InSettings, InPreset, Field));
+			Request.SetContentAsString(FString::Printf(TEXT("{\"PropertyValue\":%s,\"GenerateTransaction\":false}"), *MakeFieldValue(Field.Type, Iteration)));
+		});
+	}
+
+	void RunBatchScenario(FScenarioResult& OutResult, const FBenchmarkSettings& InSettings, const FBenchmarkPreset& InPreset)
+	{
+		RunHttpScenario(OutResult, InSettings, [&InSettings, &InPreset](uint32 Iteration, IHttpRequest& Request)
+		{
+			TStringBuilder<4096> Body;
+			Body << TEXT("{\"Requests\":[");
+			for (int32 Index = 0; Index < InSettings.BatchSize; ++Index)
+			{
+				const uint32 FieldIteration = Iteration * InSettings.BatchSize + Index;
+				const FField& Field = InPreset.Fields[FieldIteration % InPreset.Fields.Num()];
+				if (Index > 0)
+				{
+					Body << TEXT(',');
+				}
+
+				Body.Appendf(TEXT("{\"RequestId\":%d,\"URL\":\"/remote/preset/%s/property/%s\",\"Verb\":\"PUT\",\"Body\":{\"PropertyValue\":%s}}"),
+					Index, *InPreset.Name, *Field.Label, *MakeFieldValue(Field.Type, FieldIteration));
+			}
+			Body << TEXT("]}");
+
+			Request.SetVerb(TEXT("PUT"));
+			Request.SetURL(FString::Printf(TEXT("http://127.0.0.1:%u/remote/batch"), InSettings.HttpPort));
+			Request.SetContentAsString(Body.ToString());
+		});
+	}
+
+	void RunCallScenario(FScenarioResult& OutResult, const FBenchmarkSettings& InSettings, const FBenchmarkPreset& InPreset)
+	{
+		RunHttpScenario(OutResult, InSettings, [&InSettings, &InPreset](uint32 Iteration, IHttpRequest& Request)
+		{
+			Request.SetVerb(TEXT("PUT"));
+			Request.SetURL(FString::Printf(TEXT("http://127.0.0.1:%u/remote/object/call"), InSettings.HttpPort));
+			Request.SetContentAsString(FString::Printf(TEXT("{\"ObjectPath\":\"%s\",\"FunctionName\":\"BenchmarkFunction\",\"Parameters\":{\"InValue\":%s,\"InVector\":%s},\"GenerateTransaction\":false}"),
+				*InPreset.TargetPaths[Iteration % InPreset.TargetPaths.Num()], *MakeFieldValue(EFieldType::Float, Iteration), *MakeFieldValue(EFieldType::Vector, Iteration)));
+		});
+	}
+
+	/** Websocket client of the subscription scenario. */
+	struct FWebSocketClient
+	{
+		TSharedPtr<IWebSocket> Socket;
+		bool bConnected = false;
+		bool bFailed = false;
+		/** Whether the client is still waiting for the event caused by the last modification. */
+		bool bWaitingForEvent = false;
+		/** Fragments of the message being received. */
+		TArray<uint8> PartialMessage;
+	};
+
+	FString MakeWebSocketMessage(const FBenchmarkSettings& InSettings, const TCHAR* InMessageName, const FString& InParameters)
+	{
+		FString Message = FString::Printf(TEXT("{\"MessageName\":\"%s\",\"Parameters\":%s"), InMessageName, *InParameters);
+		if (!InSettings.Passphrase.IsEmpty())
+		{
+			Message += FString::Printf(TEXT(",\"Passphrase\":\"%s\""), *InSettings.Passphrase);
+		}
+		Message += TEXT('}');
+		return Message;
+	}
+
+	/**
+	 * Modify a field from a websocket client and measure how long it takes for each of the clients registered
+	 * to the preset to receive the change event, then repeat.
+	 */
+	void RunSubscriptionScenario(FScenarioResult& OutResult, const FBenchmarkSettings& InSettings, const FBenchmarkPreset& InPreset)
+	{
+		const FString Url = FString::Printf(TEXT("ws://127.0.0.1:%u"), InSettings.WebSocketPort);
+
+		TSharedRef<FWebSocketClient> Sender = MakeShared<FWebSocketClient>();
+		TArray<TSharedRef<FWebSocketClient>> Listeners;
+		int32 NumWaitingListeners = 0;
+		uint64 SentCycles = 0;
+
+		auto Connect = [&Url](FWebSocketClient& Client)
+		{
+			Client.Socket = FWebSocketsModule::Get().CreateWebSocket(Url);
+			Client.Socket->OnConnected().AddLambda([&Client]() { Client.bConnected = true; });
+			Client.Socket->OnConnectionError().AddLambda([&Client](const FString&) { Client.bFailed = true; });
+			Client.Socket->Connect();
+		};
+
+		Connect(*Sender);
+		for (int32 Index = 0; Index < InSettings.NumListeners; ++Index)
+		{
+			TSharedRef<FWebSocketClient> Listener = MakeShared<FWebSocketClient>();
+			Connect(*Listener);
+
+			Listener->Socket->OnRawMessage().AddLambda([&OutResult, &NumWaitingListeners, &SentCycles, &Client = *Listener](const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+			{
+				Client.PartialMessage.Append(static_cast<const uint8*>(Data), Size);
+				if (BytesRemaining > 0)
+				{
+					return;
+				}
+
+				FUTF8ToTCHAR Message(reinterpret_cast<const ANSICHAR*>(Client.PartialMessage.GetData()), Client.PartialMessage.Num());
+				if (Client.bWaitingForEvent && UE::String::FindFirst(FStringView(Message.Get(), Message.Length()), TEXT("PresetFieldsChanged")) != INDEX_NONE)
+				{
+					OutResult.Latency.Record(GetElapsedMicroseconds(SentCycles));
+					Client.bWaitingForEvent = false;
+					--NumWaitingListeners;
+				}
+
+				Client.PartialMessage.Reset();
+			});
+
+			Listeners.Add(MoveTemp(Listener));
+		}
+
+		auto AllClientsConnected = [&Sender, &Listeners]()
+		{
+			return Sender->bConnected && Algo::AllOf(Listeners, [](const TSharedRef<FWebSocketClient>& Listener) { return Listener->bConnected; });
+		};
+
+		if (PumpFramesUntil(AllClientsConnected, ConnectTimeout))
+		{
+			const FString RegisterMessage = MakeWebSocketMessage(InSettings, TEXT("preset.register"),
+				FString::Printf(TEXT("{\"PresetName\":\"%s\",\"IgnoreRemoteChanges\":false}"), *InPreset.Name));
+			for (const TSharedRef<FWebSocketClient>& Listener : Listeners)
+			{
+				Listener->Socket->Send(RegisterMessage);
+			}
+
+			// Let the registrations go through before measuring.
+			PumpFrames(0.5);
+
+			const FField* Field = InPreset.Fields.FindByPredicate([](const FField& Candidate) { return Candidate.Type == EFieldType::Float; });
+			check(Field);
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (uint32 Iteration = 0; FPlatformTime::Seconds() - StartTime < InSettings.Duration && !IsEngineExitRequested(); ++Iteration)
+			{
+				for (const TSharedRef<FWebSocketClient>& Listener : Listeners)
+				{
+					Listener->bWaitingForEvent = true;
+				}
+				NumWaitingListeners = Listeners.Num();
+
+				SentCycles = FPlatformTime::Cycles64();
+				Sender->Socket->Send(MakeWebSocketMessage(InSettings, TEXT("preset.property.modify"),
+					FString::Printf(TEXT("{\"PresetName\":\"%s\",\"PropertyLabel\":\"%s\",\"PropertyValue\":%s,\"TransactionMode\":\"NONE\"}"),
+						*InPreset.Name, *Field->Label, *MakeFieldValue(Field->Type, Iteration))));
+				++OutResult.Requests;
+
+				if (!PumpFramesUntil([&NumWaitingListeners]() { return NumWaitingListeners == 0; }, EventTimeout))
+				{
+					++OutResult.Errors;
+				}
+			}
+
+			OutResult.Duration = FPlatformTime::Seconds() - StartTime;
+		}
+		else
+		{
+			UE_LOG(LogRemoteControl, Error, TEXT("Benchmark websocket clients couldn't connect to %s."), *Url);
+		}
+
+		auto Disconnect = [](FWebSocketClient& Client)
+		{
+			Client.Socket->OnConnected().Clear();
+			Client.Socket->OnConnectionError().Clear();
+			Client.Socket->OnRawMessage().Clear();
+			Client.Socket->Close();
+		};
+
+		Disconnect(*Sender);
+		for (const TSharedRef<FWebSocketClient>& Listener : Listeners)
+		{
+			Disconnect(*Listener);
+		}
+
+		PumpFrames(0.5);
+	}
+
+	FBenchmarkSettings ParseSettings(const FString& InParams)
+	{
+		FBenchmarkSettings Settings;
+		FParse::Value(*InParams, TEXT("Fields="), Settings.NumFields);
+		FParse::Value(*InParams, TEXT("Duration="), Settings.Duration);
+		FParse::Value(*InParams, TEXT("Concurrency="), Settings.Concurrency);
+		FParse::Value(*InParams, TEXT("Listeners="), Settings.NumListeners);
+		FParse::Value(*InParams, TEXT("BatchSize="), Settings.BatchSize);
+		FParse::Value(*InParams, TEXT("Passphrase="), Settings.Passphrase);
+		FParse::Value(*InParams, TEXT("Output="), Settings.OutputFile);
+
+		Settings.NumFields = FMath::Max(Settings.NumFields, 1);
+		Settings.Duration = FMath::Max(Settings.Duration, 0.1);
+		Settings.Concurrency = FMath::Max(Settings.Concurrency, 1);
+		Settings.NumListeners = FMath::Max(Settings.NumListeners, 1);
+		Settings.BatchSize = FMath::Max(Settings.BatchSize, 1);
+
+		FString Scenarios = TEXT("get,set,batch,call,subscribe");
+		FParse::Value(*InParams, TEXT("Scenarios="), Scenarios, /*bShouldStopOnSeparator*/ false);
+		Scenarios.ParseIntoArray(Settings.Scenarios, TEXT(","));
+
+		Settings.HttpPort = GetDefault<URemoteControlSettings>()->RemoteControlHttpServerPort;
+		Settings.WebSocketPort = GetDefault<URemoteControlSettings>()->RemoteControlWebSocketServerPort;
+		return Settings;
+	}
+
+	FString SerializeResults(const FBenchmarkSettings& InSettings, const TArray<TUniquePtr<FScenarioResult>>& InResults)
+	{
+		FString Json;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Fields"), InSettings.NumFields);
+		Writer->WriteValue(TEXT("Duration"), InSettings.Duration);
+		Writer->WriteValue(TEXT("Concurrency"), InSettings.Concurrency);
+		Writer->WriteValue(TEXT("Listeners"), InSettings.NumListeners);
+		Writer->WriteValue(TEXT("BatchSize"), InSettings.BatchSize);
+
+		Writer->WriteArrayStart(TEXT("Scenarios"));
+		for (const TUniquePtr<FScenarioResult>& Result : InResults)
+		{
+			const FRCMetricsHistogram& Latency = Result->Latency;
+
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("Name"), Result->Name);
+			Writer->WriteValue(TEXT("Requests"), static_cast<int64>(Result->Requests));
+			Writer->WriteValue(TEXT("Errors"), static_cast<int64>(Result->Errors));
+			Writer->WriteValue(TEXT("Samples"), static_cast<int64>(Latency.GetCount()));
+			Writer->WriteValue(TEXT("DurationSeconds"), Result->Duration);
+			Writer->WriteValue(TEXT("RequestsPerSecond"), Result->Duration > 0.0 ? Result->Requests / Result->Duration : 0.0);
+
+			Writer->WriteObjectStart(TEXT("LatencyMicroseconds"));
+			Writer->WriteValue(TEXT("Mean"), Latency.GetCount() > 0 ? static_cast<double>(Latency.GetSum()) / Latency.GetCount() : 0.0);
+			Writer->WriteValue(TEXT("P50"), static_cast<int64>(Latency.GetPercentile(0.5)));
+			Writer->WriteValue(TEXT("P90"), static_cast<int64>(Latency.GetPercentile(0.9)));
+			Writer->WriteValue(TEXT("P99"), static_cast<int64>(Latency.GetPercentile(0.99)));
+			Writer->WriteValue(TEXT("P999"), static_cast<int64>(Latency.GetPercentile(0.999)));
+			Writer->WriteValue(TEXT("Max"), static_cast<int64>(Latency.GetPercentile(1.0)));
+			Writer->WriteObjectEnd();
+
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		return Json;
+	}
+}
+
+float URCBenchmarkTarget::BenchmarkFunction(float InValue, const FVector& InVector)
+{
+	FloatValue = InValue;
+	VectorValue = InVector;
+	return InValue + static_cast<float>(InVector.X);
+}
+
+UWebRemoteControlBenchmarkCommandlet::UWebRemoteControlBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UWebRemoteControlBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace WebRemoteControlBenchmark;
+
+	// The module only starts outside the editor, and in commandlets, when explicitly enabled.
+	if (!FParse::Param(FCommandLine::Get(), TEXT("RCWebControlEnable")))
+	{
+		UE_LOG(LogRemoteControl, Error, TEXT("The web remote control benchmark requires the -RCWebControlEnable flag."));
+		return 1;
+	}
+
+	// The module doesn't start in processes that can't render.
+	if (!FApp::CanEverRender())
+	{
+		UE_LOG(LogRemoteControl, Error, TEXT("The web remote control benchmark requires the -AllowCommandletRendering flag and can't run with -nullrhi."));
+		return 1;
+	}
+
+	const FBenchmarkSettings Settings = ParseSettings(Params);
+
+	FWebRemoteControlModule& WebRemoteControlModule = FWebRemoteControlModule::Get();
+	WebRemoteControlModule.StartHttpServer();
+	WebRemoteControlModule.StartWebSocketServer();
+	if (!WebRemoteControlModule.IsHttpServerRunning() || !WebRemoteControlModule.IsWebSocketServerRunning())
+	{
+		UE_LOG(LogRemoteControl, Error, TEXT("The web remote control servers couldn't be started on ports %u and %u."), Settings.HttpPort, Settings.WebSocketPort);
+		return 1;
+	}
+
+	URemoteControlPreset* Preset = IRemoteControlModule::Get().CreateTransientPreset();
+	if (!Preset)
+	{
+		UE_LOG(LogRemoteControl, Error, TEXT("The benchmark preset couldn't be created."));
+		return 1;
+	}
+
+	FBenchmarkPreset BenchmarkPreset;
+	BenchmarkPreset.Name = Preset->GetPresetName().ToString();
+
+	constexpr int32 NumFieldTypes = static_cast<int32>(EFieldType::Count);
+	for (int32 FieldIndex = 0; FieldIndex < Settings.NumFields; ++FieldIndex)
+	{
+		const int32 TargetIndex = FieldIndex / NumFieldTypes;
+		if (!Targets.IsValidIndex(TargetIndex))
+		{
+			URCBenchmarkTarget* Target = NewObject<URCBenchmarkTarget>(GetTransientPackage(), *FString::Printf(TEXT("RCBenchmarkTarget_%d"), TargetIndex));
+			Target->ArrayValue.Init(0.f, 4);
+			Targets.Add(Target);
+			BenchmarkPreset.TargetPaths.Add(Target->GetPathName());
+		}
+
+		const EFieldType Type = static_cast<EFieldType>(FieldIndex % NumFieldTypes);
+		const FString PropertyName = GetFieldPropertyName(Type);
+		FField Field{ FString::Printf(TEXT("%s_%d"), *PropertyName, TargetIndex), Type };
+
+		if (!Preset->ExposeProperty(Targets[TargetIndex], FRCFieldPathInfo{ PropertyName }, FRemoteControlPresetExposeArgs{ Field.Label, FGuid() }).IsValid())
+		{
+			UE_LOG(LogRemoteControl, Error, TEXT("Property %s couldn't be exposed on the benchmark preset."), *Field.Label);
+			IRemoteControlModule::Get().DestroyTransientPreset(Preset->GetPresetId());
+			return 1;
+		}
+
+		BenchmarkPreset.Fields.Add(MoveTemp(Field));
+	}
+
+	// Let the servers and the preset finish initializing.
+	PumpFrames(0.5);
+	FWebRemoteControlMetrics::Get().Reset();
+
+	TArray<TUniquePtr<FScenarioResult>> Results;
+	for (const FString& Scenario : Settings.Scenarios)
+	{
+		TUniquePtr<FScenarioResult> Result = MakeUnique<FScenarioResult>();
+		Result->Name = Scenario.TrimStartAndEnd().ToLower();
+
+		UE_LOG(LogRemoteControl, Display, TEXT("Running the %s benchmark scenario for %.1f seconds."), *Result->Name, Settings.Duration);
+
+		if (Result->Name == TEXT("get"))
+		{
+			RunGetScenario(*Result, Settings, BenchmarkPreset);
+		}
+		else if (Result->Name == TEXT("set"))
+		{
+			RunSetScenario(*Result, Settings, BenchmarkPreset);
+		}
+		else if (Result->Name == TEXT("batch"))
+		{
+			RunBatchScenario(*Result, Settings, BenchmarkPreset);
+		}
+		else if (Result->Name == TEXT("call"))
+		{
+			RunCallScenario(*Result, Settings, BenchmarkPreset);
+		}
+		else if (Result->Name == TEXT("subscribe"))
+		{
+			RunSubscriptionScenario(*Result, Settings, BenchmarkPreset);
+		}
+		else
+		{
+			UE_LOG(LogRemoteControl, Warning, TEXT("Unknown benchmark scenario %s, expected get, set, batch, call or subscribe."), *Result->Name);
+			continue;
+		}
+
+		Results.Add(MoveTemp(Result));
+	}
+
+	const FString Json = SerializeResults(Settings, Results);
+	UE_LOG(LogRemoteControl, Display, TEXT("Web remote control benchmark results:\n%s"), *Json);
+
+	if (!Settings.OutputFile.IsEmpty() && !FFileHelper::SaveStringToFile(Json, *Settings.OutputFile))
+	{
+		UE_LOG(LogRemoteControl, Error, TEXT("Couldn't write the benchmark results to %s."), *Settings.OutputFile);
+	}
+
+	IRemoteControlModule::Get().DestroyTransientPreset(Preset->GetPresetId());
+	Targets.Reset();
+
+	return 0;
+}
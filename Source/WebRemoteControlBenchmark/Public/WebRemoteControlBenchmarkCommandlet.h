@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Math/Color.h"
+#include "UObject/Object.h"
+
+#include "WebRemoteControlBenchmarkCommandlet.generated.h"
+
+/** Object exposed on the benchmark preset, holds one property of each kind commonly exposed by presets. */
+UCLASS(Transient)
+class URCBenchmarkTarget : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Function called by the function call scenario. */
+	UFUNCTION(BlueprintCallable, Category = "Benchmark")
+	float BenchmarkFunction(float InValue, const FVector& InVector);
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float FloatValue = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 IntValue = 0;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FVector VectorValue = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FLinearColor ColorValue = FLinearColor::White;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FString StringValue;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	TArray<float> ArrayValue;
+};
+
+/**
+ * Headless load generator for the web remote control servers.
+ * Exposes a generated preset, starts the http and websocket servers on their configured ports and drives them
+ * with simulated loopback clients, then reports the throughput and latency percentiles of each scenario as JSON.
+ *
+ * Lives in an editor module so it never ships with the runtime, run it from the editor executable.
+ * Web remote control doesn't start in processes that can't render, so commandlet rendering has to be allowed.
+ *
+ * Usage: -run=WebRemoteControlBenchmark -RCWebControlEnable -AllowCommandletRendering -RenderOffscreen [-Fields=60] [-Duration=10] [-Concurrency=8]
+ *        [-Listeners=16] [-BatchSize=16] [-Scenarios=get,set,batch,call,subscribe] [-Passphrase=...] [-Output=File.json]
+ */
+UCLASS()
+class UWebRemoteControlBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UWebRemoteControlBenchmarkCommandlet();
+
+	//~ Begin UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet interface
+
+private:
+	/** Objects whose properties are exposed on the benchmark preset. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<URCBenchmarkTarget>> Targets;
+};
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class WebRemoteControlBenchmark : ModuleRules
+{
+	public WebRemoteControlBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PublicDependencyModuleNames.AddRange(
+			new string[] {
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[] {
+				"HTTP",
+				"HTTPServer",
+				"Json",
+				"Networking",
+				"RemoteControl",
+				"RemoteControlCommon",
+				"Serialization",
+				"Sockets",
+				"WebRemoteControl",
+				"WebSocketNetworking",
+				"WebSockets"
+			}
+		);
+	}
+}